@@ -17,6 +17,7 @@ public class Backward_Royal : ModuleRules
 			"EnhancedInput",
 			"OnlineSubsystem",
 			"OnlineSubsystemUtils",
+			"NetCore",
 			"UMG",
 			"Slate",
 			"SlateCore",
@@ -26,7 +27,9 @@ public class Backward_Royal : ModuleRules
             "GeometryCollectionEngine",
             "ChaosSolverEngine",
             "NavigationSystem",
-			"AssetRegistry"
+			"AssetRegistry",
+			"EngineSettings",
+			"ReplicationGraph"
         });
 		
 		// Standalone 모드에서 Null Online Subsystem을 사용하기 위해 동적 로드
@@ -0,0 +1,206 @@
+// BRActorRegistrySubsystem.cpp
+#include "BRActorRegistrySubsystem.h"
+#include "BaseCharacter.h"
+#include "PlayerCharacter.h"
+#include "UpperBodyPawn.h"
+#include "BaseWeapon.h"
+#include "BRGameSession.h"
+#include "GameFramework/PlayerStart.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY(LogActorRegistry);
+
+namespace BRActorRegistry
+{
+	template <typename T>
+	static bool AddUnique(TArray<TObjectPtr<T>>& List, T* Actor)
+	{
+		if (!Actor || List.Contains(Actor)) return false;
+		List.Add(Actor);
+		return true;
+	}
+
+	template <typename T>
+	static bool Remove(TArray<TObjectPtr<T>>& List, T* Actor)
+	{
+		return List.RemoveSingleSwap(Actor, EAllowShrinking::No) > 0;
+	}
+}
+
+void UBRActorRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UBRActorRegistrySubsystem::HandleLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UBRActorRegistrySubsystem::HandleLevelRemovedFromWorld);
+}
+
+void UBRActorRegistrySubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	Characters.Empty();
+	UpperBodies.Empty();
+	Weapons.Empty();
+	PlayerStarts.Empty();
+	GameSession = nullptr;
+	UpperBodyByParent.Empty();
+
+	Super::Deinitialize();
+}
+
+void UBRActorRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 플레이어 스타트는 엔진 클래스라 BeginPlay에 끼어들 수 없음 → 레벨 단위로 1회 수집
+	for (ULevel* Level : InWorld.GetLevels())
+	{
+		RegisterPlayerStartsInLevel(Level);
+	}
+
+	UE_LOG(LogActorRegistry, Log, TEXT("레지스트리 시작: 캐릭터 %d / 상체 %d / 무기 %d / 플레이어 스타트 %d"),
+		Characters.Num(), UpperBodies.Num(), Weapons.Num(), PlayerStarts.Num());
+}
+
+UBRActorRegistrySubsystem* UBRActorRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UBRActorRegistrySubsystem>() : nullptr;
+}
+
+// ========== 등록/해제 ==========
+
+void UBRActorRegistrySubsystem::RegisterCharacter(ABaseCharacter* Character)
+{
+	if (UBRActorRegistrySubsystem* Registry = Get(Character))
+	{
+		BRActorRegistry::AddUnique(Registry->Characters, Character);
+	}
+}
+
+void UBRActorRegistrySubsystem::UnregisterCharacter(ABaseCharacter* Character)
+{
+	if (UBRActorRegistrySubsystem* Registry = Get(Character))
+	{
+		BRActorRegistry::Remove(Registry->Characters, Character);
+		if (const APlayerCharacter* PlayerChar = Cast<APlayerCharacter>(Character))
+		{
+			Registry->UpperBodyByParent.Remove(PlayerChar);
+		}
+	}
+}
+
+void UBRActorRegistrySubsystem::RegisterUpperBody(AUpperBodyPawn* UpperBody)
+{
+	if (UBRActorRegistrySubsystem* Registry = Get(UpperBody))
+	{
+		BRActorRegistry::AddUnique(Registry->UpperBodies, UpperBody);
+		NotifyUpperBodyAttached(UpperBody);
+	}
+}
+
+void UBRActorRegistrySubsystem::UnregisterUpperBody(AUpperBodyPawn* UpperBody)
+{
+	if (UBRActorRegistrySubsystem* Registry = Get(UpperBody))
+	{
+		BRActorRegistry::Remove(Registry->UpperBodies, UpperBody);
+		for (auto It = Registry->UpperBodyByParent.CreateIterator(); It; ++It)
+		{
+			if (It.Value() == UpperBody)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+void UBRActorRegistrySubsystem::NotifyUpperBodyAttached(AUpperBodyPawn* UpperBody)
+{
+	UBRActorRegistrySubsystem* Registry = UpperBody ? Get(UpperBody) : nullptr;
+	if (!Registry || !UpperBody->ParentBodyCharacter) return;
+
+	Registry->UpperBodyByParent.Add(UpperBody->ParentBodyCharacter, UpperBody);
+}
+
+void UBRActorRegistrySubsystem::RegisterWeapon(ABaseWeapon* Weapon)
+{
+	if (UBRActorRegistrySubsystem* Registry = Get(Weapon))
+	{
+		BRActorRegistry::AddUnique(Registry->Weapons, Weapon);
+	}
+}
+
+void UBRActorRegistrySubsystem::UnregisterWeapon(ABaseWeapon* Weapon)
+{
+	if (UBRActorRegistrySubsystem* Registry = Get(Weapon))
+	{
+		BRActorRegistry::Remove(Registry->Weapons, Weapon);
+	}
+}
+
+void UBRActorRegistrySubsystem::RegisterGameSession(ABRGameSession* InGameSession)
+{
+	if (UBRActorRegistrySubsystem* Registry = Get(InGameSession))
+	{
+		Registry->GameSession = InGameSession;
+	}
+}
+
+void UBRActorRegistrySubsystem::UnregisterGameSession(ABRGameSession* InGameSession)
+{
+	UBRActorRegistrySubsystem* Registry = Get(InGameSession);
+	if (Registry && Registry->GameSession == InGameSession)
+	{
+		Registry->GameSession = nullptr;
+	}
+}
+
+// ========== 플레이어 스타트 (레벨 스트리밍 대응) ==========
+
+void UBRActorRegistrySubsystem::RegisterPlayerStartsInLevel(ULevel* InLevel)
+{
+	if (!InLevel) return;
+
+	for (AActor* Actor : InLevel->Actors)
+	{
+		if (APlayerStart* PlayerStart = Cast<APlayerStart>(Actor))
+		{
+			BRActorRegistry::AddUnique(PlayerStarts, PlayerStart);
+		}
+	}
+}
+
+void UBRActorRegistrySubsystem::HandleLevelAddedToWorld(ULevel* InLevel, UWorld* InWorld)
+{
+	if (InWorld == GetWorld() && InWorld->HasBegunPlay())
+	{
+		RegisterPlayerStartsInLevel(InLevel);
+	}
+}
+
+void UBRActorRegistrySubsystem::HandleLevelRemovedFromWorld(ULevel* InLevel, UWorld* InWorld)
+{
+	if (InWorld != GetWorld()) return;
+
+	// InLevel == nullptr이면 월드 전체 정리
+	PlayerStarts.RemoveAllSwap([InLevel](const APlayerStart* PlayerStart)
+		{
+			return !IsValid(PlayerStart) || !InLevel || PlayerStart->GetLevel() == InLevel;
+		}, EAllowShrinking::No);
+}
+
+// ========== 조회 ==========
+
+AUpperBodyPawn* UBRActorRegistrySubsystem::FindUpperBodyByParent(const APlayerCharacter* ParentBody) const
+{
+	const TObjectPtr<AUpperBodyPawn>* Found = UpperBodyByParent.Find(ParentBody);
+	if (!Found) return nullptr;
+
+	// 다른 하체로 옮겨 붙은 경우 (NotifyUpperBodyAttached 누락 대비)
+	AUpperBodyPawn* UpperBody = *Found;
+	return (IsValid(UpperBody) && UpperBody->ParentBodyCharacter == ParentBody) ? UpperBody : nullptr;
+}
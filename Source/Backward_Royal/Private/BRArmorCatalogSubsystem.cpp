@@ -0,0 +1,116 @@
+// BRArmorCatalogSubsystem.cpp
+#include "BRArmorCatalogSubsystem.h"
+#include "BRGameInstance.h"
+#include "Engine/DataTable.h"
+
+DEFINE_LOG_CATEGORY(LogArmorCatalog);
+
+const FString UBRArmorCatalogSubsystem::ArmorTableKey(TEXT("ArmorData"));
+
+void UBRArmorCatalogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// GameInstance::Init의 설정 로드(UBRConfigService)에서 다시 빌드되지만, 테이블이 이미 지정되어 있으면 바로 인덱싱
+	if (UBRGameInstance* GI = Cast<UBRGameInstance>(GetGameInstance()))
+	{
+		if (UDataTable** Found = GI->ConfigDataMap.Find(ArmorTableKey))
+		{
+			RebuildIndex(*Found);
+		}
+	}
+}
+
+void UBRArmorCatalogSubsystem::Deinitialize()
+{
+	ClearIndex();
+	ArmorTable.Reset();
+	Super::Deinitialize();
+}
+
+void UBRArmorCatalogSubsystem::ClearIndex()
+{
+	for (TArray<const FArmorData*>& Slot : SlotIndex)
+	{
+		Slot.Reset();
+	}
+	NumIndexed = 0;
+}
+
+void UBRArmorCatalogSubsystem::RebuildIndex(UDataTable* InArmorTable)
+{
+	ClearIndex();
+	ArmorTable = InArmorTable;
+
+	if (!InArmorTable)
+	{
+		UE_LOG(LogArmorCatalog, Warning, TEXT("RebuildIndex: ArmorData 테이블이 없습니다."));
+		return;
+	}
+
+	if (InArmorTable->GetRowStruct() != FArmorData::StaticStruct())
+	{
+		UE_LOG(LogArmorCatalog, Error, TEXT("RebuildIndex: %s 의 RowStruct가 FArmorData가 아닙니다."), *InArmorTable->GetName());
+		return;
+	}
+
+	// RowMap을 직접 순회 (GetAllRows의 임시 TArray 할당 없음)
+	for (const TPair<FName, uint8*>& Pair : InArmorTable->GetRowMap())
+	{
+		const FArmorData* Row = reinterpret_cast<const FArmorData*>(Pair.Value);
+		if (!Row) continue;
+
+		const EArmorSlot Slot = FArmorData::GetSlotFromID(Row->ID);
+		if (Slot == EArmorSlot::None)
+		{
+			UE_LOG(LogArmorCatalog, Warning, TEXT("RebuildIndex: [%s] ID %d 는 슬롯 규칙에 맞지 않아 제외"), *Pair.Key.ToString(), Row->ID);
+			continue;
+		}
+
+		TArray<const FArmorData*>& Slots = SlotIndex[(int32)Slot];
+		const int32 LocalIndex = Row->ID % 100;
+		if (Slots.Num() <= LocalIndex)
+		{
+			Slots.SetNumZeroed(LocalIndex + 1);
+		}
+
+		if (Slots[LocalIndex])
+		{
+			UE_LOG(LogArmorCatalog, Warning, TEXT("RebuildIndex: ID %d 중복 - [%s] 가 기존 행을 덮어씁니다."), Row->ID, *Pair.Key.ToString());
+		}
+		else
+		{
+			NumIndexed++;
+		}
+		Slots[LocalIndex] = Row;
+	}
+
+	UE_LOG(LogArmorCatalog, Log, TEXT("RebuildIndex: %s 인덱싱 완료 (%d개)"), *InArmorTable->GetName(), NumIndexed);
+}
+
+const FArmorData* UBRArmorCatalogSubsystem::FindArmor(int32 ArmorID) const
+{
+	const EArmorSlot Slot = FArmorData::GetSlotFromID(ArmorID);
+	if (Slot == EArmorSlot::None)
+	{
+		return nullptr;
+	}
+
+	const TArray<const FArmorData*>& Slots = SlotIndex[(int32)Slot];
+	const int32 LocalIndex = ArmorID % 100;
+	return Slots.IsValidIndex(LocalIndex) ? Slots[LocalIndex] : nullptr;
+}
+
+void UBRArmorCatalogSubsystem::ForEachArmor(TFunctionRef<void(const FArmorData&)> Visitor) const
+{
+	for (const TArray<const FArmorData*>& Slots : SlotIndex)
+	{
+		for (const FArmorData* Armor : Slots)
+		{
+			if (Armor)
+			{
+				Visitor(*Armor);
+			}
+		}
+	}
+}
@@ -0,0 +1,299 @@
+// BRAssetStreamingSubsystem.cpp
+#include "BRAssetStreamingSubsystem.h"
+#include "BRArmorCatalogSubsystem.h"
+#include "BRPlayerState.h"
+#include "BRPlayerController.h"
+#include "ArmorTypes.h"
+#include "Engine/AssetManager.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StreamableManager.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameMapsSettings.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY(LogAssetStreaming);
+
+namespace
+{
+	/** 진행률 보고 간격 (초). 보고 자체는 10% 단위로만 전송 */
+	constexpr float StagePreloadTickInterval = 0.25f;
+}
+
+void UBRAssetStreamingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &UBRAssetStreamingSubsystem::HandlePostLoadMap);
+}
+
+void UBRAssetStreamingSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	ReleaseStagePreload();
+
+	for (TPair<int32, TSharedPtr<FStreamableHandle>>& Pair : PrefetchHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->ReleaseHandle();
+		}
+	}
+	PrefetchHandles.Empty();
+
+	Super::Deinitialize();
+}
+
+void UBRAssetStreamingSubsystem::CollectArmorIDs(const FBRCustomizationData& Data, TSet<int32>& OutIDs) const
+{
+	if (!Data.bIsDataValid) return;
+
+	for (int32 ID : { Data.HeadID, Data.ChestID, Data.HandID, Data.LegID, Data.FootID })
+	{
+		// 0 = 장비 해제 (기본 메시)
+		if (ID != 0)
+		{
+			OutIDs.Add(ID);
+		}
+	}
+}
+
+void UBRAssetStreamingSubsystem::PrefetchForPlayers(const AGameStateBase* GameState, const APlayerState* LeavingPlayer)
+{
+	if (!GameState) return;
+
+	const UBRArmorCatalogSubsystem* ArmorCatalog = GetGameInstance()->GetSubsystem<UBRArmorCatalogSubsystem>();
+	if (!ArmorCatalog) return;
+
+	TSet<int32> WantedIDs;
+	for (const APlayerState* PS : GameState->PlayerArray)
+	{
+		if (PS == LeavingPlayer || !IsValid(PS) || PS->IsActorBeingDestroyed()) continue;
+
+		if (const ABRPlayerState* BRPS = Cast<ABRPlayerState>(PS))
+		{
+			CollectArmorIDs(BRPS->CustomizationData, WantedIDs);
+		}
+	}
+
+	// 1. 더 이상 누구도 착용하지 않는 ID는 핸들 해제 (나간 플레이어만 쓰던 ID 포함, GC 대상이 되도록)
+	for (auto It = PrefetchHandles.CreateIterator(); It; ++It)
+	{
+		if (!WantedIDs.Contains(It.Key()))
+		{
+			if (It.Value().IsValid())
+			{
+				It.Value()->ReleaseHandle();
+			}
+			It.RemoveCurrent();
+		}
+	}
+
+	// 2. 새로 필요한 ID만 비동기 로드 요청
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	int32 NumRequested = 0;
+	for (int32 ArmorID : WantedIDs)
+	{
+		if (PrefetchHandles.Contains(ArmorID)) continue;
+
+		const FArmorData* Armor = ArmorCatalog->FindArmor(ArmorID);
+		if (!Armor || Armor->ArmorMesh.IsNull()) continue;
+
+		PrefetchHandles.Add(ArmorID, Streamable.RequestAsyncLoad(Armor->ArmorMesh.ToSoftObjectPath(), FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority));
+		NumRequested++;
+	}
+
+	if (NumRequested > 0)
+	{
+		UE_LOG(LogAssetStreaming, Log, TEXT("PrefetchForPlayers: 신규 %d개 요청 (유지 %d개)"), NumRequested, PrefetchHandles.Num());
+		LogStreamingReport();
+	}
+}
+
+void UBRAssetStreamingSubsystem::RequestArmorMesh(int32 ArmorID, FOnArmorMeshLoaded OnLoaded)
+{
+	const UBRArmorCatalogSubsystem* ArmorCatalog = GetGameInstance()->GetSubsystem<UBRArmorCatalogSubsystem>();
+	const FArmorData* Armor = ArmorCatalog ? ArmorCatalog->FindArmor(ArmorID) : nullptr;
+	if (!Armor || Armor->ArmorMesh.IsNull())
+	{
+		OnLoaded.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	// 이미 메모리에 있으면 즉시 적용
+	if (USkeletalMesh* LoadedMesh = Armor->ArmorMesh.Get())
+	{
+		OnLoaded.ExecuteIfBound(LoadedMesh);
+		return;
+	}
+
+	// 행 포인터는 테이블 재로드 시 바뀔 수 있으므로 경로만 캡처
+	const FSoftObjectPath MeshPath = Armor->ArmorMesh.ToSoftObjectPath();
+	UAssetManager::GetStreamableManager().RequestAsyncLoad(MeshPath,
+		FStreamableDelegate::CreateWeakLambda(this, [MeshPath, OnLoaded]()
+			{
+				OnLoaded.ExecuteIfBound(Cast<USkeletalMesh>(MeshPath.ResolveObject()));
+			}),
+		FStreamableManager::AsyncLoadHighPriority);
+}
+
+float UBRAssetStreamingSubsystem::GetAvoidedArmorMeshMB(int32* OutNumAvoided) const
+{
+	const UBRArmorCatalogSubsystem* ArmorCatalog = GetGameInstance()->GetSubsystem<UBRArmorCatalogSubsystem>();
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+
+	int64 AvoidedBytes = 0;
+	int32 NumAvoided = 0;
+	if (ArmorCatalog && AssetRegistry)
+	{
+		ArmorCatalog->ForEachArmor([&](const FArmorData& Armor)
+			{
+				if (Armor.ArmorMesh.IsNull() || Armor.ArmorMesh.Get()) return;
+
+				NumAvoided++;
+				const TOptional<FAssetPackageData> PackageData = AssetRegistry->GetAssetPackageDataCopy(Armor.ArmorMesh.ToSoftObjectPath().GetLongPackageFName());
+				if (PackageData.IsSet() && PackageData->DiskSize > 0)
+				{
+					AvoidedBytes += PackageData->DiskSize;
+				}
+			});
+	}
+
+	if (OutNumAvoided)
+	{
+		*OutNumAvoided = NumAvoided;
+	}
+	return (float)((double)AvoidedBytes / (1024.0 * 1024.0));
+}
+
+void UBRAssetStreamingSubsystem::LogStreamingReport() const
+{
+	int32 NumAvoided = 0;
+	const float AvoidedMB = GetAvoidedArmorMeshMB(&NumAvoided);
+	UE_LOG(LogAssetStreaming, Log, TEXT("[방어구 스트리밍] prefetch %d개 유지 | 미로드 %d개, 약 %.2f MB 로드 회피"),
+		PrefetchHandles.Num(), NumAvoided, AvoidedMB);
+}
+
+void UBRAssetStreamingSubsystem::PreloadStage(const FString& StagePackageName)
+{
+	if (StagePackageName.IsEmpty() || StagePackageName == PreloadedStagePackage) return;
+
+	// PIE는 일반 ServerTravel + 에디터 패키지 경로를 쓰므로 선행 로드 대상 아님
+	const UWorld* World = GetGameInstance()->GetWorld();
+	if (World && World->IsPlayInEditor())
+	{
+		UE_LOG(LogAssetStreaming, Log, TEXT("[Stage 선행 로드] PIE → 스킵 (%s)"), *StagePackageName);
+		return;
+	}
+
+	ReleaseStagePreload();
+	PreloadedStagePackage = StagePackageName;
+	StagePreloadStartTime = FPlatformTime::Seconds();
+	LastReportedStagePercent = -1;
+
+	// 월드 에셋을 로드하면 패키지와 하드 참조 의존 에셋이 함께 올라옴. 핸들이 살아 있는 동안 GC되지 않음
+	const FSoftObjectPath WorldPath(FString::Printf(TEXT("%s.%s"), *StagePackageName, *FPackageName::GetShortName(StagePackageName)));
+	StagePreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(WorldPath,
+		FStreamableDelegate::CreateUObject(this, &UBRAssetStreamingSubsystem::HandleStagePreloaded),
+		FStreamableManager::DefaultAsyncLoadPriority);
+	if (!StagePreloadHandle.IsValid())
+	{
+		UE_LOG(LogAssetStreaming, Warning, TEXT("[Stage 선행 로드] 요청 실패: %s"), *StagePackageName);
+		PreloadedStagePackage.Reset();
+		return;
+	}
+
+	UE_LOG(LogAssetStreaming, Log, TEXT("[Stage 선행 로드] 시작: %s"), *StagePackageName);
+	ReportStagePreloadProgress(true);
+	if (!StagePreloadHandle->HasLoadCompleted() && !StagePreloadTickerHandle.IsValid())
+	{
+		StagePreloadTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UBRAssetStreamingSubsystem::TickStagePreload), StagePreloadTickInterval);
+	}
+}
+
+void UBRAssetStreamingSubsystem::ReleaseStagePreload()
+{
+	if (StagePreloadTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(StagePreloadTickerHandle);
+		StagePreloadTickerHandle.Reset();
+	}
+	if (StagePreloadHandle.IsValid())
+	{
+		if (StagePreloadHandle->HasLoadCompleted())
+		{
+			StagePreloadHandle->ReleaseHandle();
+		}
+		else
+		{
+			StagePreloadHandle->CancelHandle();
+		}
+		StagePreloadHandle.Reset();
+	}
+	PreloadedStagePackage.Reset();
+	LastReportedStagePercent = -1;
+}
+
+float UBRAssetStreamingSubsystem::GetStagePreloadProgress() const
+{
+	return StagePreloadHandle.IsValid() ? StagePreloadHandle->GetProgress() : 0.0f;
+}
+
+void UBRAssetStreamingSubsystem::HandleStagePreloaded()
+{
+	const double ElapsedMs = (FPlatformTime::Seconds() - StagePreloadStartTime) * 1000.0;
+	const bool bLoaded = StagePreloadHandle.IsValid() && StagePreloadHandle->GetLoadedAsset() != nullptr;
+	UE_LOG(LogAssetStreaming, Log, TEXT("[Stage 선행 로드] %s: %s (%.0fms)"),
+		bLoaded ? TEXT("완료") : TEXT("실패"), *PreloadedStagePackage, ElapsedMs);
+	ReportStagePreloadProgress(true);
+}
+
+bool UBRAssetStreamingSubsystem::TickStagePreload(float DeltaTime)
+{
+	if (!StagePreloadHandle.IsValid() || StagePreloadHandle->HasLoadCompleted())
+	{
+		StagePreloadTickerHandle.Reset();
+		return false;
+	}
+	ReportStagePreloadProgress(false);
+	return true;
+}
+
+void UBRAssetStreamingSubsystem::ReportStagePreloadProgress(bool bForce)
+{
+	const int32 Percent = FMath::Clamp(FMath::FloorToInt(GetStagePreloadProgress() * 100.0f), 0, 100);
+	if (!bForce && Percent / 10 == LastReportedStagePercent / 10) return;
+	if (Percent == LastReportedStagePercent) return;
+	LastReportedStagePercent = Percent;
+
+	// 데디케이티드 서버는 로컬 컨트롤러가 없음 (자기 로드만 하고 보고는 생략)
+	if (ABRPlayerController* PC = Cast<ABRPlayerController>(GetGameInstance()->GetFirstLocalPlayerController()))
+	{
+		PC->ServerReportStagePreloadProgress(PreloadedStagePackage, (uint8)Percent);
+	}
+}
+
+void UBRAssetStreamingSubsystem::HandlePostLoadMap(UWorld* LoadedWorld)
+{
+	if (!LoadedWorld || PreloadedStagePackage.IsEmpty()) return;
+
+	// Seamless Travel 중간의 전환 맵은 무시 (최종 목적지에서 판단)
+	const FString LoadedPackage = LoadedWorld->GetOutermost()->GetName();
+	const FString TransitionPackage = GetDefault<UGameMapsSettings>()->TransitionMap.GetLongPackageName();
+	if (!TransitionPackage.IsEmpty() && LoadedPackage == TransitionPackage) return;
+
+	if (LoadedPackage == PreloadedStagePackage)
+	{
+		UE_LOG(LogAssetStreaming, Log, TEXT("[Stage 선행 로드] Travel에서 재사용: %s (선행 로드 시작부터 %.1f초)"),
+			*LoadedPackage, FPlatformTime::Seconds() - StagePreloadStartTime);
+	}
+	else
+	{
+		UE_LOG(LogAssetStreaming, Warning, TEXT("[Stage 선행 로드] 다른 맵 로드됨 (%s ≠ %s) → 선행 로드 해제"), *LoadedPackage, *PreloadedStagePackage);
+	}
+	// 이제 월드가 패키지를 참조하므로 핸들은 놓아도 됨
+	ReleaseStagePreload();
+}
@@ -3,25 +3,58 @@
 #include "BaseCharacter.h"
 #include "BaseWeapon.h"
 #include "TimerManager.h"
-#include "GlobalBalanceData.h"
+#include "BRBalanceSubsystem.h"
+#include "BRCombatEventSubsystem.h"
 #include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/PhysicsSettings.h"
 #include "Kismet/GameplayStatics.h"
 
 DEFINE_LOG_CATEGORY(LogAttackComp);
 
-// 기본 펀치 데미지 전역 변수
-
-float UBRAttackComponent::Global_BasePunchDamage = 10.0f;
-
 UBRAttackComponent::UBRAttackComponent()
 {
-    PrimaryComponentTick.bCanEverTick = false;
+    // 틱은 SweptTrace 공격 구간 동안 서버에서만 켜짐 (애니메이션·물리 결과 반영 후 스윕)
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    PrimaryComponentTick.TickGroup = TG_PostPhysics;
     SetIsReplicatedByDefault(true); // 수정
+
+    PunchSweepBones = { TEXT("hand_l"), TEXT("hand_r") };
 }
 
 void UBRAttackComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    // 서버/클라이언트 모두 같은 (서버가 발행·복제한) 스냅샷으로 공격 속도와 데미지를 계산
+    if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+    {
+        Balance->OnBalanceChanged.AddUObject(this, &UBRAttackComponent::HandleBalanceChanged);
+    }
+    HandleBalanceChanged(*UBRBalanceSubsystem::GetSnapshot(this));
+}
+
+void UBRAttackComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+    {
+        Balance->OnBalanceChanged.RemoveAll(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UBRAttackComponent::HandleBalanceChanged(const FBRBalanceSnapshot& Snapshot)
+{
+    if (Snapshot.Serial == CachedBalanceSerial) return;
+
+    CachedBalanceSerial = Snapshot.Serial;
+    CachedDamageMultiplier = Snapshot.Data.Global_Weapon_DamageMultiplier;
+    CachedImpulseMultiplier = Snapshot.Data.Global_Weapon_ImpulseMultiplier;
+    CachedAttackSpeedMultiplier = Snapshot.Data.Global_Weapon_AttackSpeedMultiplier;
+    CachedBasePunchDamage = Snapshot.Data.Global_BasePunchDamage;
 }
 
 void UBRAttackComponent::ServerSetAttackDetection_Implementation(bool bEnabled)
@@ -43,7 +76,25 @@ void UBRAttackComponent::SetAttackDetection(bool bEnabled)
     // 공격이 새로 시작될 때마다 피격 액터 목록을 초기화하여 여러 번 휘두를 때 정상 타격되도록 보정
     if (bEnabled)
     {
-        HitActors.Empty();
+        BeginSwing();
+    }
+
+    // 스윕 판정: 충돌 프로필은 건드리지 않고 서버 틱에서 트레이스로 판정
+    if (HitDetectionMode == EBRHitDetectionMode::SweptTrace)
+    {
+        if (GetOwner()->HasAuthority())
+        {
+            if (bEnabled)
+            {
+                BeginSweepWindow();
+            }
+            else
+            {
+                EndSweepWindow();
+                EndSwing();
+            }
+        }
+        return;
     }
 
     // 1. 무기 공격 설정
@@ -86,7 +137,7 @@ void UBRAttackComponent::SetAttackDetection(bool bEnabled)
                     }
                 }
                 WeaponMesh->OnComponentHit.RemoveDynamic(this, &UBRAttackComponent::InternalHandleOwnerHit);
-                HitActors.Empty();
+                EndSwing();
             }
         }
     }
@@ -112,13 +163,38 @@ void UBRAttackComponent::SetAttackDetection(bool bEnabled)
                 BodyMesh->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
                 BodyMesh->SetNotifyRigidBodyCollision(false);
                 BodyMesh->OnComponentHit.RemoveDynamic(this, &UBRAttackComponent::InternalHandleOwnerHit);
-                HitActors.Empty();
+                EndSwing();
             }
 
         }
     }
 }
 
+void UBRAttackComponent::BeginSwing()
+{
+    // 종료 없이 다시 시작된 경우(노티파이 누락 등)에도 직전 통계는 집계
+    if (bSwingOpen)
+    {
+        EndSwing();
+    }
+    HitActors.Reset();
+    bSwingOpen = true;
+}
+
+void UBRAttackComponent::EndSwing()
+{
+    if (bSwingOpen)
+    {
+        LastSwingDuplicatesRejected = HitActors.GetNumDuplicatesRejected();
+        TotalDuplicatesRejected += LastSwingDuplicatesRejected;
+        TotalSwings++;
+        ATK_LOG(Verbose, TEXT("Swing end: %d hit, %d duplicate contacts rejected (total %d over %d swings)"),
+            HitActors.Num(), LastSwingDuplicatesRejected, TotalDuplicatesRejected, TotalSwings);
+    }
+    HitActors.Reset();
+    bSwingOpen = false;
+}
+
 // 히트 스탑 적용 함수
 void UBRAttackComponent::ApplyHitStop(float Duration)
 {
@@ -133,12 +209,6 @@ void UBRAttackComponent::ApplyHitStop(float Duration)
     }
 }
 
-// 멀티캐스트 구현: 서버에서 호출하면 모든 클라이언트가 ApplyHitStop 실행
-void UBRAttackComponent::MulticastApplyHitStop_Implementation(float Duration)
-{
-    ApplyHitStop(Duration);
-}
-
 // 히트 스탑 해제 및 애니메이션 종료
 void UBRAttackComponent::ResetHitStop()
 {
@@ -171,38 +241,36 @@ void UBRAttackComponent::InternalHandleOwnerHit(UPrimitiveComponent* HitComponen
 
     if (!GetOwner()->HasAuthority()) return;
 
-    if (HitActors.Contains(OtherActor)) return;
+    // 래그돌/피지컬 애니메이션 접촉은 프레임당 여러 번 들어오므로 여기서 먼저 걸러냄
+    if (HitActors.RejectDuplicate(OtherActor)) return;
 
     ProcessHitDamage(OtherActor, OtherComp, NormalImpulse, Hit);
 }
 
-void UBRAttackComponent::MulticastPlayHitSound_Implementation(USoundBase* SoundToPlay, FVector Location, float Volume)
+void UBRAttackComponent::ProcessHitDamage(AActor* OtherActor, UPrimitiveComponent* OtherComp, const FVector& NormalImpulse, const FHitResult& Hit)
 {
-    if (SoundToPlay)
-    {
-        UGameplayStatics::PlaySoundAtLocation(this, SoundToPlay, Location, Volume);
-    }
+    if (HitActors.RejectDuplicate(OtherActor)) return;
+
+    // [수정] 피지컬 애니메이션 적용 시 무기 충돌 반발력이 수십만 단위로 폭증하여 무기가 즉시 파괴되는 현상 방지를 위해 제한(Clamp)
+    const float ImpactForce = FMath::Clamp(NormalImpulse.Size(), 0.0f, MaxImpactForce);
+    ApplyHit(OtherActor, OtherComp, ImpactForce, -Hit.ImpactNormal, Hit);
 }
 
-void UBRAttackComponent::ProcessHitDamage(AActor* OtherActor, UPrimitiveComponent* OtherComp, const FVector& NormalImpulse, const FHitResult& Hit)
+void UBRAttackComponent::ApplyHit(AActor* OtherActor, UPrimitiveComponent* OtherComp, float ImpactForce, const FVector& InImpulseDir, const FHitResult& Hit)
 {
     ABaseCharacter* OwnerChar = Cast<ABaseCharacter>(GetOwner());
     ABaseWeapon* MyWeapon = OwnerChar->CurrentWeapon;
 
-    if (HitActors.Contains(OtherActor)) return;
-
-    // [수정] 피지컬 애니메이션 적용 시 무기 충돌 반발력이 수십만 단위로 폭증하여 무기가 즉시 파괴되는 현상 방지를 위해 제한(Clamp)
-    float ImpactForce = FMath::Clamp(NormalImpulse.Size(), 0.0f, 5000.0f);
     float ImpulseMultiplier = 1.0f;
 
     if (MyWeapon)
     {
-        ImpulseMultiplier = ABaseWeapon::GlobalImpulseMultiplier * MyWeapon->CurrentWeaponData.MassKg * MyWeapon->CurrentWeaponData.ImpulseCoefficient;
+        ImpulseMultiplier = CachedImpulseMultiplier * MyWeapon->CurrentWeaponData.MassKg * MyWeapon->CurrentWeaponData.ImpulseCoefficient;
     }
 
     float FinalImpulsePower = FMath::Max(ImpactForce * ImpulseMultiplier, 500.0f);
 
-    FVector ImpulseDir = -Hit.ImpactNormal;
+    FVector ImpulseDir = InImpulseDir.GetSafeNormal();
     if (ImpulseDir.IsNearlyZero()) ImpulseDir = OwnerChar->GetActorForwardVector();
 
     FVector FinalImpulseVector = ImpulseDir * FinalImpulsePower;
@@ -217,12 +285,12 @@ void UBRAttackComponent::ProcessHitDamage(AActor* OtherActor, UPrimitiveComponen
     float CalculatedDamage = 0.0f;
     if (MyWeapon)
     {
-        CalculatedDamage = ImpactForce * MyWeapon->CurrentWeaponData.DamageCoefficient * MyWeapon->CurrentWeaponData.MassKg * ABaseWeapon::GlobalDamageMultiplier * 0.001f;
+        CalculatedDamage = ImpactForce * MyWeapon->CurrentWeaponData.DamageCoefficient * MyWeapon->CurrentWeaponData.MassKg * CachedDamageMultiplier * 0.001f;
     }
     else
     {
         // [수정] 맨손 공격 시 기본 데미지 10 추가
-        CalculatedDamage = (ImpactForce * 0.001f) + Global_BasePunchDamage;
+        CalculatedDamage = (ImpactForce * 0.001f) + CachedBasePunchDamage;
     }
 
     // 디버그 출력
@@ -235,6 +303,13 @@ void UBRAttackComponent::ProcessHitDamage(AActor* OtherActor, UPrimitiveComponen
         ATK_LOG(Log, TEXT("Target: %s, Damage: %.1f, Impulse: %.1f"), *OtherActor->GetName(), CalculatedDamage, FinalImpulsePower);
     }
 
+    // 타격 연출(타격음 + 히트 스탑 + 피지컬 리액션)은 이벤트 1건으로 묶어 프레임 끝에 일괄 멀티캐스트
+    FBRCombatEvent CombatEvent;
+    CombatEvent.Attacker = OwnerChar;
+    CombatEvent.HitLocation = Hit.ImpactPoint;
+    // 공격 성공 시 히트 스탑 적용 (0.1초 멈춤 -> 이후 애니메이션 종료)
+    CombatEvent.SetHitStopDuration(HitStopDuration);
+
     // 유효타 처리
     if (CalculatedDamage >= 3.0f)
     {
@@ -247,37 +322,30 @@ void UBRAttackComponent::ProcessHitDamage(AActor* OtherActor, UPrimitiveComponen
         {
             if (Cast<ABaseCharacter>(OtherActor))
             {
+                // 내구도 감소로 무기가 파괴될 수 있으므로 타격음을 먼저 기록
+                CombatEvent.Sound = MyWeapon->CurrentWeaponData.HitSound;
                 MyWeapon->DecreaseDurability(CalculatedDamage);
-
-                // 무기로 때렸을 때 소리 재생
-                if (MyWeapon->CurrentWeaponData.HitSound)
-                {
-                    // [핵심] 3번째 인자로 1.0f (볼륨) 추가!
-                    MulticastPlayHitSound(MyWeapon->CurrentWeaponData.HitSound, Hit.ImpactPoint, 1.0f);
-                }
             }
         }
-        else
+        else if (OwnerChar)
         {
             // 맨손으로 때렸을 때 소리 재생
-            if (OwnerChar && OwnerChar->PunchHitSound)
-            {
-                // [핵심] 3번째 인자로 1.0f (볼륨) 추가!
-                MulticastPlayHitSound(OwnerChar->PunchHitSound, Hit.ImpactPoint, 1.0f);
-            }
+            CombatEvent.Sound = OwnerChar->PunchHitSound;
         }
         // =======================================================
     }
 
-    // 공격 성공 시 히트 스탑 적용 (0.1초 멈춤 -> 이후 애니메이션 종료)
-    MulticastApplyHitStop(0.1f);
-
     if (GetOwner()->HasAuthority())
     {
         if (ABaseCharacter* VictimChar = Cast<ABaseCharacter>(OtherActor))
         {
-            // [핵심] 피지컬 애니메이션 흔들림은 멀티캐스트를 통해 모든 화면에서 실행
-            VictimChar->MulticastPlayPhysicalHitReaction(FinalImpulseVector, Hit.ImpactPoint, Hit.BoneName);
+            // [핵심] 피지컬 애니메이션 흔들림은 타격 이벤트를 통해 모든 화면에서 실행
+            CombatEvent.Victim = VictimChar;
+            CombatEvent.Impulse = FinalImpulseVector;
+            if (const USkeletalMeshComponent* VictimMesh = VictimChar->GetMesh())
+            {
+                CombatEvent.BoneIndex = (int16)VictimMesh->GetBoneIndex(Hit.BoneName);
+            }
         }
         // 캐릭터 외 일반 물리 시뮬레이션 물체 처리
         else if (OtherComp && OtherComp->IsSimulatingPhysics())
@@ -285,9 +353,197 @@ void UBRAttackComponent::ProcessHitDamage(AActor* OtherActor, UPrimitiveComponen
             // 일반 프롭들도 멀티캐스트로 처리해야 완벽하지만, 기본적으로 Replicate Movement가 켜져 있다면 서버가 밀어냅니다.
             OtherComp->AddImpulseAtLocation(FinalImpulseVector, Hit.ImpactPoint, Hit.BoneName);
         }
+
+        if (UBRCombatEventSubsystem* CombatEvents = GetWorld()->GetSubsystem<UBRCombatEventSubsystem>())
+        {
+            CombatEvents->QueueEvent(CombatEvent);
+        }
     }
 
     HitActors.Add(OtherActor);
+    TotalHits++;
+}
+
+// =======================================================
+// Swept Trace 판정
+// =======================================================
+
+void UBRAttackComponent::BeginSweepWindow()
+{
+    ABaseCharacter* OwnerChar = Cast<ABaseCharacter>(GetOwner());
+    if (!OwnerChar) return;
+
+    SweepSources.Reset();
+    bSweepWithWeapon = OwnerChar->CurrentWeapon && OwnerChar->CurrentWeapon->WeaponMesh;
+    if (bSweepWithWeapon)
+    {
+        SweepSources.Add({ NAME_None, FTransform::Identity });
+    }
+    else
+    {
+        for (const FName& Bone : PunchSweepBones)
+        {
+            SweepSources.Add({ Bone, FTransform::Identity });
+        }
+    }
+
+    // 구간 시작 시점의 트랜스폼을 기준점으로 기록 (첫 틱부터 이전→현재 스윕 가능)
+    for (int32 i = SweepSources.Num() - 1; i >= 0; --i)
+    {
+        if (!GetSweepSourceTransform(SweepSources[i], SweepSources[i].PrevTransform))
+        {
+            ATK_LOG(Warning, TEXT("Sweep source '%s' not found. Skipped."), *SweepSources[i].BoneName.ToString());
+            SweepSources.RemoveAtSwap(i);
+        }
+    }
+
+    SetComponentTickEnabled(SweepSources.Num() > 0);
+}
+
+void UBRAttackComponent::EndSweepWindow()
+{
+    SetComponentTickEnabled(false);
+    SweepSources.Reset();
+}
+
+bool UBRAttackComponent::GetSweepSourceTransform(const FSweepSource& Source, FTransform& OutTransform) const
+{
+    const ABaseCharacter* OwnerChar = Cast<ABaseCharacter>(GetOwner());
+    if (!OwnerChar) return false;
+
+    if (Source.BoneName.IsNone())
+    {
+        const UStaticMeshComponent* WeaponMesh = OwnerChar->CurrentWeapon ? OwnerChar->CurrentWeapon->WeaponMesh : nullptr;
+        if (!WeaponMesh) return false;
+        OutTransform = WeaponMesh->GetComponentTransform();
+        return true;
+    }
+
+    const USkeletalMeshComponent* BodyMesh = OwnerChar->GetMesh();
+    if (!BodyMesh || !BodyMesh->DoesSocketExist(Source.BoneName)) return false;
+    OutTransform = BodyMesh->GetSocketTransform(Source.BoneName);
+    return true;
+}
+
+void UBRAttackComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (!bIsDetectionActive || HitDetectionMode != EBRHitDetectionMode::SweptTrace || !GetOwner()->HasAuthority())
+    {
+        EndSweepWindow();
+        return;
+    }
+
+    RunSweeps(DeltaTime);
+}
+
+void UBRAttackComponent::RunSweeps(float DeltaTime)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_AttackSweep);
+
+    ABaseCharacter* OwnerChar = Cast<ABaseCharacter>(GetOwner());
+    UWorld* World = GetWorld();
+    if (!OwnerChar || !World || DeltaTime <= KINDA_SMALL_NUMBER) return;
+
+    // 구간 도중 무기를 줍거나 잃으면 원점을 다시 잡고 다음 틱부터 스윕
+    const bool bHasWeapon = OwnerChar->CurrentWeapon && OwnerChar->CurrentWeapon->WeaponMesh;
+    if (bHasWeapon != bSweepWithWeapon)
+    {
+        BeginSweepWindow();
+        return;
+    }
+
+    // 스윕 형상: 무기 = 스태틱 메시 로컬 바운드 박스, 맨손 = 구
+    FCollisionShape Shape = FCollisionShape::MakeSphere(PunchSweepRadius);
+    FVector LocalShapeOffset = FVector::ZeroVector;
+    if (bSweepWithWeapon)
+    {
+        const UStaticMeshComponent* WeaponMesh = OwnerChar->CurrentWeapon->WeaponMesh;
+        const UStaticMesh* StaticMesh = WeaponMesh->GetStaticMesh();
+        if (!StaticMesh) return;
+        const FBoxSphereBounds LocalBounds = StaticMesh->GetBounds();
+        const FVector Scale = WeaponMesh->GetComponentScale().GetAbs();
+        Shape = FCollisionShape::MakeBox(LocalBounds.BoxExtent * Scale);
+        LocalShapeOffset = LocalBounds.Origin;
+    }
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BRAttackSweep), false, OwnerChar);
+    TArray<AActor*> AttachedActors;
+    OwnerChar->GetAttachedActors(AttachedActors);
+    QueryParams.AddIgnoredActors(AttachedActors);
+
+    FCollisionObjectQueryParams ObjectParams;
+    ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+    ObjectParams.AddObjectTypesToQuery(ECC_PhysicsBody);
+    ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+    // 물리 서브스텝 간격으로 이번 틱의 이동을 분할 (빠른 휘두르기에서 호를 따라가도록)
+    const UPhysicsSettings* PhysSettings = UPhysicsSettings::Get();
+    const float SubstepInterval = (PhysSettings && PhysSettings->bSubstepping) ? PhysSettings->MaxSubstepDeltaTime : DeltaTime;
+    const int32 NumSubsteps = FMath::Clamp(FMath::CeilToInt(DeltaTime / FMath::Max(SubstepInterval, KINDA_SMALL_NUMBER)), 1, MaxSweepSubsteps);
+    const float SubstepTime = DeltaTime / NumSubsteps;
+
+    // 이번 틱의 모든 스윕 결과를 액터당 1건으로 모음
+    struct FSweptHit
+    {
+        FHitResult Hit;
+        FVector Velocity;
+    };
+    TArray<FSweptHit, TInlineAllocator<8>> BatchedHits;
+    TArray<FHitResult, TInlineAllocator<16>> StepHits;
+
+    for (FSweepSource& Source : SweepSources)
+    {
+        FTransform CurrentTransform;
+        if (!GetSweepSourceTransform(Source, CurrentTransform)) continue;
+
+        for (int32 Step = 0; Step < NumSubsteps; ++Step)
+        {
+            FTransform From, To;
+            From.Blend(Source.PrevTransform, CurrentTransform, (float)Step / NumSubsteps);
+            To.Blend(Source.PrevTransform, CurrentTransform, (float)(Step + 1) / NumSubsteps);
+
+            const FVector Start = From.TransformPosition(LocalShapeOffset);
+            const FVector End = To.TransformPosition(LocalShapeOffset);
+            const FVector Velocity = (End - Start) / SubstepTime;
+
+            StepHits.Reset();
+            World->SweepMultiByObjectType(StepHits, Start, End, To.GetRotation(), ObjectParams, Shape, QueryParams);
+
+            for (const FHitResult& Hit : StepHits)
+            {
+                AActor* HitActor = Hit.GetActor();
+                if (!HitActor || HitActor == OwnerChar || HitActors.RejectDuplicate(HitActor)) continue;
+
+                FSweptHit* Existing = BatchedHits.FindByPredicate([HitActor](const FSweptHit& Entry) { return Entry.Hit.GetActor() == HitActor; });
+                if (!Existing)
+                {
+                    BatchedHits.Add({ Hit, Velocity });
+                    continue;
+                }
+
+                HitActors.NoteDuplicate();
+                if (Existing->Hit.BoneName.IsNone() && !Hit.BoneName.IsNone())
+                {
+                    // 캡슐보다 본(스켈레탈 메시) 결과를 우선 → 피격 리액션 부위가 정확해짐
+                    *Existing = { Hit, Velocity };
+                }
+            }
+        }
+
+        Source.PrevTransform = CurrentTransform;
+    }
+
+    // 모아둔 결과를 한 번에 처리 (스윕 속도 기반 충격량)
+    for (const FSweptHit& Swept : BatchedHits)
+    {
+        AActor* HitActor = Swept.Hit.GetActor();
+        if (!IsValid(HitActor) || HitActors.Contains(HitActor)) continue;
+
+        const float ImpactForce = FMath::Clamp(Swept.Velocity.Size() * SweepImpactMass, 0.0f, MaxImpactForce);
+        ApplyHit(HitActor, Swept.Hit.GetComponent(), ImpactForce, Swept.Velocity, Swept.Hit);
+    }
 }
 
 float UBRAttackComponent::GetCalculatedAttackSpeed() const
@@ -302,11 +558,11 @@ float UBRAttackComponent::GetCalculatedAttackSpeed() const
         float WeaponMass = OwnerChar->CurrentWeapon->CurrentWeaponData.MassKg;
         float MassRatio = (WeaponMass > 0.1f) ? (StandardMass / WeaponMass) : 1.0f;
         float WeaponSpeedCoeff = OwnerChar->CurrentWeapon->CurrentWeaponData.AttackSpeedCoefficient;
-        FinalSpeed = MassRatio * WeaponSpeedCoeff * ABaseWeapon::GlobalAttackSpeedMultiplier;
+        FinalSpeed = MassRatio * WeaponSpeedCoeff * CachedAttackSpeedMultiplier;
     }
     else
     {
-        FinalSpeed = ABaseWeapon::GlobalAttackSpeedMultiplier;
+        FinalSpeed = CachedAttackSpeedMultiplier;
     }
 
     return FMath::Clamp(FinalSpeed, 0.5f, 1.5f);
@@ -0,0 +1,60 @@
+// BRBalanceSnapshotCommandlet.cpp
+#include "BRBalanceSnapshotCommandlet.h"
+#include "BRConfigService.h"
+#include "BRGameInstance.h"
+#include "Engine/DataTable.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+UBRBalanceSnapshotCommandlet::UBRBalanceSnapshotCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBRBalanceSnapshotCommandlet::Main(const FString& Params)
+{
+	// 1. ConfigDataMap을 가진 게임 인스턴스 클래스 결정 (-GameInstance= > GameMapsSettings > 네이티브 기본값)
+	FString GameInstanceClassPath;
+	if (!FParse::Value(*Params, TEXT("GameInstance="), GameInstanceClassPath))
+	{
+		GConfig->GetString(TEXT("/Script/EngineSettings.GameMapsSettings"), TEXT("GameInstanceClass"), GameInstanceClassPath, GEngineIni);
+	}
+
+	UClass* GameInstanceClass = GameInstanceClassPath.IsEmpty() ? nullptr : LoadClass<UBRGameInstance>(nullptr, *GameInstanceClassPath);
+	if (!GameInstanceClass)
+	{
+		GameInstanceClass = UBRGameInstance::StaticClass();
+	}
+
+	const UBRGameInstance* GameInstanceCDO = GameInstanceClass->GetDefaultObject<UBRGameInstance>();
+	if (GameInstanceCDO->ConfigDataMap.Num() == 0)
+	{
+		UE_LOG(LogConfigService, Error, TEXT("%s의 ConfigDataMap이 비어 있습니다. -GameInstance=로 블루프린트 클래스를 지정하세요."), *GameInstanceClass->GetName());
+		return 1;
+	}
+
+	// 2. 에셋 원본을 건드리지 않도록 복제본에 JSON 적용 (적용 전 에셋 내용 해시를 함께 기록)
+	const FString ConfigDirectory = UBRConfigService::GetDefaultConfigDirectory();
+	TMap<FString, FBRSnapshotTableSource> Tables;
+	for (const TPair<FString, UDataTable*>& Elem : GameInstanceCDO->ConfigDataMap)
+	{
+		if (!Elem.Value) continue;
+
+		FBRSnapshotTableSource& Source = Tables.Add(Elem.Key);
+		Source.AssetHash = UBRConfigService::HashTableRows(Elem.Value);
+		Source.Table = DuplicateObject<UDataTable>(Elem.Value, GetTransientPackage());
+		const FString FilePath = ConfigDirectory + Elem.Key + TEXT(".json");
+		if (!UBRConfigService::ApplyJsonFileToTable(FilePath, Source.Table, &Source.ObjectTexts))
+		{
+			UE_LOG(LogConfigService, Warning, TEXT("[%s] JSON 없음/오류 → 에셋 값 그대로 스냅샷에 포함"), *Elem.Key);
+		}
+	}
+
+	// 3. 저장
+	const FString SnapshotPath = ConfigDirectory + UBRConfigService::SnapshotFileName;
+	return UBRConfigService::WriteSnapshot(SnapshotPath, ConfigDirectory, Tables) ? 0 : 1;
+}
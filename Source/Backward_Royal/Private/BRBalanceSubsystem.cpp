@@ -0,0 +1,72 @@
+// BRBalanceSubsystem.cpp
+#include "BRBalanceSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY(LogBalance);
+
+void UBRBalanceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 테이블 로드 전에도 구조체 기본값으로 읽을 수 있게 함
+	Current = MakeShared<const FBRBalanceSnapshot, ESPMode::ThreadSafe>();
+}
+
+UBRBalanceSubsystem* UBRBalanceSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UBRBalanceSubsystem>() : nullptr;
+}
+
+FBRBalanceSnapshotRef UBRBalanceSubsystem::GetSnapshot(const UObject* WorldContextObject)
+{
+	if (const UBRBalanceSubsystem* Balance = Get(WorldContextObject))
+	{
+		return Balance->GetSnapshot();
+	}
+
+	static const FBRBalanceSnapshotRef DefaultSnapshot = MakeShared<const FBRBalanceSnapshot, ESPMode::ThreadSafe>();
+	return DefaultSnapshot;
+}
+
+FBRBalanceSnapshotRef UBRBalanceSubsystem::GetSnapshot() const
+{
+	FReadScopeLock ReadLock(SnapshotLock);
+	return Current.ToSharedRef();
+}
+
+void UBRBalanceSubsystem::Publish(const FGlobalBalanceData& Data)
+{
+	TSharedRef<FBRBalanceSnapshot, ESPMode::ThreadSafe> NewSnapshot = MakeShared<FBRBalanceSnapshot, ESPMode::ThreadSafe>();
+	NewSnapshot->Version = GetSnapshot()->Version + 1;
+	NewSnapshot->Data = Data;
+	Swap(NewSnapshot);
+}
+
+void UBRBalanceSubsystem::AdoptReplicated(const FBRBalanceSnapshot& Snapshot)
+{
+	Swap(MakeShared<FBRBalanceSnapshot, ESPMode::ThreadSafe>(Snapshot));
+}
+
+void UBRBalanceSubsystem::Swap(TSharedRef<FBRBalanceSnapshot, ESPMode::ThreadSafe> NewSnapshot)
+{
+	NewSnapshot->Serial = NextSerial++;
+	{
+		FWriteScopeLock WriteLock(SnapshotLock);
+		Current = NewSnapshot;
+	}
+
+	const FGlobalBalanceData& Data = NewSnapshot->Data;
+	UE_LOG(LogBalance, Display, TEXT("밸런스 v%d 적용. Weapon: Damage(%.1f), Impulse(%.1f), AttackSpeed(%.1f), Durability(%.1f) / Stamina: Drain(%.1f), Jump(%.1f), Regen(%.1f)"),
+		NewSnapshot->Version,
+		Data.Global_Weapon_DamageMultiplier, Data.Global_Weapon_ImpulseMultiplier, Data.Global_Weapon_AttackSpeedMultiplier, Data.Global_Durability_Reduction,
+		Data.Global_Stamina_SprintDrainRate, Data.Global_Stamina_JumpCost, Data.Global_Stamina_RegenRate);
+	UE_LOG(LogBalance, Display, TEXT("밸런스 v%d 적용. PunchDamage(%.1f), Rotation(%.1f), Friction(%.1f), Deceleration(%.1f)"),
+		NewSnapshot->Version, Data.Global_BasePunchDamage,
+		Data.Global_Player_RotationRateYaw, Data.Global_Player_BrakingFriction, Data.Global_Player_BrakingDecelerationWalking);
+
+	OnBalanceChanged.Broadcast(*NewSnapshot);
+}
@@ -0,0 +1,26 @@
+// BRBenchmarkCsv.cpp
+#include "BRBenchmarkCsv.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+
+namespace BRBenchmarkCsv
+{
+	float Percentile(const TArray<float>& Sorted, float Fraction)
+	{
+		if (Sorted.Num() == 0) return 0.0f;
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Index];
+	}
+
+	bool AppendRow(const FString& FilePath, const TCHAR* Header, const FString& Row)
+	{
+		FString Contents;
+		if (!IFileManager::Get().FileExists(*FilePath))
+		{
+			Contents = FString(Header) + LINE_TERMINATOR;
+		}
+		Contents += Row + LINE_TERMINATOR;
+
+		return FFileHelper::SaveStringToFile(Contents, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+	}
+}
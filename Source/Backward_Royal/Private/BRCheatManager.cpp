@@ -3,6 +3,8 @@
 #include "BRPlayerController.h"
 #include "BRGameMode.h"
 #include "BRGameState.h"
+#include "BRAssetStreamingSubsystem.h"
+#include "BRCombatBenchmarkSubsystem.h"
 #include "GameFramework/GameModeBase.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
@@ -274,3 +276,49 @@ void UBRCheatManager::StatServer()
 		GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Cyan, Msg);
 }
 
+
+void UBRCheatManager::StatArmorStreaming()
+{
+	APlayerController* PC = GetPlayerController();
+	UGameInstance* GI = PC ? PC->GetGameInstance() : nullptr;
+	UBRAssetStreamingSubsystem* Streaming = GI ? GI->GetSubsystem<UBRAssetStreamingSubsystem>() : nullptr;
+	if (!Streaming)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[메모리] StatArmorStreaming: 스트리밍 서브시스템 없음"));
+		return;
+	}
+	Streaming->LogStreamingReport();
+
+	int32 NumAvoided = 0;
+	const float AvoidedMB = Streaming->GetAvoidedArmorMeshMB(&NumAvoided);
+	if (GEngine)
+		GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Cyan,
+			FString::Printf(TEXT("[메모리] 미로드 방어구 메시 %d개 | 약 %.2f MB 로드 회피"), NumAvoided, AvoidedMB));
+}
+
+void UBRCheatManager::BenchCombat(int32 NumPairs, float Seconds)
+{
+	APlayerController* PC = GetPlayerController();
+	UBRCombatBenchmarkSubsystem* Bench = PC ? UBRCombatBenchmarkSubsystem::Get(PC) : nullptr;
+	if (!Bench)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[성능] BenchCombat: 서버/스탠드얼론에서만 사용 가능"));
+		return;
+	}
+
+	// 실행 중에 다시 호출하면 중단하고 결과 기록
+	if (Bench->IsRunning())
+	{
+		Bench->StopBenchmark();
+		return;
+	}
+
+	FBRCombatBenchmarkSettings Settings;
+	Settings.NumPairs = NumPairs;
+	Settings.DurationSeconds = Seconds;
+	if (Bench->StartBenchmark(Settings) && GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Cyan,
+			FString::Printf(TEXT("[성능] 전투 벤치마크 %d쌍 / %.0f초 시작 → %s"), NumPairs, Seconds, *UBRCombatBenchmarkSubsystem::GetResultFilePath()));
+	}
+}
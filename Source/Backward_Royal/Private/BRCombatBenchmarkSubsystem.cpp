@@ -0,0 +1,490 @@
+// BRCombatBenchmarkSubsystem.cpp
+#include "BRCombatBenchmarkSubsystem.h"
+#include "CoreGlobals.h"
+#include "BaseCharacter.h"
+#include "BaseWeapon.h"
+#include "BRAttackComponent.h"
+#include "BRBenchmarkCsv.h"
+#include "BRActorRegistrySubsystem.h"
+#include "BRCombatEventSubsystem.h"
+#include "BRFracturePoolSubsystem.h"
+#include "BRGameInstance.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
+
+DEFINE_LOG_CATEGORY(LogCombatBench);
+
+namespace BRCombatBench
+{
+	static const TCHAR* CsvHeader = TEXT("Timestamp,Map,NetMode,Clients,Pairs,Seconds,Swings,Hits,HitsPerSec,")
+		TEXT("FrameMsP50,FrameMsP90,FrameMsP99,FrameMsMax,GameThreadMsP50,GameThreadMsP99,")
+		TEXT("AttackMulticasts,WeaponBreakMulticasts,CombatEventRPCs,CombatEvents,NetOutBytes,NetOutPackets,BytesPerHit,")
+		TEXT("FracturesSpawned,FracturesReused,FracturesRecycled");
+
+	static const TCHAR* NetModeToString(ENetMode NetMode)
+	{
+		switch (NetMode)
+		{
+		case NM_Standalone: return TEXT("Standalone");
+		case NM_DedicatedServer: return TEXT("DedicatedServer");
+		case NM_ListenServer: return TEXT("ListenServer");
+		default: return TEXT("Client");
+		}
+	}
+}
+
+bool UBRCombatBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer)) return false;
+
+	// 판정은 서버 권한에서만 일어남
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && World->GetNetMode() != NM_Client;
+}
+
+void UBRCombatBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	int32 NumPairs = 0;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("BRCombatBench="), NumPairs) || NumPairs <= 0) return;
+
+	FBRCombatBenchmarkSettings CommandLineSettings;
+	CommandLineSettings.NumPairs = NumPairs;
+	FParse::Value(FCommandLine::Get(), TEXT("BRCombatBenchSeconds="), CommandLineSettings.DurationSeconds);
+	CommandLineSettings.bQuitWhenDone = FParse::Param(FCommandLine::Get(), TEXT("BRCombatBenchQuit"));
+
+	FString ClassPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("BRCombatBenchClass="), ClassPath))
+	{
+		CommandLineSettings.CharacterClass = LoadClass<ABaseCharacter>(nullptr, *ClassPath);
+		if (!CommandLineSettings.CharacterClass)
+		{
+			UE_LOG(LogCombatBench, Warning, TEXT("캐릭터 클래스 로드 실패: %s (기본 클래스 사용)"), *ClassPath);
+		}
+	}
+
+	if (!StartBenchmark(CommandLineSettings) && CommandLineSettings.bQuitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("BRCombatBench"));
+	}
+}
+
+void UBRCombatBenchmarkSubsystem::Deinitialize()
+{
+	if (bRunning)
+	{
+		// 맵 이동 등으로 중단되면 그때까지의 결과만 기록
+		StopBenchmark();
+	}
+
+	Super::Deinitialize();
+}
+
+UBRCombatBenchmarkSubsystem* UBRCombatBenchmarkSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UBRCombatBenchmarkSubsystem>() : nullptr;
+}
+
+void UBRCombatBenchmarkSubsystem::CountAttackMulticast(const UObject* WorldContextObject)
+{
+	if (UBRCombatBenchmarkSubsystem* Bench = Get(WorldContextObject))
+	{
+		Bench->NumAttackMulticasts++;
+	}
+}
+
+void UBRCombatBenchmarkSubsystem::CountWeaponBreakMulticast(const UObject* WorldContextObject)
+{
+	if (UBRCombatBenchmarkSubsystem* Bench = Get(WorldContextObject))
+	{
+		Bench->NumWeaponBreakMulticasts++;
+	}
+}
+
+FString UBRCombatBenchmarkSubsystem::GetResultFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Benchmarks") / TEXT("CombatBench.csv");
+}
+
+bool UBRCombatBenchmarkSubsystem::StartBenchmark(const FBRCombatBenchmarkSettings& InSettings)
+{
+	if (bRunning)
+	{
+		UE_LOG(LogCombatBench, Warning, TEXT("이미 벤치마크 실행 중"));
+		return false;
+	}
+
+	Settings = InSettings;
+	Settings.NumPairs = FMath::Max(Settings.NumPairs, 1);
+	Settings.DurationSeconds = FMath::Max(Settings.DurationSeconds, 1.0f);
+	Settings.AttackInterval = FMath::Max(Settings.AttackInterval, 0.05f);
+
+	if (!SpawnPairs())
+	{
+		CleanupActors();
+		return false;
+	}
+
+	bRunning = true;
+	bMeasuring = false;
+	AttackTick = 0;
+
+	UWorld* World = GetWorld();
+	FTimerManager& TimerManager = World->GetTimerManager();
+	TimerManager.SetTimer(AttackTimerHandle, this, &UBRCombatBenchmarkSubsystem::DriveAttacks, Settings.AttackInterval, true);
+	TimerManager.SetTimer(PhaseTimerHandle, this, &UBRCombatBenchmarkSubsystem::BeginMeasure, FMath::Max(Settings.WarmupSeconds, 0.01f), false);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UBRCombatBenchmarkSubsystem::HandlePostActorTick);
+
+	UE_LOG(LogCombatBench, Log, TEXT("전투 벤치마크 시작: %d쌍, 워밍업 %.1f초 + 측정 %.1f초 (%s)"),
+		Pairs.Num(), Settings.WarmupSeconds, Settings.DurationSeconds, BRCombatBench::NetModeToString(World->GetNetMode()));
+	return true;
+}
+
+void UBRCombatBenchmarkSubsystem::StopBenchmark()
+{
+	if (!bRunning) return;
+
+	if (!bMeasuring)
+	{
+		// 워밍업 중 중단: 측정 구간이 없으므로 기록하지 않음
+		UE_LOG(LogCombatBench, Warning, TEXT("워밍업 중 중단되어 결과를 기록하지 않습니다."));
+	}
+
+	FinishBenchmark();
+}
+
+bool UBRCombatBenchmarkSubsystem::SpawnPairs()
+{
+	UWorld* World = GetWorld();
+
+	UClass* CharacterClass = Settings.CharacterClass.Get();
+	if (!CharacterClass)
+	{
+		const AGameModeBase* GameMode = World->GetAuthGameMode();
+		UClass* DefaultPawnClass = GameMode ? GameMode->DefaultPawnClass.Get() : nullptr;
+		CharacterClass = (DefaultPawnClass && DefaultPawnClass->IsChildOf(ABaseCharacter::StaticClass()))
+			? DefaultPawnClass : ABaseCharacter::StaticClass();
+	}
+
+	// 무기 행 목록 (없으면 맨손 쌍만 스폰)
+	TArray<FName> WeaponRows;
+	if (UBRGameInstance* GI = Cast<UBRGameInstance>(World->GetGameInstance()))
+	{
+		if (UDataTable** WeaponTablePtr = GI->ConfigDataMap.Find(TEXT("WeaponData")))
+		{
+			if (*WeaponTablePtr)
+			{
+				WeaponRows = (*WeaponTablePtr)->GetRowNames();
+			}
+		}
+	}
+	if (WeaponRows.Num() == 0)
+	{
+		UE_LOG(LogCombatBench, Warning, TEXT("WeaponData 테이블이 비어 있어 맨손으로만 진행합니다."));
+	}
+
+	// 기준 위치: 첫 PlayerStart (없으면 원점 위)
+	FVector Origin(0.0, 0.0, 200.0);
+	if (UBRActorRegistrySubsystem* Registry = UBRActorRegistrySubsystem::Get(World))
+	{
+		for (const APlayerStart* Start : Registry->GetPlayerStarts())
+		{
+			if (IsValid(Start))
+			{
+				Origin = Start->GetActorLocation();
+				break;
+			}
+		}
+	}
+
+	// 쌍을 정사각형 격자로 배치. 쌍 내부는 X축으로 마주 봄
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)Settings.NumPairs));
+	const FVector HalfOffset(Settings.FacingDistance * 0.5, 0.0, 0.0);
+
+	Pairs.Reset(Settings.NumPairs);
+	for (int32 Index = 0; Index < Settings.NumPairs; ++Index)
+	{
+		const FVector Center = Origin + FVector((Index % GridSize) * Settings.PairSpacing, (Index / GridSize) * Settings.PairSpacing, 0.0);
+
+		ABaseCharacter* A = SpawnCombatant(CharacterClass, Center - HalfOffset, FRotator(0.0, 0.0, 0.0));
+		ABaseCharacter* B = SpawnCombatant(CharacterClass, Center + HalfOffset, FRotator(0.0, 180.0, 0.0));
+		if (!A || !B)
+		{
+			UE_LOG(LogCombatBench, Error, TEXT("캐릭터 스폰 실패 (%s)"), *CharacterClass->GetName());
+			if (A) A->Destroy();
+			if (B) B->Destroy();
+			return false;
+		}
+
+		FBenchPair& Pair = Pairs.AddDefaulted_GetRef();
+		Pair.A = A;
+		Pair.B = B;
+		Pair.WeaponRow = WeaponRows.Num() > 0 ? WeaponRows[Index % WeaponRows.Num()] : NAME_None;
+
+		ArmCombatant(A, Pair.WeaponRow);
+		ArmCombatant(B, Pair.WeaponRow);
+	}
+
+	return Pairs.Num() > 0;
+}
+
+ABaseCharacter* UBRCombatBenchmarkSubsystem::SpawnCombatant(UClass* Class, const FVector& Location, const FRotator& Rotation) const
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ABaseCharacter* Character = GetWorld()->SpawnActor<ABaseCharacter>(Class, Location, Rotation, SpawnParams);
+	if (!Character) return nullptr;
+
+	// 화면이 없어도(-nullrhi) 몽타주 노티파이와 본 트랜스폼이 갱신되어야 판정이 일어남
+	if (USkeletalMeshComponent* Mesh = Character->GetMesh())
+	{
+		Mesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+	}
+	return Character;
+}
+
+void UBRCombatBenchmarkSubsystem::ArmCombatant(ABaseCharacter* Character, FName WeaponRow)
+{
+	if (!Character || WeaponRow.IsNone()) return;
+
+	UClass* WeaponClass = Settings.WeaponClass ? Settings.WeaponClass.Get() : ABaseWeapon::StaticClass();
+	const FTransform SpawnTransform = Character->GetActorTransform();
+
+	// BeginPlay의 LoadWeaponData가 행을 읽도록 스폰을 미뤄 행 이름을 먼저 지정
+	ABaseWeapon* Weapon = GetWorld()->SpawnActorDeferred<ABaseWeapon>(WeaponClass, SpawnTransform, nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Weapon) return;
+
+	Weapon->WeaponRowName = WeaponRow;
+	UGameplayStatics::FinishSpawningActor(Weapon, SpawnTransform);
+
+	Character->EquipWeapon(Weapon);
+	SpawnedWeapons.Add(Weapon);
+}
+
+void UBRCombatBenchmarkSubsystem::DriveAttacks()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_CombatBenchDrive);
+
+	const bool bAttackerIsA = (AttackTick++ % 2) == 0;
+	for (const FBenchPair& Pair : Pairs)
+	{
+		ABaseCharacter* A = Pair.A.Get();
+		ABaseCharacter* B = Pair.B.Get();
+		if (!A || !B) continue;
+
+		for (ABaseCharacter* Character : { A, B })
+		{
+			// 사망/기절로 쌍이 멈추지 않도록 HP 유지, 부서진 무기는 같은 행으로 재지급
+			Character->CurrentHP = Character->MaxHP;
+			if (!Character->CurrentWeapon)
+			{
+				ArmCombatant(Character, Pair.WeaponRow);
+			}
+		}
+
+		(bAttackerIsA ? A : B)->RequestAttack();
+	}
+}
+
+void UBRCombatBenchmarkSubsystem::BeginMeasure()
+{
+	MeasureBegin = CaptureCounters();
+	FrameTimesMs.Reset();
+	GameThreadTimesMs.Reset();
+	bMeasuring = true;
+
+	GetWorld()->GetTimerManager().SetTimer(PhaseTimerHandle, this, &UBRCombatBenchmarkSubsystem::FinishBenchmark, Settings.DurationSeconds, false);
+}
+
+void UBRCombatBenchmarkSubsystem::HandlePostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld() || !bMeasuring) return;
+
+	// 실제 경과 시간 기준 (월드 시간 배율 / 히트 스탑 영향 배제)
+	FrameTimesMs.Add((float)(FApp::GetDeltaTime() * 1000.0));
+	GameThreadTimesMs.Add((float)FPlatformTime::ToMilliseconds(GGameThreadTime));
+}
+
+UBRCombatBenchmarkSubsystem::FCounterSnapshot UBRCombatBenchmarkSubsystem::CaptureCounters() const
+{
+	FCounterSnapshot Snapshot;
+	Snapshot.Time = FPlatformTime::Seconds();
+
+	for (const FBenchPair& Pair : Pairs)
+	{
+		for (const TWeakObjectPtr<ABaseCharacter>& WeakCharacter : { Pair.A, Pair.B })
+		{
+			const ABaseCharacter* Character = WeakCharacter.Get();
+			if (Character && Character->AttackComponent)
+			{
+				Snapshot.Hits += Character->AttackComponent->GetTotalHits();
+				Snapshot.Swings += Character->AttackComponent->GetTotalSwings();
+			}
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (const UBRCombatEventSubsystem* CombatEvents = World->GetSubsystem<UBRCombatEventSubsystem>())
+	{
+		Snapshot.CombatEvents = CombatEvents->GetNumEventsSent();
+		Snapshot.CombatEventFlushes = CombatEvents->GetNumFlushes();
+	}
+	Snapshot.AttackMulticasts = NumAttackMulticasts;
+	Snapshot.WeaponBreakMulticasts = NumWeaponBreakMulticasts;
+
+	// 스탠드얼론에는 넷 드라이버가 없어 송신량 0
+	if (const UNetDriver* NetDriver = World->GetNetDriver())
+	{
+		Snapshot.NetOutBytes = NetDriver->OutTotalBytes;
+		Snapshot.NetOutPackets = NetDriver->OutTotalPackets;
+	}
+
+	// 전용 서버에는 파편 풀이 없음 (연출 전용) → 결과에서 파편 열을 비움
+	if (const UBRFracturePoolSubsystem* FracturePool = UBRFracturePoolSubsystem::Get(World))
+	{
+		Snapshot.bHasFracturePool = true;
+		Snapshot.FracturesSpawned = FracturePool->GetNumSpawned();
+		Snapshot.FracturesReused = FracturePool->GetNumReused();
+		Snapshot.FracturesRecycled = FracturePool->GetNumRecycled();
+	}
+
+	return Snapshot;
+}
+
+void UBRCombatBenchmarkSubsystem::FinishBenchmark()
+{
+	if (!bRunning) return;
+
+	UWorld* World = GetWorld();
+	if (bMeasuring)
+	{
+		WriteResult(MeasureBegin, CaptureCounters());
+	}
+
+	bRunning = false;
+	bMeasuring = false;
+
+	if (World)
+	{
+		World->GetTimerManager().ClearTimer(AttackTimerHandle);
+		World->GetTimerManager().ClearTimer(PhaseTimerHandle);
+	}
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PostActorTickHandle.Reset();
+
+	// 월드 정리 중이면 액터는 월드와 함께 사라지므로 참조만 해제
+	if (World && !World->bIsTearingDown)
+	{
+		CleanupActors();
+	}
+	Pairs.Empty();
+	SpawnedWeapons.Empty();
+	FrameTimesMs.Empty();
+	GameThreadTimesMs.Empty();
+
+	if (Settings.bQuitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("BRCombatBench"));
+	}
+}
+
+void UBRCombatBenchmarkSubsystem::WriteResult(const FCounterSnapshot& Begin, const FCounterSnapshot& End) const
+{
+	const double Seconds = FMath::Max(End.Time - Begin.Time, UE_DOUBLE_SMALL_NUMBER);
+	const int64 Hits = End.Hits - Begin.Hits;
+	const int64 Swings = End.Swings - Begin.Swings;
+	const int64 CombatEventFlushes = End.CombatEventFlushes - Begin.CombatEventFlushes;
+	const int64 NetOutBytes = End.NetOutBytes - Begin.NetOutBytes;
+
+	TArray<float> SortedFrames = FrameTimesMs;
+	TArray<float> SortedGameThread = GameThreadTimesMs;
+	SortedFrames.Sort();
+	SortedGameThread.Sort();
+
+	UWorld* World = GetWorld();
+	const int32 NumClients = (World->GetNetDriver()) ? World->GetNetDriver()->ClientConnections.Num() : 0;
+
+	// 파편 풀이 없는 전용 서버에서는 0이 아니라 빈 값 (측정 불가)
+	const FString FractureColumns = End.bHasFracturePool
+		? FString::Printf(TEXT("%lld,%lld,%lld"),
+			End.FracturesSpawned - Begin.FracturesSpawned,
+			End.FracturesReused - Begin.FracturesReused,
+			End.FracturesRecycled - Begin.FracturesRecycled)
+		: FString(TEXT(",,"));
+
+	// 멀티캐스트 수는 서버 송신 지점에서 센 값, 타격 연출은 프레임당 묶음 1회(CombatEventRPCs)
+	const FString Row = FString::Printf(TEXT("%s,%s,%s,%d,%d,%.2f,%lld,%lld,%.2f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%lld,%lld,%lld,%lld,%lld,%lld,%.1f,%s"),
+		*FDateTime::UtcNow().ToIso8601(),
+		*UGameplayStatics::GetCurrentLevelName(World, true),
+		BRCombatBench::NetModeToString(World->GetNetMode()),
+		NumClients,
+		Pairs.Num(),
+		Seconds,
+		Swings,
+		Hits,
+		Hits / Seconds,
+		BRBenchmarkCsv::Percentile(SortedFrames, 0.5f),
+		BRBenchmarkCsv::Percentile(SortedFrames, 0.9f),
+		BRBenchmarkCsv::Percentile(SortedFrames, 0.99f),
+		SortedFrames.Num() > 0 ? SortedFrames.Last() : 0.0f,
+		BRBenchmarkCsv::Percentile(SortedGameThread, 0.5f),
+		BRBenchmarkCsv::Percentile(SortedGameThread, 0.99f),
+		End.AttackMulticasts - Begin.AttackMulticasts,
+		End.WeaponBreakMulticasts - Begin.WeaponBreakMulticasts,
+		CombatEventFlushes,
+		End.CombatEvents - Begin.CombatEvents,
+		NetOutBytes,
+		End.NetOutPackets - Begin.NetOutPackets,
+		Hits > 0 ? (double)NetOutBytes / Hits : 0.0,
+		*FractureColumns);
+
+	const FString FilePath = GetResultFilePath();
+	if (BRBenchmarkCsv::AppendRow(FilePath, BRCombatBench::CsvHeader, Row))
+	{
+		UE_LOG(LogCombatBench, Log, TEXT("전투 벤치마크 결과 (%s): %s"), *FilePath, *Row);
+	}
+	else
+	{
+		UE_LOG(LogCombatBench, Error, TEXT("결과 기록 실패: %s"), *FilePath);
+	}
+
+	UE_LOG(LogCombatBench, Log, TEXT("%d쌍 %.1f초: 타격 %lld (%.1f/s), 프레임 p50 %.2fms / p99 %.2fms, 무기 파손 멀티캐스트 %lld"),
+		Pairs.Num(), Seconds, Hits, Hits / Seconds,
+		BRBenchmarkCsv::Percentile(SortedFrames, 0.5f), BRBenchmarkCsv::Percentile(SortedFrames, 0.99f),
+		End.WeaponBreakMulticasts - Begin.WeaponBreakMulticasts);
+}
+
+void UBRCombatBenchmarkSubsystem::CleanupActors()
+{
+	for (const TWeakObjectPtr<ABaseWeapon>& Weapon : SpawnedWeapons)
+	{
+		if (Weapon.IsValid())
+		{
+			Weapon->Destroy();
+		}
+	}
+	SpawnedWeapons.Empty();
+
+	for (const FBenchPair& Pair : Pairs)
+	{
+		if (Pair.A.IsValid()) Pair.A->Destroy();
+		if (Pair.B.IsValid()) Pair.B->Destroy();
+	}
+	Pairs.Empty();
+}
@@ -0,0 +1,140 @@
+// BRCombatEventSubsystem.cpp
+#include "BRCombatEventSubsystem.h"
+#include "BRGameState.h"
+#include "BRAttackComponent.h"
+#include "BaseCharacter.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "UObject/CoreNet.h"
+#include "Kismet/GameplayStatics.h"
+#include "Sound/SoundBase.h"
+
+DEFINE_LOG_CATEGORY(LogCombatEvent);
+
+// ========== FBRCombatEvent ==========
+
+template<typename T>
+static void SerializeObjectRef(FArchive& Ar, UPackageMap* Map, TObjectPtr<T>& Ref)
+{
+	UObject* Obj = Ref;
+	Map->SerializeObject(Ar, T::StaticClass(), Obj);
+	if (Ar.IsLoading())
+	{
+		Ref = Cast<T>(Obj);
+	}
+}
+
+bool FBRCombatEvent::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	if (!Map)
+	{
+		bOutSuccess = false;
+		return false;
+	}
+
+	SerializeObjectRef(Ar, Map, Attacker);
+	SerializeObjectRef(Ar, Map, Victim);
+	SerializeObjectRef(Ar, Map, Sound);
+
+	bool bLocationOk = true;
+	bool bImpulseOk = true;
+	HitLocation.NetSerialize(Ar, Map, bLocationOk);
+	Impulse.NetSerialize(Ar, Map, bImpulseOk);
+
+	Ar << BoneIndex;
+	Ar << HitStopCentiseconds;
+
+	bOutSuccess = bLocationOk && bImpulseOk;
+	return true;
+}
+
+// ========== UBRCombatEventSubsystem ==========
+
+void UBRCombatEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UBRCombatEventSubsystem::HandlePostActorTick);
+}
+
+void UBRCombatEventSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PostActorTickHandle.Reset();
+	PendingEvents.Empty();
+	Super::Deinitialize();
+}
+
+void UBRCombatEventSubsystem::QueueEvent(const FBRCombatEvent& Event)
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client) return;
+
+	PendingEvents.Add(Event);
+}
+
+void UBRCombatEventSubsystem::HandlePostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	// 액터 틱(타격 판정)이 모두 끝난 뒤, 같은 프레임의 네트워크 전송 전에 1회 전송
+	if (InWorld == GetWorld() && PendingEvents.Num() > 0)
+	{
+		Flush();
+	}
+}
+
+void UBRCombatEventSubsystem::Flush()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_CombatEventFlush);
+
+	const int32 NumToSend = FMath::Min(PendingEvents.Num(), MaxEventsPerFlush);
+	TArray<FBRCombatEvent> Batch(PendingEvents.GetData(), NumToSend);
+	PendingEvents.RemoveAt(0, NumToSend, EAllowShrinking::No);
+
+	if (ABRGameState* GS = GetWorld()->GetGameState<ABRGameState>())
+	{
+		// GameState는 항상 relevant → 모든 클라이언트에 한 번에 전달 (서버 자신도 멀티캐스트로 실행)
+		GS->MulticastCombatEvents(Batch);
+	}
+	else
+	{
+		// BRGameState가 없는 맵(단독 테스트 등): 서버에서만 바로 재생
+		for (const FBRCombatEvent& Event : Batch)
+		{
+			PlayEvent(this, Event);
+		}
+	}
+
+	NumEventsSent += NumToSend;
+	NumFlushes++;
+	UE_LOG(LogCombatEvent, Verbose, TEXT("Flush: %d events (pending %d, total %d events / %d flushes)"),
+		NumToSend, PendingEvents.Num(), NumEventsSent, NumFlushes);
+}
+
+void UBRCombatEventSubsystem::PlayEvent(const UObject* WorldContextObject, const FBRCombatEvent& Event)
+{
+	// 1. 타격음
+	if (Event.Sound)
+	{
+		UGameplayStatics::PlaySoundAtLocation(WorldContextObject, Event.Sound, Event.HitLocation, 1.0f);
+	}
+
+	// 2. 공격자 히트 스탑 (0.1초 멈춤 -> 이후 애니메이션 종료)
+	if (Event.HitStopCentiseconds > 0)
+	{
+		ABaseCharacter* AttackerChar = Cast<ABaseCharacter>(Event.Attacker);
+		if (AttackerChar && AttackerChar->AttackComponent)
+		{
+			AttackerChar->AttackComponent->ApplyHitStop(Event.GetHitStopDuration());
+		}
+	}
+
+	// 3. 피격자 피지컬 애니메이션 흔들림
+	if (ABaseCharacter* VictimChar = Cast<ABaseCharacter>(Event.Victim))
+	{
+		FName BoneName = NAME_None;
+		if (Event.BoneIndex != INDEX_NONE && VictimChar->GetMesh())
+		{
+			BoneName = VictimChar->GetMesh()->GetBoneName(Event.BoneIndex);
+		}
+		VictimChar->PlayPhysicalHitReaction(Event.Impulse, Event.HitLocation, BoneName);
+	}
+}
@@ -0,0 +1,785 @@
+// BRConfigService.cpp
+#include "BRConfigService.h"
+#include "BRGameInstance.h"
+#include "BRArmorCatalogSubsystem.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "Dom/JsonObject.h"
+#include "Engine/DataTable.h"
+#include "Hash/CityHash.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/UnrealType.h"
+
+DEFINE_LOG_CATEGORY(LogConfigService);
+
+// ========== 워커 스레드용 데이터 ==========
+
+/** 행 구조체 1개 분량의 메모리 (워커에서 생성, 게임 스레드에서 복사 후 해제) */
+struct FBRRowBuffer
+{
+	const UScriptStruct* Struct = nullptr;
+	uint8* Memory = nullptr;
+
+	explicit FBRRowBuffer(const UScriptStruct* InStruct)
+		: Struct(InStruct)
+	{
+		Memory = (uint8*)FMemory::Malloc(Struct->GetStructureSize(), Struct->GetMinAlignment());
+		Struct->InitializeStruct(Memory);
+	}
+
+	~FBRRowBuffer()
+	{
+		Struct->DestroyStruct(Memory);
+		FMemory::Free(Memory);
+	}
+
+	FBRRowBuffer(const FBRRowBuffer&) = delete;
+	FBRRowBuffer& operator=(const FBRRowBuffer&) = delete;
+};
+
+/** 파일 하나에 대한 파싱 작업 (게임 스레드에서 생성) */
+struct FBRConfigParseJob
+{
+	FString Key;
+	FString FilePath;
+	const UScriptStruct* RowStruct = nullptr;
+
+	/** 현재 DataTable 행 복사본. JSON에 없는 필드는 기존 값을 유지하기 위한 바탕 */
+	TMap<FName, TSharedPtr<FBRRowBuffer>> BaseRows;
+
+	/** 행별 마지막 반영 오브젝트 참조 문자열 */
+	TMap<FName, FString> LastObjectTexts;
+
+	uint64 KnownHash = 0;
+	bool bForce = false;
+};
+
+/** 변경된 행 1개 */
+struct FBRStagedRow
+{
+	FName RowName;
+	TSharedPtr<FBRRowBuffer> Data;
+
+	/** 커밋 시 게임 스레드에서 ImportText할 하드 오브젝트 참조 필드 */
+	TArray<TPair<const FProperty*, FString>> DeferredObjectFields;
+	FString ObjectTextKey;
+};
+
+/** 파일 하나의 파싱 결과 */
+struct FBRConfigParseResult
+{
+	FString Key;
+	uint64 ContentHash = 0;
+	bool bReadOk = false;
+	bool bUnchanged = false;
+	int32 NumRowsParsed = 0;
+	double ParseSeconds = 0.0;
+	TArray<FBRStagedRow> ChangedRows;
+};
+
+namespace BRConfigService
+{
+	/** 로드(StaticLoadObject)가 필요해 워커에서 변환할 수 없는 필드 */
+	static bool IsDeferredProperty(const FProperty* Property)
+	{
+		return CastField<FObjectProperty>(Property) != nullptr;
+	}
+
+	/** [워커 스레드] 파일 읽기 → 해시 비교 → 파싱 → 기존 행과 비교해 바뀐 행만 스테이징 */
+	static FBRConfigParseResult ParseConfigFile(const FBRConfigParseJob& Job)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		FBRConfigParseResult Result;
+		Result.Key = Job.Key;
+
+		TArray<uint8> FileBytes;
+		if (!FFileHelper::LoadFileToArray(FileBytes, *Job.FilePath, FILEREAD_Silent))
+		{
+			return Result;
+		}
+		Result.bReadOk = true;
+		Result.ContentHash = UBRConfigService::HashConfigBytes(FileBytes);
+
+		if (!Job.bForce && Result.ContentHash == Job.KnownHash)
+		{
+			Result.bUnchanged = true;
+			return Result;
+		}
+
+		FString JsonString;
+		FFileHelper::BufferToString(JsonString, FileBytes.GetData(), FileBytes.Num());
+
+		TSharedPtr<FJsonObject> RootObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+		const TArray<TSharedPtr<FJsonValue>>* DataArray = nullptr;
+		if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid()
+			|| !RootObject->TryGetArrayField(TEXT("Data"), DataArray))
+		{
+			UE_LOG(LogConfigService, Warning, TEXT("[%s] JSON 파싱 실패 또는 Data 배열 없음"), *Job.Key);
+			return Result;
+		}
+
+		// 지연 해석 대상 필드 목록 (행 구조체 기준, 파일당 1회)
+		TArray<const FProperty*> DeferredProperties;
+		for (TFieldIterator<FProperty> It(Job.RowStruct); It; ++It)
+		{
+			if (IsDeferredProperty(*It))
+			{
+				DeferredProperties.Add(*It);
+			}
+		}
+
+		for (const TSharedPtr<FJsonValue>& Value : *DataArray)
+		{
+			TSharedPtr<FJsonObject> DataObj = Value.IsValid() ? Value->AsObject() : nullptr;
+			if (!DataObj.IsValid()) continue;
+
+			const FString NameStr = DataObj->GetStringField(TEXT("Name"));
+			if (NameStr.IsEmpty()) continue;
+
+			FBRStagedRow Staged;
+			Staged.RowName = FName(*NameStr);
+			Result.NumRowsParsed++;
+
+			// 1. 하드 오브젝트 참조 필드는 문자열만 떼어 둠
+			for (const FProperty* Property : DeferredProperties)
+			{
+				const FString PropertyName = Property->GetName();
+				for (auto FieldIt = DataObj->Values.CreateIterator(); FieldIt; ++FieldIt)
+				{
+					if (!FieldIt.Key().Equals(PropertyName, ESearchCase::IgnoreCase)) continue;
+
+					FString Text;
+					if (FieldIt.Value().IsValid() && FieldIt.Value()->TryGetString(Text))
+					{
+						Staged.ObjectTextKey += PropertyName + TEXT("=") + Text + TEXT(";");
+						Staged.DeferredObjectFields.Emplace(Property, MoveTemp(Text));
+					}
+					FieldIt.RemoveCurrent();
+					break;
+				}
+			}
+
+			// 2. 기존 행 복사본 위에 JSON 필드만 덮어씀
+			const TSharedPtr<FBRRowBuffer>* BaseRow = Job.BaseRows.Find(Staged.RowName);
+			Staged.Data = MakeShared<FBRRowBuffer>(Job.RowStruct);
+			if (BaseRow)
+			{
+				Job.RowStruct->CopyScriptStruct(Staged.Data->Memory, (*BaseRow)->Memory);
+			}
+			FJsonObjectConverter::JsonObjectToUStruct(DataObj.ToSharedRef(), Job.RowStruct, Staged.Data->Memory);
+
+			// 3. 바뀐 행만 커밋 대상으로
+			const FString* LastObjectText = Job.LastObjectTexts.Find(Staged.RowName);
+			const bool bObjectFieldsChanged = Staged.ObjectTextKey != (LastObjectText ? *LastObjectText : FString());
+			const bool bChanged = !BaseRow
+				|| bObjectFieldsChanged
+				|| !Job.RowStruct->CompareScriptStruct((*BaseRow)->Memory, Staged.Data->Memory, PPF_None);
+
+			if (bChanged)
+			{
+				Result.ChangedRows.Add(MoveTemp(Staged));
+			}
+		}
+
+		Result.ParseSeconds = FPlatformTime::Seconds() - StartTime;
+		return Result;
+	}
+
+	/** [게임 스레드] 파싱 작업 생성. 워커가 DataTable을 직접 읽지 않도록 현재 행을 복사해 넘김 */
+	static bool BuildJobForTable(const FString& Key, const FString& FilePath, UDataTable* Table, bool bForce, const FBRConfigFileState* State, FBRConfigParseJob& OutJob)
+	{
+		if (!Table || !Table->GetRowStruct()) return false;
+
+		OutJob.Key = Key;
+		OutJob.FilePath = FilePath;
+		OutJob.RowStruct = Table->GetRowStruct();
+		OutJob.bForce = bForce;
+
+		if (State)
+		{
+			OutJob.KnownHash = State->ContentHash;
+			OutJob.LastObjectTexts = State->ObjectTexts;
+		}
+
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			TSharedPtr<FBRRowBuffer> Copy = MakeShared<FBRRowBuffer>(OutJob.RowStruct);
+			OutJob.RowStruct->CopyScriptStruct(Copy->Memory, Row.Value);
+			OutJob.BaseRows.Add(Row.Key, MoveTemp(Copy));
+		}
+		return true;
+	}
+
+	/** [게임 스레드] 스테이징된 행 1개를 테이블에 복사 (없으면 추가) 후 오브젝트 참조 해석 */
+	static void ApplyStagedRow(UDataTable* Table, const FBRStagedRow& Staged)
+	{
+		const UScriptStruct* RowStruct = Table->GetRowStruct();
+		uint8* RowPtr = Table->FindRowUnchecked(Staged.RowName);
+		if (RowPtr)
+		{
+			RowStruct->CopyScriptStruct(RowPtr, Staged.Data->Memory);
+		}
+		else
+		{
+			Table->AddRow(Staged.RowName, *(const FTableRowBase*)Staged.Data->Memory);
+			RowPtr = Table->FindRowUnchecked(Staged.RowName);
+		}
+
+		if (RowPtr)
+		{
+			for (const TPair<const FProperty*, FString>& Field : Staged.DeferredObjectFields)
+			{
+				Field.Key->ImportText_InContainer(*Field.Value, RowPtr, Table, PPF_None);
+			}
+		}
+	}
+
+	/** 스냅샷 행 직렬화 (태그 방식: 필드 추가/삭제에 안전, 이름·오브젝트 참조는 문자열로 저장) */
+	static void SerializeRow(FArchive& Ar, const UScriptStruct* RowStruct, uint8* RowData)
+	{
+		FObjectAndNameAsStringProxyArchive ProxyAr(Ar, /*bInLoadIfFindFails*/ true);
+		const_cast<UScriptStruct*>(RowStruct)->SerializeItem(ProxyAr, RowData, nullptr);
+	}
+}
+
+// ========== UBRConfigService ==========
+
+void UBRConfigService::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ConfigDirectory = GetDefaultConfigDirectory();
+	UE_LOG(LogConfigService, Log, TEXT("Config Directory: %s (Exists: %s)"), *ConfigDirectory,
+		FPlatformFileManager::Get().GetPlatformFile().DirectoryExists(*ConfigDirectory) ? TEXT("Yes") : TEXT("No"));
+
+	WatchTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UBRConfigService::HandleWatchTick), WatchIntervalSeconds);
+}
+
+void UBRConfigService::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(WatchTickerHandle);
+	WatchTickerHandle.Reset();
+	FileStates.Empty();
+
+	Super::Deinitialize();
+}
+
+FString UBRConfigService::GetDefaultConfigDirectory()
+{
+	// FPaths::ProjectDir()는 에디터에서는 .uproject가 있는 프로젝트 루트,
+	// 패키징 빌드에서는 exe의 상위 디렉토리를 반환하므로 두 환경 모두에서 사용 가능.
+	return FPaths::ProjectDir() / TEXT("Data/");
+}
+
+FString UBRConfigService::GetConfigFilePath(const FString& Key) const
+{
+	return ConfigDirectory + Key + TEXT(".json");
+}
+
+uint64 UBRConfigService::HashConfigBytes(TConstArrayView<uint8> Bytes)
+{
+	return CityHash64((const char*)Bytes.GetData(), Bytes.Num());
+}
+
+uint64 UBRConfigService::HashConfigFile(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	return FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent) ? HashConfigBytes(Bytes) : 0;
+}
+
+uint64 UBRConfigService::HashRowStruct(const UScriptStruct* RowStruct)
+{
+	// 필드 이름/타입/오프셋이 하나라도 바뀌면 다른 해시 → 스냅샷 무효
+	uint64 Hash = CityHash64(TCHAR_TO_UTF8(*RowStruct->GetPathName()), RowStruct->GetPathName().Len());
+	for (TFieldIterator<FProperty> It(RowStruct); It; ++It)
+	{
+		const FString Signature = FString::Printf(TEXT("%s:%s:%d:%d"), *It->GetName(), *It->GetCPPType(), It->GetOffset_ForInternal(), It->GetSize());
+		const FTCHARToUTF8 Utf8(*Signature);
+		Hash = CityHash64WithSeed(Utf8.Get(), Utf8.Length(), Hash);
+	}
+	return Hash;
+}
+
+uint64 UBRConfigService::HashTableRows(const UDataTable* Table)
+{
+	const UScriptStruct* RowStruct = Table ? Table->GetRowStruct() : nullptr;
+	if (!RowStruct) return 0;
+
+	uint64 Hash = 0;
+	TArray<uint8> RowBytes;
+	for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+	{
+		FString RowName = Row.Key.ToString();
+		RowBytes.Reset();
+		FMemoryWriter RowWriter(RowBytes);
+		RowWriter << RowName;
+		BRConfigService::SerializeRow(RowWriter, RowStruct, Row.Value);
+		Hash = CityHash64WithSeed((const char*)RowBytes.GetData(), RowBytes.Num(), Hash);
+	}
+	return Hash;
+}
+
+bool UBRConfigService::ApplyJsonFileToTable(const FString& FilePath, UDataTable* Table, TMap<FName, FString>* OutObjectTexts)
+{
+	FBRConfigParseJob Job;
+	if (!BRConfigService::BuildJobForTable(FPaths::GetBaseFilename(FilePath), FilePath, Table, true, nullptr, Job)) return false;
+
+	const FBRConfigParseResult Result = BRConfigService::ParseConfigFile(Job);
+	for (const FBRStagedRow& Staged : Result.ChangedRows)
+	{
+		BRConfigService::ApplyStagedRow(Table, Staged);
+		if (OutObjectTexts)
+		{
+			OutObjectTexts->Add(Staged.RowName, Staged.ObjectTextKey);
+		}
+	}
+	return Result.bReadOk;
+}
+
+bool UBRConfigService::WriteSnapshot(const FString& SnapshotPath, const FString& InConfigDirectory, const TMap<FString, FBRSnapshotTableSource>& Tables)
+{
+	TArray<uint8> Buffer;
+	FMemoryWriter Writer(Buffer);
+
+	uint32 Magic = SnapshotMagic;
+	int32 Version = SnapshotVersion;
+	uint64 CombinedHash = 0;
+	int32 NumTables = 0;
+	Writer << Magic << Version;
+	const int64 CombinedHashOffset = Writer.Tell();
+	Writer << CombinedHash << NumTables;
+
+	for (const TPair<FString, FBRSnapshotTableSource>& Elem : Tables)
+	{
+		UDataTable* Table = Elem.Value.Table;
+		const UScriptStruct* RowStruct = Table ? Table->GetRowStruct() : nullptr;
+		if (!RowStruct) continue;
+
+		FString Key = Elem.Key;
+		FString StructPath = RowStruct->GetPathName();
+		uint64 SchemaHash = HashRowStruct(RowStruct);
+		uint64 FileHash = HashConfigFile(InConfigDirectory + Key + TEXT(".json"));
+		uint64 AssetHash = Elem.Value.AssetHash;
+		int32 NumRows = Table->GetRowMap().Num();
+		Writer << Key << StructPath << SchemaHash << FileHash << AssetHash << NumRows;
+
+		TMap<FString, FString> ObjectTexts;
+		for (const TPair<FName, FString>& ObjectText : Elem.Value.ObjectTexts)
+		{
+			ObjectTexts.Add(ObjectText.Key.ToString(), ObjectText.Value);
+		}
+		Writer << ObjectTexts;
+
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			// 행마다 크기를 앞에 붙여 검증 단계에서 역직렬화 없이 건너뛸 수 있게 함
+			TArray<uint8> RowBytes;
+			FMemoryWriter RowWriter(RowBytes);
+			BRConfigService::SerializeRow(RowWriter, RowStruct, Row.Value);
+
+			FString RowName = Row.Key.ToString();
+			int32 RowSize = RowBytes.Num();
+			Writer << RowName << RowSize;
+			Writer.Serialize(RowBytes.GetData(), RowSize);
+		}
+
+		CombinedHash = CityHash64WithSeed((const char*)&FileHash, sizeof(FileHash), CombinedHash ^ SchemaHash ^ AssetHash);
+		NumTables++;
+	}
+
+	Writer.Seek(CombinedHashOffset);
+	Writer << CombinedHash << NumTables;
+
+	if (!FFileHelper::SaveArrayToFile(Buffer, *SnapshotPath))
+	{
+		UE_LOG(LogConfigService, Error, TEXT("스냅샷 저장 실패: %s"), *SnapshotPath);
+		return false;
+	}
+
+	UE_LOG(LogConfigService, Display, TEXT("스냅샷 저장: %s (v%d, 테이블 %d개, %d bytes, content hash %016llx)"),
+		*SnapshotPath, Version, NumTables, Buffer.Num(), CombinedHash);
+	return true;
+}
+
+bool UBRConfigService::TryLoadSnapshot(const TMap<FString, UDataTable*>& ConfigDataMap, TArray<FString>& OutLoadedKeys)
+{
+	const FString SnapshotPath = ConfigDirectory + SnapshotFileName;
+
+	// 메모리 매핑 (지원하지 않는 플랫폼이면 파일 전체 읽기)
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IMappedFileHandle> MappedHandle(PlatformFile.OpenMapped(*SnapshotPath));
+	TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle ? MappedHandle->MapRegion(0, MappedHandle->GetFileSize()) : nullptr);
+
+	TArray<uint8> FallbackBytes;
+	TConstArrayView<uint8> SnapshotView;
+	if (MappedRegion)
+	{
+		SnapshotView = TConstArrayView<uint8>(MappedRegion->GetMappedPtr(), (int32)MappedRegion->GetMappedSize());
+	}
+	else if (FFileHelper::LoadFileToArray(FallbackBytes, *SnapshotPath, FILEREAD_Silent))
+	{
+		SnapshotView = FallbackBytes;
+	}
+	else
+	{
+		UE_LOG(LogConfigService, Log, TEXT("스냅샷 없음 → JSON 로드"));
+		return false;
+	}
+
+	FMemoryReaderView Reader(SnapshotView);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	uint64 CombinedHash = 0;
+	int32 NumTables = 0;
+	Reader << Magic << Version << CombinedHash << NumTables;
+	if (Reader.IsError() || Magic != SnapshotMagic || Version != SnapshotVersion)
+	{
+		UE_LOG(LogConfigService, Warning, TEXT("스냅샷 형식/버전 불일치 (v%d, 기대 v%d) → JSON 로드"), Version, SnapshotVersion);
+		return false;
+	}
+
+	struct FSnapshotTable
+	{
+		FString Key;
+		UDataTable* Table = nullptr;
+		uint64 FileHash = 0;
+		TMap<FString, FString> ObjectTexts;
+		int64 RowsOffset = 0;
+		int32 NumRows = 0;
+	};
+	TArray<FSnapshotTable> Entries;
+
+	// 1. 검증: 테이블을 하나도 건드리기 전에 모든 해시 확인 (하나라도 다르면 전체 JSON 폴백)
+	for (int32 TableIndex = 0; TableIndex < NumTables; ++TableIndex)
+	{
+		FSnapshotTable& Entry = Entries.AddDefaulted_GetRef();
+		FString StructPath;
+		uint64 SchemaHash = 0;
+		uint64 AssetHash = 0;
+		Reader << Entry.Key << StructPath << SchemaHash << Entry.FileHash << AssetHash << Entry.NumRows;
+		Reader << Entry.ObjectTexts;
+		if (Reader.IsError()) return false;
+
+		Entry.Table = ConfigDataMap.FindRef(Entry.Key);
+		const UScriptStruct* RowStruct = Entry.Table ? Entry.Table->GetRowStruct() : nullptr;
+		if (!RowStruct || RowStruct->GetPathName() != StructPath || HashRowStruct(RowStruct) != SchemaHash)
+		{
+			UE_LOG(LogConfigService, Warning, TEXT("스냅샷 [%s] 행 구조 불일치 → JSON 로드"), *Entry.Key);
+			return false;
+		}
+		if (HashConfigFile(GetConfigFilePath(Entry.Key)) != Entry.FileHash)
+		{
+			UE_LOG(LogConfigService, Log, TEXT("스냅샷 [%s] JSON 해시 불일치 (파일 수정됨) → JSON 로드"), *Entry.Key);
+			return false;
+		}
+		// 스냅샷은 행 전체를 덮어쓰므로, 이후 에셋에서 바뀐 필드(메시·사운드 등 JSON에 없는 값)를 되돌리지 않도록 확인
+		if (HashTableRows(Entry.Table) != AssetHash)
+		{
+			UE_LOG(LogConfigService, Log, TEXT("스냅샷 [%s] 에셋 해시 불일치 (스냅샷 이후 에셋 수정됨) → JSON 로드"), *Entry.Key);
+			return false;
+		}
+
+		Entry.RowsOffset = Reader.Tell();
+		for (int32 RowIndex = 0; RowIndex < Entry.NumRows; ++RowIndex)
+		{
+			FString RowName;
+			int32 RowSize = 0;
+			Reader << RowName << RowSize;
+			Reader.Seek(Reader.Tell() + RowSize);
+		}
+		if (Reader.IsError() || Reader.Tell() > SnapshotView.Num()) return false;
+	}
+
+	for (const TPair<FString, UDataTable*>& Elem : ConfigDataMap)
+	{
+		if (Elem.Value && !Entries.ContainsByPredicate([&Elem](const FSnapshotTable& Entry) { return Entry.Key == Elem.Key; }))
+		{
+			UE_LOG(LogConfigService, Log, TEXT("스냅샷에 [%s] 없음 → JSON 로드"), *Elem.Key);
+			return false;
+		}
+	}
+
+	// 2. 적재: 매핑된 메모리에서 행 단위로 바로 역직렬화
+	for (const FSnapshotTable& Entry : Entries)
+	{
+		const UScriptStruct* RowStruct = Entry.Table->GetRowStruct();
+		Reader.Seek(Entry.RowsOffset);
+		bool bTableChanged = false;
+		for (int32 RowIndex = 0; RowIndex < Entry.NumRows; ++RowIndex)
+		{
+			FString RowNameStr;
+			int32 RowSize = 0;
+			Reader << RowNameStr << RowSize;
+			const int64 RowStart = Reader.Tell();
+
+			// 임시 버퍼로 역직렬화 후 기존 행과 다를 때만 반영 (에디터 에셋 저장 대상 최소화)
+			FBRRowBuffer Staged(RowStruct);
+			FMemoryReaderView RowReader(SnapshotView.Slice(RowStart, RowSize));
+			BRConfigService::SerializeRow(RowReader, RowStruct, Staged.Memory);
+			Reader.Seek(RowStart + RowSize);
+
+			const FName RowName(*RowNameStr);
+			uint8* RowPtr = Entry.Table->FindRowUnchecked(RowName);
+			if (!RowPtr)
+			{
+				Entry.Table->AddRow(RowName, *(const FTableRowBase*)Staged.Memory);
+				bTableChanged = true;
+			}
+			else if (!RowStruct->CompareScriptStruct(RowPtr, Staged.Memory, PPF_None))
+			{
+				RowStruct->CopyScriptStruct(RowPtr, Staged.Memory);
+				bTableChanged = true;
+			}
+		}
+
+		// 감시/재로드 기준값 갱신 (스냅샷이 이 JSON 내용과 동일함이 검증됨)
+		FBRConfigFileState& State = FileStates.FindOrAdd(Entry.Key);
+		State.ContentHash = Entry.FileHash;
+		State.Timestamp = IFileManager::Get().GetTimeStamp(*GetConfigFilePath(Entry.Key));
+		State.ObjectTexts.Reset();
+		for (const TPair<FString, FString>& ObjectText : Entry.ObjectTexts)
+		{
+			State.ObjectTexts.Add(FName(*ObjectText.Key), ObjectText.Value);
+		}
+
+		if (!bTableChanged) continue;
+
+		if (Entry.Key == UBRArmorCatalogSubsystem::ArmorTableKey)
+		{
+			if (UBRArmorCatalogSubsystem* ArmorCatalog = GetGameInstance()->GetSubsystem<UBRArmorCatalogSubsystem>())
+			{
+				ArmorCatalog->RebuildIndex(Entry.Table);
+			}
+		}
+		OutLoadedKeys.Add(Entry.Key);
+	}
+
+	UE_LOG(LogConfigService, Log, TEXT("스냅샷 적재: 테이블 %d개 (content hash %016llx, %s)"),
+		Entries.Num(), CombinedHash, MappedRegion ? TEXT("mmap") : TEXT("read"));
+	return true;
+}
+
+TMap<FString, UDataTable*> UBRConfigService::GetConfigDataMap() const
+{
+	const UBRGameInstance* GI = Cast<UBRGameInstance>(GetGameInstance());
+	return GI ? GI->ConfigDataMap : TMap<FString, UDataTable*>();
+}
+
+bool UBRConfigService::BuildJob(const FString& Key, UDataTable* Table, bool bForce, FBRConfigParseJob& OutJob) const
+{
+	return BRConfigService::BuildJobForTable(Key, GetConfigFilePath(Key), Table, bForce, FileStates.Find(Key), OutJob);
+}
+
+TArray<FString> UBRConfigService::CommitResults(TArray<FBRConfigParseResult>& Results)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_ConfigCommit);
+	const double StartTime = FPlatformTime::Seconds();
+
+	const TMap<FString, UDataTable*> ConfigDataMap = GetConfigDataMap();
+	TArray<FString> ChangedKeys;
+	int32 NumRowsCommitted = 0;
+
+	for (FBRConfigParseResult& Result : Results)
+	{
+		if (!Result.bReadOk)
+		{
+			UE_LOG(LogConfigService, Warning, TEXT("JSON 파일을 찾을 수 없습니다: %s"), *GetConfigFilePath(Result.Key));
+			continue;
+		}
+
+		FBRConfigFileState& State = FileStates.FindOrAdd(Result.Key);
+		State.ContentHash = Result.ContentHash;
+		if (Result.bUnchanged || Result.ChangedRows.Num() == 0) continue;
+
+		UDataTable* Table = ConfigDataMap.FindRef(Result.Key);
+		if (!Table || Table->GetRowStruct() != Result.ChangedRows[0].Data->Struct)
+		{
+			UE_LOG(LogConfigService, Warning, TEXT("[%s] 파싱 중 테이블이 바뀌어 반영을 건너뜁니다."), *Result.Key);
+			State.ContentHash = 0;
+			continue;
+		}
+
+		for (const FBRStagedRow& Staged : Result.ChangedRows)
+		{
+			BRConfigService::ApplyStagedRow(Table, Staged);
+			State.ObjectTexts.Add(Staged.RowName, Staged.ObjectTextKey);
+
+			UE_LOG(LogConfigService, Verbose, TEXT("[%s] 데이터 업데이트 완료: %s"), *Result.Key, *Staged.RowName.ToString());
+		}
+		NumRowsCommitted += Result.ChangedRows.Num();
+
+#if WITH_EDITOR
+		// 에디터 UI 즉시 새로고침
+		Table->Modify();
+		Table->OnDataTableChanged().Broadcast();
+		Table->PostEditChange();
+#endif
+
+		// 방어구 테이블이면 ID 인덱스 재구성 (행 추가로 포인터가 바뀔 수 있음)
+		if (Result.Key == UBRArmorCatalogSubsystem::ArmorTableKey)
+		{
+			if (UBRArmorCatalogSubsystem* ArmorCatalog = GetGameInstance()->GetSubsystem<UBRArmorCatalogSubsystem>())
+			{
+				ArmorCatalog->RebuildIndex(Table);
+			}
+		}
+
+		ChangedKeys.Add(Result.Key);
+		UE_LOG(LogConfigService, Log, TEXT("[%s] 행 %d/%d개 변경 (파싱 %.2f ms)"),
+			*Result.Key, Result.ChangedRows.Num(), Result.NumRowsParsed, Result.ParseSeconds * 1000.0);
+	}
+
+	UE_LOG(LogConfigService, Log, TEXT("설정 커밋: 테이블 %d개, 행 %d개 (게임 스레드 %.2f ms)"),
+		ChangedKeys.Num(), NumRowsCommitted, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return ChangedKeys;
+}
+
+TArray<FString> UBRConfigService::LoadAllBlocking()
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const TMap<FString, UDataTable*> ConfigDataMap = GetConfigDataMap();
+
+	// 1. 빌드 시 만든 바이너리 스냅샷이 현재 JSON과 일치하면 파싱 없이 적재
+	TArray<FString> ChangedKeys;
+	if (TryLoadSnapshot(ConfigDataMap, ChangedKeys))
+	{
+		LastLoadSource = TEXT("snapshot");
+	}
+	else
+	{
+		// 2. 폴백: JSON 파싱 (현재 스레드)
+		ChangedKeys.Reset();
+		TArray<FBRConfigParseResult> Results;
+		for (const TPair<FString, UDataTable*>& Elem : ConfigDataMap)
+		{
+			FBRConfigParseJob Job;
+			if (BuildJob(Elem.Key, Elem.Value, false, Job))
+			{
+				FileStates.FindOrAdd(Elem.Key).Timestamp = IFileManager::Get().GetTimeStamp(*Job.FilePath);
+				Results.Add(BRConfigService::ParseConfigFile(Job));
+			}
+		}
+		ChangedKeys = CommitResults(Results);
+		LastLoadSource = TEXT("json");
+	}
+
+	UE_LOG(LogConfigService, Log, TEXT("설정 로드 (%s): %.2f ms"), *LastLoadSource, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return ChangedKeys;
+}
+
+void UBRConfigService::LoadTableBlocking(const FString& Key, UDataTable* Table)
+{
+	FBRConfigParseJob Job;
+	if (!BuildJob(Key, Table, true, Job)) return;
+
+	FileStates.FindOrAdd(Key).Timestamp = IFileManager::Get().GetTimeStamp(*Job.FilePath);
+
+	TArray<FBRConfigParseResult> Results;
+	Results.Add(BRConfigService::ParseConfigFile(Job));
+	CommitResults(Results);
+}
+
+void UBRConfigService::RequestReload(bool bForce)
+{
+	TArray<FString> Keys;
+	GetConfigDataMap().GetKeys(Keys);
+	LaunchReload(Keys, bForce);
+}
+
+void UBRConfigService::LaunchReload(const TArray<FString>& Keys, bool bForce)
+{
+	if (Keys.Num() == 0) return;
+
+	if (bReloadInFlight)
+	{
+		// 현재 작업이 끝나면 전체를 한 번 더 확인
+		bReloadQueued = true;
+		bQueuedForce |= bForce;
+		return;
+	}
+
+	const TMap<FString, UDataTable*> ConfigDataMap = GetConfigDataMap();
+	TArray<FBRConfigParseJob> Jobs;
+	for (const FString& Key : Keys)
+	{
+		FBRConfigParseJob Job;
+		if (BuildJob(Key, ConfigDataMap.FindRef(Key), bForce, Job))
+		{
+			FileStates.FindOrAdd(Key).Timestamp = IFileManager::Get().GetTimeStamp(*Job.FilePath);
+			Jobs.Add(MoveTemp(Job));
+		}
+	}
+	if (Jobs.Num() == 0) return;
+
+	bReloadInFlight = true;
+	UE_LOG(LogConfigService, Log, TEXT("설정 재로드 시작: 파일 %d개 (워커 스레드)"), Jobs.Num());
+
+	TWeakObjectPtr<UBRConfigService> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Jobs = MoveTemp(Jobs)]()
+		{
+			TArray<FBRConfigParseResult> Results;
+			for (const FBRConfigParseJob& Job : Jobs)
+			{
+				Results.Add(BRConfigService::ParseConfigFile(Job));
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Results = MoveTemp(Results)]() mutable
+				{
+					UBRConfigService* Service = WeakThis.Get();
+					if (!Service) return;
+
+					Service->bReloadInFlight = false;
+					const TArray<FString> ChangedKeys = Service->CommitResults(Results);
+					if (ChangedKeys.Num() > 0)
+					{
+						Service->OnConfigCommitted.Broadcast(ChangedKeys);
+					}
+
+					if (Service->bReloadQueued)
+					{
+						const bool bForceQueued = Service->bQueuedForce;
+						Service->bReloadQueued = false;
+						Service->bQueuedForce = false;
+						Service->RequestReload(bForceQueued);
+					}
+				});
+		});
+}
+
+bool UBRConfigService::HandleWatchTick(float DeltaTime)
+{
+	if (bReloadInFlight) return true;
+
+	// 수정 시각이 바뀐 파일만 재로드 대상 (내용이 같으면 워커에서 해시 비교 후 건너뜀)
+	TArray<FString> ChangedFiles;
+	for (const TPair<FString, UDataTable*>& Elem : GetConfigDataMap())
+	{
+		const FBRConfigFileState* State = FileStates.Find(Elem.Key);
+		if (!State) continue; // 아직 한 번도 로드하지 않은 파일은 감시 대상 아님
+
+		const FDateTime Timestamp = IFileManager::Get().GetTimeStamp(*GetConfigFilePath(Elem.Key));
+		if (Timestamp != State->Timestamp)
+		{
+			ChangedFiles.Add(Elem.Key);
+		}
+	}
+
+	if (ChangedFiles.Num() > 0)
+	{
+		UE_LOG(LogConfigService, Log, TEXT("Data 폴더 변경 감지: %s"), *FString::Join(ChangedFiles, TEXT(", ")));
+		LaunchReload(ChangedFiles, false);
+	}
+	return true;
+}
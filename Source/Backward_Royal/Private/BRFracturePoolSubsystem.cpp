@@ -0,0 +1,261 @@
+// BRFracturePoolSubsystem.cpp
+#include "BRFracturePoolSubsystem.h"
+#include "BRGameInstance.h"
+#include "WeaponTypes.h"
+#include "GeometryCollection/GeometryCollectionActor.h"
+#include "GeometryCollection/GeometryCollectionComponent.h"
+#include "GeometryCollection/GeometryCollectionObject.h"
+#include "Engine/AssetManager.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
+
+DEFINE_LOG_CATEGORY(LogFracturePool);
+
+bool UBRFracturePoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// 파편은 순수 연출 → 전용 서버에는 불필요
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UBRFracturePoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.IsGameWorld())
+	{
+		PrewarmFromWeaponTable();
+	}
+}
+
+void UBRFracturePoolSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(ExpiryTimerHandle);
+	}
+
+	if (PrewarmHandle.IsValid())
+	{
+		PrewarmHandle->CancelHandle();
+		PrewarmHandle.Reset();
+	}
+
+	UE_LOG(LogFracturePool, Log, TEXT("파편 풀 종료: 스폰 %d / 재사용 %d / 강제 회수 %d"), NumSpawned, NumReused, NumRecycled);
+
+	// 액터는 월드와 함께 정리되므로 참조만 해제
+	Pool.Empty();
+	ActiveFractures.Empty();
+
+	Super::Deinitialize();
+}
+
+UBRFracturePoolSubsystem* UBRFracturePoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UBRFracturePoolSubsystem>() : nullptr;
+}
+
+void UBRFracturePoolSubsystem::PrewarmFromWeaponTable()
+{
+	UBRGameInstance* GI = Cast<UBRGameInstance>(GetWorld()->GetGameInstance());
+	if (!GI) return;
+
+	UDataTable** WeaponTablePtr = GI->ConfigDataMap.Find(TEXT("WeaponData"));
+	if (!WeaponTablePtr || !*WeaponTablePtr) return;
+
+	TArray<FSoftObjectPath> AssetPaths;
+	static const FString ContextString(TEXT("Fracture Pool Prewarm"));
+	(*WeaponTablePtr)->ForeachRow<FWeaponData>(ContextString, [&AssetPaths](const FName& RowName, const FWeaponData& Row)
+		{
+			if (!Row.FracturedMesh.IsNull())
+			{
+				AssetPaths.AddUnique(Row.FracturedMesh.ToSoftObjectPath());
+			}
+		});
+
+	if (AssetPaths.Num() == 0) return;
+
+	PrewarmHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetPaths,
+		FStreamableDelegate::CreateUObject(this, &UBRFracturePoolSubsystem::HandlePrewarmAssetsLoaded, AssetPaths));
+}
+
+void UBRFracturePoolSubsystem::HandlePrewarmAssetsLoaded(TArray<FSoftObjectPath> AssetPaths)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_FracturePoolPrewarm);
+
+	int32 NumPrewarmed = 0;
+	for (const FSoftObjectPath& Path : AssetPaths)
+	{
+		UGeometryCollection* Asset = Cast<UGeometryCollection>(Path.ResolveObject());
+		if (!Asset) continue;
+
+		FBRFracturePoolBucket& Bucket = Pool.FindOrAdd(Asset);
+		while (Bucket.Free.Num() < PrewarmPerAsset)
+		{
+			AGeometryCollectionActor* Actor = SpawnPooledActor(Asset);
+			if (!Actor) break;
+
+			Bucket.Free.Add(Actor);
+			NumPrewarmed++;
+		}
+	}
+
+	UE_LOG(LogFracturePool, Log, TEXT("파편 풀 미리 생성: 에셋 %d종, 액터 %d개"), Pool.Num(), NumPrewarmed);
+}
+
+AGeometryCollectionActor* UBRFracturePoolSubsystem::SpawnPooledActor(UGeometryCollection* Asset)
+{
+	AGeometryCollectionActor* Actor = GetWorld()->SpawnActorDeferred<AGeometryCollectionActor>(
+		AGeometryCollectionActor::StaticClass(),
+		FTransform::Identity,
+		nullptr,
+		nullptr,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+	);
+	if (!Actor) return nullptr;
+
+	// 각 클라이언트에서 로컬로 연산 (서버 파편 상태를 복제받지 않음)
+	Actor->SetReplicates(false);
+
+	if (UGeometryCollectionComponent* GCComp = Actor->GetGeometryCollectionComponent())
+	{
+		GCComp->SetRestCollection(Asset);
+
+		// 1. 파괴가 100% 보장되는 기본 물리 프로파일 사용
+		GCComp->SetCollisionProfileName(TEXT("PhysicsActor"));
+
+		// 2. 그 위에 덮어쓰기: 파편이 플레이어의 길을 막거나 튕겨내지 않도록 무시
+		GCComp->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+		GCComp->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
+
+		GCComp->SetNotifyRigidBodyCollision(true);
+		GCComp->SetSimulatePhysics(false);
+	}
+
+	UGameplayStatics::FinishSpawningActor(Actor, FTransform::Identity);
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+
+	NumSpawned++;
+	return Actor;
+}
+
+void UBRFracturePoolSubsystem::PlayFracture(UGeometryCollection* Asset, const FTransform& SpawnTransform, AActor* DamageCauser)
+{
+	if (!Asset) return;
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_FracturePoolPlay);
+
+	// 1. 동시 시뮬레이션 상한: 가장 오래된 파편부터 회수
+	while (ActiveFractures.Num() >= MaxActiveFractures)
+	{
+		const FBRActiveFracture Oldest = ActiveFractures[0];
+		ActiveFractures.RemoveAt(0, 1, EAllowShrinking::No);
+		ReleaseToPool(Oldest.Actor, Oldest.Asset);
+		NumRecycled++;
+	}
+
+	// 2. 대기 액터 꺼내기 (월드 정리 등으로 사라진 항목은 건너뜀). 없으면 새로 스폰
+	FBRFracturePoolBucket& Bucket = Pool.FindOrAdd(Asset);
+	AGeometryCollectionActor* Actor = nullptr;
+	while (!Actor && Bucket.Free.Num() > 0)
+	{
+		Actor = Bucket.Free.Pop(EAllowShrinking::No);
+		if (!IsValid(Actor))
+		{
+			Actor = nullptr;
+		}
+	}
+
+	if (Actor)
+	{
+		NumReused++;
+	}
+	else
+	{
+		Actor = SpawnPooledActor(Asset);
+		if (!Actor) return;
+	}
+
+	UGeometryCollectionComponent* GCComp = Actor->GetGeometryCollectionComponent();
+	if (!GCComp)
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	// 3. 상태 초기화: 위치 이동 → 레스트 컬렉션 재설정(동적 컬렉션/클러스터 초기화) → 물리 상태 재생성
+	Actor->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	GCComp->SetRestCollection(Asset);
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorEnableCollision(true);
+	GCComp->SetSimulatePhysics(true);
+	GCComp->RecreatePhysicsState();
+
+	// 4. 타겟 액터에만 점 데미지를 주어 제자리에서 즉시 분리
+	FHitResult HitInfo;
+	HitInfo.ImpactPoint = SpawnTransform.GetLocation();
+	UGameplayStatics::ApplyPointDamage(Actor, 1000000.f, FVector::DownVector, HitInfo, nullptr, DamageCauser, nullptr);
+
+	// 아주 살짝 흩어지도록 임펄스 추가
+	GCComp->AddImpulse(FMath::VRand() * 10.0f, NAME_None, true);
+
+	FBRActiveFracture& Entry = ActiveFractures.AddDefaulted_GetRef();
+	Entry.Actor = Actor;
+	Entry.Asset = Asset;
+	Entry.StartTime = GetWorld()->GetTimeSeconds();
+
+	if (!GetWorld()->GetTimerManager().IsTimerActive(ExpiryTimerHandle))
+	{
+		ScheduleNextExpiry();
+	}
+
+	UE_LOG(LogFracturePool, Verbose, TEXT("PlayFracture: %s (활성 %d / 대기 %d)"), *Asset->GetName(), ActiveFractures.Num(), Bucket.Free.Num());
+}
+
+void UBRFracturePoolSubsystem::ReleaseToPool(AGeometryCollectionActor* Actor, UGeometryCollection* Asset)
+{
+	if (!IsValid(Actor)) return;
+
+	if (UGeometryCollectionComponent* GCComp = Actor->GetGeometryCollectionComponent())
+	{
+		GCComp->SetSimulatePhysics(false);
+	}
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+
+	Pool.FindOrAdd(Asset).Free.Add(Actor);
+}
+
+void UBRFracturePoolSubsystem::ExpireFractures()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// 오래된 순으로 쌓여 있으므로 앞에서부터 만료된 것만 회수
+	int32 NumExpired = 0;
+	while (NumExpired < ActiveFractures.Num() && Now - ActiveFractures[NumExpired].StartTime >= FractureLifetime)
+	{
+		ReleaseToPool(ActiveFractures[NumExpired].Actor, ActiveFractures[NumExpired].Asset);
+		NumExpired++;
+	}
+	ActiveFractures.RemoveAt(0, NumExpired, EAllowShrinking::No);
+
+	ScheduleNextExpiry();
+}
+
+void UBRFracturePoolSubsystem::ScheduleNextExpiry()
+{
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	TimerManager.ClearTimer(ExpiryTimerHandle);
+
+	if (ActiveFractures.Num() == 0) return;
+
+	// 가장 오래된 파편의 만료 시점에 한 번만 깨어남
+	const double Remaining = ActiveFractures[0].StartTime + FractureLifetime - GetWorld()->GetTimeSeconds();
+	TimerManager.SetTimer(ExpiryTimerHandle, this, &UBRFracturePoolSubsystem::ExpireFractures, FMath::Max((float)Remaining, 0.01f), false);
+}
@@ -11,21 +11,16 @@
 #include "Engine/DataTable.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
 #include "GameFramework/GameModeBase.h"
 #include "GlobalBalanceData.h"
-#include "HAL/PlatformFileManager.h"
-#include "JsonObjectConverter.h"
 #include "Kismet/GameplayStatics.h"
 #include "Misc/CommandLine.h"
-#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "NavigationSystem.h"
-#include "PlayerCharacter.h"
-#include "StaminaComponent.h"
 #include "Subsystems/WorldSubsystem.h"
-#include "GameFramework/CharacterMovementComponent.h"
-#include "BRAttackComponent.h"
+#include "BRActorRegistrySubsystem.h"
+#include "BRBalanceSubsystem.h"
+#include "BRConfigService.h"
 #include "TimerManager.h"
 #include "UObject/Package.h"
 #include "UObject/UnrealType.h"
@@ -93,7 +88,11 @@ void UBRGameInstance::Init() {
   FString CommandLine = FCommandLine::Get();
   UE_LOG(LogTemp, Warning, TEXT("[GameInstance] 명령줄: %s"), *CommandLine);
 
-  ReloadAllConfigs();
+  if (UBRConfigService *ConfigService = GetSubsystem<UBRConfigService>()) {
+    ConfigService->OnConfigCommitted.AddUObject(
+        this, &UBRGameInstance::HandleConfigCommitted);
+  }
+  LoadInitialConfigs();
 }
 
 void UBRGameInstance::OnStart() {
@@ -581,155 +580,134 @@ void UBRGameInstance::ShowRoomInfo() {
   }
 }
 
-// Seamless Travel 시 GameInstance가 달라질 수 있어, 프로세스 정적 저장소에 백업
-// (복원 시 사용)
-namespace {
-TMap<FString, TTuple<int32, bool, int32>> G_PendingRoleByName;
-TArray<TTuple<int32, bool, int32>> G_PendingRoleByIndex;
-} // namespace
-
-void UBRGameInstance::SavePendingRolesForTravel(ABRGameState *GameState) {
+void UBRGameInstance::SaveTravelManifest(ABRGameState *GameState) {
   if (!GameState)
     return;
-  PendingRoleRestoreByName.Empty();
-  PendingRoleRestoreByIndex.Empty();
-  G_PendingRoleByName.Empty();
-  G_PendingRoleByIndex.Empty();
+  TravelManifest.Reset();
+  TravelManifestUIDByNetId.Reset();
   for (APlayerState *PS : GameState->PlayerArray) {
-    if (ABRPlayerState *BRPS = Cast<ABRPlayerState>(PS)) {
-      TTuple<int32, bool, int32> Data(BRPS->TeamNumber, BRPS->bIsLowerBody,
-                                      BRPS->ConnectedPlayerIndex);
-      const FString LocalPlayerName = BRPS->GetPlayerName();
-      const FString LocalUserUID = BRPS->UserUID;
-      // Travel 후 복원 시 이름 복제가 늦을 수 있으므로, 이름과 UID 둘 다 키로 저장
-      if (!LocalPlayerName.IsEmpty()) {
-        PendingRoleRestoreByName.Add(LocalPlayerName, Data);
-        G_PendingRoleByName.Add(LocalPlayerName, Data);
-      }
-      if (!LocalUserUID.IsEmpty() && LocalUserUID != LocalPlayerName) {
-        PendingRoleRestoreByName.Add(LocalUserUID, Data);
-        G_PendingRoleByName.Add(LocalUserUID, Data);
-      }
-      G_PendingRoleByIndex.Add(Data);
-      PendingRoleRestoreByIndex.Add(Data);
+    ABRPlayerState *BRPS = Cast<ABRPlayerState>(PS);
+    if (!BRPS)
+      continue;
+    FTravelUserInfoSave Entry;
+    Entry.UserUID = BRPS->UserUID;
+    Entry.UniqueNetId =
+        BRPS->GetUniqueId().IsValid() ? BRPS->GetUniqueId().ToString() : FString();
+    Entry.PlayerName = BRPS->GetPlayerName();
+    Entry.CustomizationData = BRPS->CustomizationData;
+    Entry.bIsHost = BRPS->bIsHost;
+    Entry.TeamNumber = BRPS->TeamNumber;
+    Entry.bIsSpectatorSlot = BRPS->bIsSpectatorSlot;
+    Entry.bIsLowerBody = BRPS->bIsLowerBody;
+    if (BRPS->PartnerPlayerState)
+      Entry.PartnerUID = BRPS->PartnerPlayerState->UserUID;
+    if (Entry.UserUID.IsEmpty()) {
+      // PostLogin에서 항상 UID를 부여하므로 정상 경로에서는 없음
+      UE_LOG(LogTemp, Warning,
+             TEXT("[랜덤 팀 적용] Travel 매니페스트 저장 스킵: '%s' UserUID 없음"),
+             *Entry.PlayerName);
+      continue;
     }
+    if (!Entry.UniqueNetId.IsEmpty())
+      TravelManifestUIDByNetId.Add(Entry.UniqueNetId, Entry.UserUID);
+    TravelManifest.Add(Entry.UserUID, MoveTemp(Entry));
   }
   UE_LOG(LogTemp, Warning,
-         TEXT("[랜덤 팀 적용] Seamless Travel 전 역할 저장: %d명 (정적+GI)"),
-         G_PendingRoleByIndex.Num());
+         TEXT("[랜덤 팀 적용] Travel 전 매니페스트 저장: %d명 (UserUID 키)"),
+         TravelManifest.Num());
 }
 
-void UBRGameInstance::RestorePendingRolesFromTravel(ABRGameState *GameState) {
-  if (!GameState) {
-    UE_LOG(LogTemp, Warning,
-           TEXT("[랜덤 팀 적용] 역할 복원 스킵: GameState 없음"));
-    return;
+const FTravelUserInfoSave *
+UBRGameInstance::FindTravelManifestEntry(const ABRPlayerState *BRPS) const {
+  if (!BRPS || TravelManifest.Num() == 0)
+    return nullptr;
+  if (!BRPS->UserUID.IsEmpty()) {
+    if (const FTravelUserInfoSave *Found = TravelManifest.Find(BRPS->UserUID))
+      return Found;
   }
-  // GameInstance 데이터가 비어 있으면 정적 백업 사용 (멀티 PIE 등에서 GI가
-  // 달라질 수 있음)
-  bool bUseStatic = (PendingRoleRestoreByName.Num() == 0 &&
-                     PendingRoleRestoreByIndex.Num() == 0);
-  if (bUseStatic && G_PendingRoleByIndex.Num() == 0 &&
-      G_PendingRoleByName.Num() == 0) {
-    UE_LOG(
-        LogTemp, Warning,
-        TEXT(
-            "[랜덤 팀 적용] 역할 복원 스킵: 저장된 역할 없음 (GI=%d, 정적=%d)"),
-        PendingRoleRestoreByIndex.Num(), G_PendingRoleByIndex.Num());
-    return;
+  const FUniqueNetIdRepl &NetId = BRPS->GetUniqueId();
+  if (NetId.IsValid()) {
+    if (const FString *UID = TravelManifestUIDByNetId.Find(NetId.ToString()))
+      return TravelManifest.Find(*UID);
   }
-  int32 Restored = 0;
-  auto &NameMap = bUseStatic ? G_PendingRoleByName : PendingRoleRestoreByName;
-  auto &IndexArr =
-      bUseStatic ? G_PendingRoleByIndex : PendingRoleRestoreByIndex;
-  // 1) PlayerName으로 복원 시도
-  for (APlayerState *PS : GameState->PlayerArray) {
-    if (ABRPlayerState *BRPS = Cast<ABRPlayerState>(PS)) {
-      FString Key = BRPS->GetPlayerName();
-      if (Key.IsEmpty())
-        Key = BRPS->UserUID;
-      const TTuple<int32, bool, int32> *Found = NameMap.Find(Key);
-      if (Found) {
-        BRPS->SetTeamNumber(Found->Get<0>());
-        BRPS->SetPlayerRole(Found->Get<1>(), Found->Get<2>());
-        Restored++;
-        UE_LOG(LogTemp, Log, TEXT("[진단] 복원 매칭(이름/UID) 성공: Key='%s' -> 팀%d %s"), *Key, Found->Get<0>(), Found->Get<1>() ? TEXT("하체") : TEXT("상체"));
-      } else {
-        UE_LOG(LogTemp, Warning, TEXT("[진단] 복원 매칭 실패: GetPlayerName='%s' UserUID='%s' (NameMap %d개)"), *BRPS->GetPlayerName(), *BRPS->UserUID, NameMap.Num());
-      }
-    }
-  }
-  // 2) 이름 매칭 실패 시 인덱스로 폴백
-  if (Restored == 0 && IndexArr.Num() > 0) {
-    const int32 N = FMath::Min(IndexArr.Num(), GameState->PlayerArray.Num());
-    for (int32 i = 0; i < N; i++) {
-      if (ABRPlayerState *BRPS =
-              Cast<ABRPlayerState>(GameState->PlayerArray[i])) {
-        const TTuple<int32, bool, int32> &Data = IndexArr[i];
-        BRPS->SetTeamNumber(Data.Get<0>());
-        BRPS->SetPlayerRole(Data.Get<1>(), Data.Get<2>());
-        Restored++;
-      }
-    }
-    UE_LOG(LogTemp, Warning,
-           TEXT("[랜덤 팀 적용] Seamless Travel 후 역할 복원: %d명 (인덱스 "
-                "폴백%s)"),
-           Restored, bUseStatic ? TEXT(", 정적") : TEXT(""));
-  } else {
-    UE_LOG(
-        LogTemp, Warning,
-        TEXT("[랜덤 팀 적용] Seamless Travel 후 역할 복원: %d명 (이름 매칭%s)"),
-        Restored, bUseStatic ? TEXT(", 정적") : TEXT(""));
-  }
-  // 저장 데이터는 즉시 비우지 않음. 재시도(하체 Pawn 대기) 시 다시 복원할 수 있도록 유지.
-  // 실제 클리어는 GameMode에서 적용 성공/포기 시 ClearPendingRoleRestoreData() 호출.
+  return nullptr;
 }
 
-void UBRGameInstance::ClearPendingRoleRestoreData() {
-  PendingRoleRestoreByName.Empty();
-  PendingRoleRestoreByIndex.Empty();
-  G_PendingRoleByName.Empty();
-  G_PendingRoleByIndex.Empty();
+bool UBRGameInstance::ApplyTravelManifestEntry(ABRPlayerState *BRPS) {
+  FTravelUserInfoSave *Entry =
+      const_cast<FTravelUserInfoSave *>(FindTravelManifestEntry(BRPS));
+  if (!Entry)
+    return false;
+  if (Entry->AppliedTo.Get() == BRPS)
+    return true;
+  Entry->AppliedTo = BRPS;
+
+  // 비 Seamless 재접속이면 PlayerState가 새로 만들어져 UID/이름이 비어 있을 수 있음
+  if (BRPS->UserUID != Entry->UserUID)
+    BRPS->SetUserUID(Entry->UserUID);
+  if (BRPS->GetPlayerName().IsEmpty() && !Entry->PlayerName.IsEmpty())
+    BRPS->SetPlayerNameString(Entry->PlayerName);
+  BRPS->CustomizationData = Entry->CustomizationData;
+  BRPS->OnRep_CustomizationData();
+  BRPS->SetIsHost(Entry->bIsHost);
+  BRPS->SetTeamNumber(Entry->TeamNumber);
+  if (Entry->bIsSpectatorSlot || Entry->TeamNumber <= 0)
+    BRPS->SetSpectator(true);
+  else
+    BRPS->SetPlayerRole(Entry->bIsLowerBody, -1);
+  return true;
 }
 
-bool UBRGameInstance::HasPendingRoleRestore() const {
-  return PendingRoleRestoreByName.Num() > 0 ||
-         PendingRoleRestoreByIndex.Num() > 0 || G_PendingRoleByName.Num() > 0 ||
-         G_PendingRoleByIndex.Num() > 0;
-}
+int32 UBRGameInstance::ReconcileTravelManifest(ABRGameState *GameState) {
+  if (!GameState || TravelManifest.Num() == 0)
+    return 0;
+
+  // 1) 입장 시 적용되지 않은 인원 적용 + UID → 현재 PlayerArray 인덱스
+  TMap<FString, int32> IndexByUID;
+  int32 Applied = 0;
+  for (int32 i = 0; i < GameState->PlayerArray.Num(); i++) {
+    ABRPlayerState *BRPS = Cast<ABRPlayerState>(GameState->PlayerArray[i]);
+    if (!BRPS)
+      continue;
+    if (ApplyTravelManifestEntry(BRPS))
+      Applied++;
+    else
+      UE_LOG(LogTemp, Warning,
+             TEXT("[랜덤 팀 적용] 매니페스트에 없는 플레이어: '%s' (UID='%s')"),
+             *BRPS->GetPlayerName(), *BRPS->UserUID);
+    if (!BRPS->UserUID.IsEmpty())
+      IndexByUID.Add(BRPS->UserUID, i);
+  }
 
-int32 UBRGameInstance::GetPendingRoleRestoreCount() const {
-  if (PendingRoleRestoreByIndex.Num() > 0)
-    return PendingRoleRestoreByIndex.Num();
-  return G_PendingRoleByIndex.Num();
-}
+  // 2) 파트너는 UID로 연결 → 현재 배열 인덱스로 변환 (Travel 후 접속 순서가 바뀌어도 유지)
+  for (int32 i = 0; i < GameState->PlayerArray.Num(); i++) {
+    ABRPlayerState *BRPS = Cast<ABRPlayerState>(GameState->PlayerArray[i]);
+    const FTravelUserInfoSave *Entry = FindTravelManifestEntry(BRPS);
+    if (!Entry || Entry->bIsSpectatorSlot || Entry->TeamNumber <= 0)
+      continue;
+    const int32 *PartnerIndex = IndexByUID.Find(Entry->PartnerUID);
+    BRPS->SetPlayerRole(Entry->bIsLowerBody, PartnerIndex ? *PartnerIndex : -1);
+  }
 
-bool UBRGameInstance::HasPendingUserInfoForIndex(int32 Index) const {
-  if (Index < 0)
-    return false;
-  if (PendingRoleRestoreByIndex.Num() > 0)
-    return Index < PendingRoleRestoreByIndex.Num();
-  return Index < G_PendingRoleByIndex.Num();
+  for (const TPair<FString, FTravelUserInfoSave> &Pair : TravelManifest) {
+    if (!Pair.Value.AppliedTo.IsValid())
+      UE_LOG(LogTemp, Warning,
+             TEXT("[랜덤 팀 적용] 매니페스트 인원 미도착: '%s' (UID='%s')"),
+             *Pair.Value.PlayerName, *Pair.Key);
+  }
+  UE_LOG(LogTemp, Warning,
+         TEXT("[랜덤 팀 적용] Travel 후 매니페스트 정리: %d/%d명 적용"),
+         Applied, TravelManifest.Num());
+  return Applied;
 }
 
-void UBRGameInstance::RestoreUserInfoToPlayerStateForPostLogin(
-    ABRPlayerState *BRPS, int32 Index) {
-  if (!BRPS || Index < 0)
-    return;
-  const TArray<TTuple<int32, bool, int32>> &Arr =
-      (PendingRoleRestoreByIndex.Num() > 0) ? PendingRoleRestoreByIndex
-                                           : G_PendingRoleByIndex;
-  if (Index >= Arr.Num())
-    return;
-  const TTuple<int32, bool, int32> &Data = Arr[Index];
-  BRPS->SetTeamNumber(Data.Get<0>());
-  BRPS->SetPlayerRole(Data.Get<1>(), Data.Get<2>());
+void UBRGameInstance::ClearTravelManifest() {
+  TravelManifest.Empty();
+  TravelManifestUIDByNetId.Empty();
 }
 
 /** [핵심] JSON 데이터를 읽어 DT를 갱신하고 에셋으로 저장함 */
 void UBRGameInstance::ReloadAllConfigs() {
-  GI_LOG(Display, TEXT("=== Starting Global Config Reload and Asset Sync ==="));
-
   if (ConfigDataMap.Num() == 0) {
     GI_LOG(
         Warning,
@@ -737,183 +715,93 @@ void UBRGameInstance::ReloadAllConfigs() {
     return;
   }
 
-  for (auto &Elem : ConfigDataMap) {
-    const FString &JsonFileName = Elem.Key;
-    UDataTable *TargetTable = Elem.Value;
+  // 파싱은 워커 스레드에서, 바뀐 행만 게임 스레드에서 반영 → HandleConfigCommitted
+  if (UBRConfigService *ConfigService = GetSubsystem<UBRConfigService>()) {
+    GI_LOG(Display, TEXT("=== Global Config Reload Requested ==="));
+    ConfigService->RequestReload(true);
+  }
+}
 
-    if (TargetTable) {
-      // 1. JSON 파일 읽어서 메모리상 DT 업데이트
-      UpdateDataTableFromJson(TargetTable, JsonFileName);
+void UBRGameInstance::LoadInitialConfigs() {
+  GI_LOG(Display, TEXT("=== Starting Global Config Load and Asset Sync ==="));
 
-      // 2. 에디터 환경이고 게임이 실행 중이 아닌 경우에만 .uasset 파일로 영구
-      // 저장 Standalone 모드나 PIE 모드에서는 저장하지 않음
-#if WITH_EDITOR
-      // 에디터에서만 저장하고, 게임 실행 중이 아닐 때만 저장
-      // GetWorld()가 있으면 게임이 실행 중인 것으로 간주
-      if (GIsEditor && !GetWorld()) {
-        SaveDataTableToAsset(TargetTable);
-      }
-#endif
-    }
+  if (ConfigDataMap.Num() == 0) {
+    GI_LOG(
+        Warning,
+        TEXT("ConfigDataMap이 비어 있습니다. 에디터에서 설정이 필요합니다."));
+    return;
   }
 
-  // 글로벌 배율 적용 로직 호출
-  ApplyGlobalMultipliers();
-
-  // 3. 월드에 이미 존재하는 무기들에게 최신 데이터를 적용 (기존 로직 유지)
-  if (GetWorld()) {
-    for (TActorIterator<ABaseWeapon> It(GetWorld()); It; ++It) {
-      It->LoadWeaponData();
-    }
+  // 부팅 시에는 이후 로직이 테이블을 바로 읽으므로 즉시 로드
+  TArray<FString> ChangedKeys;
+  if (UBRConfigService *ConfigService = GetSubsystem<UBRConfigService>()) {
+    ChangedKeys = ConfigService->LoadAllBlocking();
   }
+  SaveChangedConfigAssets(ChangedKeys);
 
-  GI_LOG(Display, TEXT("=== Global Config Reload Complete ==="));
-}
+  // 글로벌 배율 적용 로직 호출 (JSON이 없어도 에셋 값 기준으로 적용)
+  ApplyGlobalMultipliers();
 
-void UBRGameInstance::LoadConfigFromJson(const FString &FileName,
-                                         UDataTable *TargetTable) {
-  if (!TargetTable)
-    return;
+  // 프로세스 시작부터 설정 준비 완료까지 (스냅샷/JSON 경로 비교용)
+  const UBRConfigService *ConfigService = GetSubsystem<UBRConfigService>();
+  GI_LOG(Display,
+         TEXT("=== Global Config Load Complete (source: %s, time-to-config-"
+              "ready: %.1f ms) ==="),
+         ConfigService ? *ConfigService->GetLastLoadSource() : TEXT("none"),
+         (FPlatformTime::Seconds() - GStartTime) * 1000.0);
+}
 
-  // 경로: 프로젝트/Config/파일명.json
-  FString FilePath = GetConfigDirectory() + FileName + TEXT(".json");
-  FString JsonString;
+void UBRGameInstance::HandleConfigCommitted(const TArray<FString> &ChangedKeys) {
+  SaveChangedConfigAssets(ChangedKeys);
 
-  if (!FFileHelper::LoadFileToString(JsonString, *FilePath)) {
-    GI_LOG(Warning, TEXT("File not found: %s"), *FilePath);
-    return;
+  // 바뀐 테이블에 해당하는 부분만 다시 적용
+  if (ChangedKeys.Contains(TEXT("GlobalSettings"))) {
+    ApplyGlobalMultipliers();
   }
 
-  TSharedPtr<FJsonObject> RootObject;
-  TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-
-  if (FJsonSerializer::Deserialize(Reader, RootObject) &&
-      RootObject.IsValid()) {
-    const TArray<TSharedPtr<FJsonValue>> *DataArray;
-    // 모든 JSON의 최상위 배열 키를 "Data"로 통일하거나 파일명과 맞춥니다.
-    if (RootObject->TryGetArrayField(TEXT("Data"), DataArray)) {
-      // const UScriptStruct* 로 선언하여 타입 에러 해결
-      const UScriptStruct *TableStruct = TargetTable->GetRowStruct();
-
-      for (const auto &Value : *DataArray) {
-        TSharedPtr<FJsonObject> DataObj = Value->AsObject();
-        if (!DataObj.IsValid())
-          continue;
-
-        FName RowID = FName(*DataObj->GetStringField(TEXT("Name")));
-        uint8 *RowPtr = TargetTable->FindRowUnchecked(RowID);
-
-        if (RowPtr && TableStruct) {
-          // 수치 데이터 주입
-          FJsonObjectConverter::JsonObjectToUStruct(DataObj.ToSharedRef(),
-                                                    TableStruct, RowPtr);
-          GI_LOG(Log, TEXT("[%s.json] Row Updated: %s"), *FileName,
-                 *RowID.ToString());
-        }
+  // 월드에 이미 존재하는 무기들에게 최신 데이터를 적용
+  if (ChangedKeys.Contains(TEXT("WeaponData"))) {
+    if (UBRActorRegistrySubsystem *Registry =
+            UBRActorRegistrySubsystem::Get(GetWorld())) {
+      for (ABaseWeapon *Weapon : Registry->GetWeapons()) {
+        Weapon->LoadWeaponData();
       }
     }
   }
-}
 
-FString UBRGameInstance::GetConfigDirectory() {
-    // FPaths::ProjectDir()는 에디터에서는 .uproject가 있는 프로젝트 루트,
-    // 패키징 빌드에서는 exe의 상위 디렉토리를 반환하므로 두 환경 모두에서 사용 가능.
-    FString TargetPath = FPaths::ProjectDir() / TEXT("Data/");
+  GI_LOG(Display, TEXT("=== Global Config Reload Complete (%s) ==="),
+         *FString::Join(ChangedKeys, TEXT(", ")));
+}
 
-    // 디버깅: 실제 경로와 폴더 존재 여부 로그
-    GI_LOG(Log, TEXT("Config Directory: %s (Exists: %s)"), *TargetPath,
-        FPlatformFileManager::Get().GetPlatformFile().DirectoryExists(*TargetPath)
-        ? TEXT("Yes") : TEXT("No"));
+void UBRGameInstance::SaveChangedConfigAssets(const TArray<FString> &ChangedKeys) {
+  // 에디터 환경이고 게임이 실행 중이 아닌 경우에만 .uasset 파일로 영구 저장
+  // Standalone 모드나 PIE 모드에서는 저장하지 않음
+#if WITH_EDITOR
+  // GetWorld()가 있으면 게임이 실행 중인 것으로 간주
+  if (GIsEditor && !GetWorld()) {
+    for (const FString &Key : ChangedKeys) {
+      if (UDataTable *TargetTable = ConfigDataMap.FindRef(Key)) {
+        SaveDataTableToAsset(TargetTable);
+      }
+    }
+  }
+#endif
+}
 
-    return TargetPath;
+FString UBRGameInstance::GetConfigDirectory() const {
+  const UBRConfigService *ConfigService = GetSubsystem<UBRConfigService>();
+  return ConfigService ? ConfigService->GetConfigDirectory()
+                       : FPaths::ProjectDir() / TEXT("Data/");
 }
 
-/** JSON 문자열을 DataTable에 주입 */
+/** JSON 파일을 읽어 DataTable에 즉시 주입 (바뀐 행만 반영) */
 void UBRGameInstance::UpdateDataTableFromJson(UDataTable *TargetTable,
                                               FString FileName) {
   if (!TargetTable)
     return;
-    
-  FString FullPath = GetConfigDirectory() + FileName + TEXT(".json");
-  FString JsonString;
-
-  if (!FFileHelper::LoadFileToString(JsonString, *FullPath)) {
-    GI_LOG(Warning, TEXT("JSON 파일을 찾을 수 없습니다: %s"), *FullPath);
-    return;
-  }
-
-  // 1. JSON 파싱
-  TSharedPtr<FJsonObject> RootObject;
-  TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-
-  if (FJsonSerializer::Deserialize(Reader, RootObject) &&
-      RootObject.IsValid()) {
-    const TArray<TSharedPtr<FJsonValue>> *DataArray;
-    // JSON의 "Data" 배열 필드를 가져옴
-    if (RootObject->TryGetArrayField(TEXT("Data"), DataArray)) {
-      const UScriptStruct *TableStruct = TargetTable->GetRowStruct();
-
-      for (const auto &Value : *DataArray) {
-        TSharedPtr<FJsonObject> DataObj = Value->AsObject();
-        if (!DataObj.IsValid())
-          continue;
-
-        // 1. 행 이름(Name) 확인
-        FString NameStr = DataObj->GetStringField(TEXT("Name"));
-        if (NameStr.IsEmpty())
-          continue;
-
-        FName RowName = FName(*NameStr);
-
-        // 2. 기존 행 찾기
-        uint8 *RowPtr = TargetTable->FindRowUnchecked(RowName);
-
-        // 3. 행이 없으면 새로 추가
-        if (!RowPtr)
-        {
-            if (TableStruct)
-            {
-                // 1. 메모리 할당 (구조체 크기만큼)
-                uint8* NewRowData = (uint8*)FMemory::Malloc(TableStruct->GetStructureSize());
-
-                // 2. 구조체 초기화 (생성자 호출 -> 여기서 포인터들이 nullptr로 안전하게 초기화됨)
-                TableStruct->InitializeStruct(NewRowData);
-
-                // 3. 테이블에 추가 (초기화된 데이터를 넣음)
-                TargetTable->AddRow(RowName, *(FTableRowBase*)NewRowData);
-
-                // 4. 임시 메모리 해제
-                TableStruct->DestroyStruct(NewRowData);
-                FMemory::Free(NewRowData);
-            }
 
-            // 포인터 다시 갱신 (이제 안전하게 생성된 행을 가리킴)
-            RowPtr = TargetTable->FindRowUnchecked(RowName);
-        }
-
-        // 4. 데이터 주입 (기본적으로 기존 데이터는 유지하고 JSON에 있는 필드만
-        // 덮어씀)
-        if (RowPtr && TableStruct) {
-          FJsonObjectConverter::JsonObjectToUStruct(DataObj.ToSharedRef(),
-                                                    TableStruct, RowPtr);
-          GI_LOG(Log, TEXT("[%s] 데이터 업데이트 완료: %s"), *FileName,
-                 *RowName.ToString());
-        }
-      }
-
-      // 데이터 테이블 구조 갱신 알림 (에디터 UI 등에 즉시 반영)
-      TargetTable->Modify();
-
-#if WITH_EDITOR
-      // 에디터에게 데이터 테이블의 구조나 내용이 바뀌었음을 알림
-      // 이 함수는 UDataTable에 정의되어 있으며, 에디터 UI를 즉시
-      // 새로고침합니다.
-      TargetTable->OnDataTableChanged().Broadcast();
-
-      // (선택 사항) 데이터 테이블 에셋 아이콘에 별표(*) 표시 (수정됨 표시)
-      TargetTable->PostEditChange();
-#endif
-    }
+  if (UBRConfigService *ConfigService = GetSubsystem<UBRConfigService>()) {
+    ConfigService->LoadTableBlocking(FileName, TargetTable);
   }
 }
 
@@ -958,116 +846,31 @@ void UBRGameInstance::SaveDataTableToAsset(UDataTable *TargetTable) {
 }
 
 void UBRGameInstance::ApplyGlobalMultipliers() {
-    if (UDataTable** TargetTablePtr =
-        ConfigDataMap.Find(TEXT("GlobalSettings"))) {
-        UDataTable* GlobalTable = *TargetTablePtr;
-        if (GlobalTable) {
-            static const FString ContextString(TEXT("Global Settings Context"));
-            FGlobalBalanceData* FoundData = GlobalTable->FindRow<FGlobalBalanceData>(
-                FName("Default"), ContextString);
-
-            if (FoundData) {
-                // 1. 무기 관련 전역 변수 업데이트
-                ABaseWeapon::GlobalDamageMultiplier =
-                    FoundData->Global_Weapon_DamageMultiplier;
-                ABaseWeapon::GlobalImpulseMultiplier =
-                    FoundData->Global_Weapon_ImpulseMultiplier;
-                ABaseWeapon::GlobalAttackSpeedMultiplier =
-                    FoundData->Global_Weapon_AttackSpeedMultiplier;
-                ABaseWeapon::GlobalDurabilityReduction =
-                    FoundData->Global_Durability_Reduction;
-
-                // 2. 스태미나 관련 전역(static) 변수 업데이트
-                UStaminaComponent::Global_SprintDrainRate =
-                    FoundData->Global_Stamina_SprintDrainRate;
-                UStaminaComponent::Global_JumpCost = FoundData->Global_Stamina_JumpCost;
-                UStaminaComponent::Global_RegenRate =
-                    FoundData->Global_Stamina_RegenRate;
-
-                // 3. 맨손 공격 관련 전역 변수 업데이트
-                UBRAttackComponent::Global_BasePunchDamage =
-                    FoundData->Global_BasePunchDamage;
-
-                // 4. 플레이어 이동 관성 관련 전역 변수 업데이트
-                APlayerCharacter::Global_RotationRateYaw =
-                    FoundData->Global_Player_RotationRateYaw;
-                APlayerCharacter::Global_BrakingFriction =
-                    FoundData->Global_Player_BrakingFriction;
-                APlayerCharacter::Global_BrakingDecelerationWalking =
-                    FoundData->Global_Player_BrakingDecelerationWalking;
-
-                // 5. (핵심) 이미 소환된 캐릭터들에게도 즉시 적용 (실시간 리로드를 위해)
-                if (UWorld* World = GetWorld()) {
-                    // 캐릭터 및 스태미나, 이동 관성, 공격 업데이트
-                    for (TActorIterator<APlayerCharacter> It(World); It; ++It) {
-                        APlayerCharacter* PC = *It;
-
-                        // A. 스태미나 컴포넌트 업데이트
-                        if (UStaminaComponent* StaminaComp = PC->StaminaComp) {
-                            StaminaComp->StaminaDrainRate =
-                                UStaminaComponent::Global_SprintDrainRate;
-                            StaminaComp->JumpCost = UStaminaComponent::Global_JumpCost;
-                            StaminaComp->StaminaRegenRate =
-                                UStaminaComponent::Global_RegenRate;
-                        }
-
-                        // B. 캐릭터가 장착 중인 무기 업데이트
-                        if (ABaseWeapon* CharacterWeapon = PC->CurrentWeapon) {
-                            // 내구도 감소량 등 인스턴스 변수 갱신
-                            CharacterWeapon->DurabilityReduction =
-                                ABaseWeapon::GlobalDurabilityReduction;
-                        }
-
-                        // C. 플레이어 이동(관성) 업데이트
-                        if (UCharacterMovementComponent* MovementComp = PC->GetCharacterMovement()) {
-                            MovementComp->RotationRate = FRotator(0.0f, APlayerCharacter::Global_RotationRateYaw, 0.0f);
-                            MovementComp->BrakingFriction = APlayerCharacter::Global_BrakingFriction;
-                            MovementComp->BrakingDecelerationWalking = APlayerCharacter::Global_BrakingDecelerationWalking;
-                        }
-
-                    }
-
-                    // 바닥에 떨어져 있는(장착되지 않은) 무기들도 업데이트
-                    for (TActorIterator<ABaseWeapon> It(World); It; ++It) {
-                        ABaseWeapon* Weapon = *It;
-                        Weapon->DurabilityReduction =
-                            ABaseWeapon::GlobalDurabilityReduction;
-                    }
-                }
+  // 클라이언트는 서버가 발행해 GameState로 복제한 스냅샷을 사용 (로컬 JSON으로
+  // 덮어쓰지 않음)
+  if (const UWorld *World = GetWorld()) {
+    if (World->GetNetMode() == NM_Client) {
+      return;
+    }
+  }
 
-                // 앞으로 스폰될 캐릭터를 위한 CDO(Class Default Object) 업데이트
-                if (APlayerCharacter* DefaultPlayerChar = GetMutableDefault<APlayerCharacter>()) {
-                    if (UCharacterMovementComponent* DefaultMovementComp = DefaultPlayerChar->GetCharacterMovement()) {
-                        DefaultMovementComp->RotationRate = FRotator(0.0f, APlayerCharacter::Global_RotationRateYaw, 0.0f);
-                        DefaultMovementComp->BrakingFriction = APlayerCharacter::Global_BrakingFriction;
-                        DefaultMovementComp->BrakingDecelerationWalking = APlayerCharacter::Global_BrakingDecelerationWalking;
-                    }
-                }
+  UDataTable *GlobalTable = ConfigDataMap.FindRef(TEXT("GlobalSettings"));
+  if (!GlobalTable) {
+    return;
+  }
 
-                GI_LOG(Display,
-                    TEXT("스태미나 세팅 적용. Stamina: Drain(%.1f), Jump(%.1f), "
-                        "Regen(%.1f)"),
-                    UStaminaComponent::Global_SprintDrainRate,
-                    UStaminaComponent::Global_JumpCost,
-                    UStaminaComponent::Global_RegenRate);
-
-                GI_LOG(Display,
-                    TEXT("무기 배율 세팅 적용. Weapon: Damage(%.1f), Impulse(%.1f), "
-                        "AttackSpeed(%.1f)"),
-                    ABaseWeapon::GlobalDamageMultiplier,
-                    ABaseWeapon::GlobalImpulseMultiplier,
-                    ABaseWeapon::GlobalAttackSpeedMultiplier);
-
-                GI_LOG(Display,
-                    TEXT("맨손 공격 및 플레이어 이동 세팅 적용. PunchDamage(%.1f), "
-                        "Rotation(%.1f), Friction(%.1f), Deceleration(%.1f)"),
-                    UBRAttackComponent::Global_BasePunchDamage,
-                    APlayerCharacter::Global_RotationRateYaw,
-                    APlayerCharacter::Global_BrakingFriction,
-                    APlayerCharacter::Global_BrakingDecelerationWalking);
-            }
-        }
-    }
+  static const FString ContextString(TEXT("Global Settings Context"));
+  const FGlobalBalanceData *FoundData =
+      GlobalTable->FindRow<FGlobalBalanceData>(FName("Default"), ContextString);
+  if (!FoundData) {
+    return;
+  }
+
+  // 새 불변 스냅샷 발행 → 구독 중인 캐릭터/무기/컴포넌트가 버전이 바뀐 경우에만
+  // 파생 값을 갱신하고, 서버 GameState가 클라이언트로 복제함
+  if (UBRBalanceSubsystem *Balance = GetSubsystem<UBRBalanceSubsystem>()) {
+    Balance->Publish(*FoundData);
+  }
 }
 
 void UBRGameInstance::DoPIEExitCleanup(UWorld *World) {
@@ -7,16 +7,15 @@
 #include "BRGameInstance.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
+#include "Engine/NetDriver.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
 #include "UpperBodyPawn.h"
 #include "PlayerCharacter.h"
+#include "BRActorRegistrySubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "NavigationSystem.h"
 #include "Algo/Sort.h"
 #include "TimerManager.h"
-#include "AssetRegistry/AssetRegistryModule.h"
-#include "AssetRegistry/IAssetRegistry.h"
 #include "Misc/Paths.h"
 #include "OnlineSubsystemTypes.h"
 
@@ -41,52 +40,70 @@ void ABRGameMode::ClearGameSessionForPIEExit()
 
 TArray<FString> ABRGameMode::GetAvailableStageMapPaths() const
 {
-	// 개별 맵 목록이 있으면 그대로 사용 → 이 중에서 랜덤 선택
-	if (StageMapPathsFallback.Num() > 0)
+	UBRStageCatalogSubsystem* Catalog = UBRStageCatalogSubsystem::Get(this);
+	if (!Catalog)
 	{
-		UE_LOG(LogTemp, Log, TEXT("[Stage 맵] 맵 목록 사용: %d개 (랜덤 선택 대상)"), StageMapPathsFallback.Num());
 		return StageMapPathsFallback;
 	}
+	Catalog->EnsureBuilt(StageFolderPath, StageMapPathsFallback, StagePlayerRanges);
+	return Catalog->GetStagePackageNames();
+}
 
-	// 목록이 비어 있을 때만 Stage 폴더 스캔
-	TArray<FString> Result;
-	if (StageFolderPath.IsEmpty())
-	{
-		return Result;
+FString ABRGameMode::SelectStageMapPath() const
+{
+	// 맵 선택: Stage 카탈로그에서 현재 인원에 맞고 최근에 하지 않은 맵 위주로 가중 랜덤 (카탈로그가 비면 GameMapPath)
+	UBRStageCatalogSubsystem* Catalog = UBRStageCatalogSubsystem::Get(this);
+	if (bUseRandomMap && Catalog)
+	{
+		Catalog->EnsureBuilt(StageFolderPath, StageMapPathsFallback, StagePlayerRanges);
+		const ABRGameState* BRGameState = GetGameState<ABRGameState>();
+		const int32 PlayerCount = BRGameState ? BRGameState->PlayerArray.Num() : GetNumPlayers();
+		const FString Picked = Catalog->PickStage(PlayerCount, MaxPlayers);
+		if (!Picked.IsEmpty())
+		{
+			UE_LOG(LogTemp, Log, TEXT("[게임 시작] 랜덤 맵 선택: %s (%d명, 후보 %d개)"), *Picked, PlayerCount, Catalog->GetEntries().Num());
+			return Picked;
+		}
 	}
+	UE_LOG(LogTemp, Log, TEXT("[게임 시작] 기본 맵 사용: %s"), *GameMapPath);
+	return GameMapPath;
+}
 
-	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
-	if (!AssetRegistry)
+bool ABRGameMode::IsLobbyMap() const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return false;
+	FString CurrentMapName = UGameplayStatics::GetCurrentLevelName(World, true);
+	if (CurrentMapName.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[Stage 맵] Asset Registry를 사용할 수 없습니다."));
-		return Result;
+		CurrentMapName = World->GetMapName();
+		CurrentMapName.RemoveFromStart(World->StreamingLevelsPrefix);
 	}
+	FString LobbyMapBase = LobbyMapPath.IsEmpty() ? TEXT("Main_Scene") : FPaths::GetBaseFilename(LobbyMapPath);
+	return CurrentMapName.Equals(LobbyMapBase, ESearchCase::IgnoreCase);
+}
 
-	TArray<FAssetData> AssetDataList;
-	const FName PackagePath(*StageFolderPath);
-	AssetRegistry->GetAssetsByPath(PackagePath, AssetDataList, true, false);
+void ABRGameMode::PrepareStageForStart()
+{
+	ABRGameState* BRGameState = GetGameState<ABRGameState>();
+	if (!HasAuthority() || !BRGameState || !BRGameState->PendingStageMapPath.IsEmpty() || !IsLobbyMap())
+		return;
 
-	const FTopLevelAssetPath WorldClassPath(TEXT("/Script/Engine"), TEXT("World"));
-	for (const FAssetData& AssetData : AssetDataList)
-	{
-		if (AssetData.AssetClassPath == WorldClassPath)
-		{
-			FString PackageName = AssetData.PackageName.ToString();
-			if (!PackageName.IsEmpty())
-			{
-				Result.Add(PackageName);
-			}
-		}
-	}
+	// 준비 완료 후 방장이 시작을 누르기까지의 대기 시간 동안 모두가 맵을 미리 올려 둠
+	const FString StageMapPath = SelectStageMapPath();
+	UE_LOG(LogTemp, Log, TEXT("[Stage 선행 로드] 시작 조건 충족 → 다음 Stage 확정: %s"), *StageMapPath);
+	BRGameState->SetPendingStageMapPath(StageMapPath);
+}
 
-	if (Result.Num() > 0)
+void ABRGameMode::InitGameState()
+{
+	Super::InitGameState();
+	// 로비 슬롯 수 설정 (PlayerArray 인덱스 대신 PlayerState로 자리를 기억하는 서버 슬롯 모델 구성)
+	if (ABRGameState* BRGameState = GetGameState<ABRGameState>())
 	{
-		UE_LOG(LogTemp, Log, TEXT("[Stage 맵] 폴더 스캔: %d개 맵 수집 (폴더: %s)"), Result.Num(), *StageFolderPath);
-		return Result;
+		BRGameState->ConfigureLobbySlots(LobbyEntrySlotCount, LobbyTeamCount);
 	}
-
-	UE_LOG(LogTemp, Warning, TEXT("[Stage 맵] 폴더에서 맵을 찾지 못했습니다. (폴더: %s)"), *StageFolderPath);
-	return Result;
 }
 
 void ABRGameMode::BeginPlay()
@@ -101,32 +118,33 @@ void ABRGameMode::BeginPlay()
 		BRGameState->MaxPlayers = MaxPlayers;
 	}
 
+	// Stage 카탈로그는 서버 시작 후 첫 맵에서 한 번만 구성 (이후 맵 선택은 스캔 없이 조회만)
+	if (HasAuthority())
+	{
+		if (UBRStageCatalogSubsystem* Catalog = UBRStageCatalogSubsystem::Get(this))
+		{
+			Catalog->EnsureBuilt(StageFolderPath, StageMapPathsFallback, StagePlayerRanges);
+		}
+	}
+
 	// 맵을 로비 없이 바로 실행한 경우(테스트): 로딩 창을 표시하지 않도록 플래그 설정 (블루프린트 로딩 위젯에서 bSkipLoadingScreen 확인)
 	if (BRGameState && GetWorld())
 	{
 		UBRGameInstance* GI = Cast<UBRGameInstance>(GetGameInstance());
-		FString CurrentMapName = UGameplayStatics::GetCurrentLevelName(GetWorld(), true);
-		if (CurrentMapName.IsEmpty())
-		{
-			CurrentMapName = GetWorld()->GetMapName();
-			CurrentMapName.RemoveFromStart(GetWorld()->StreamingLevelsPrefix);
-		}
-		FString LobbyMapBase = LobbyMapPath.IsEmpty() ? TEXT("Main_Scene") : FPaths::GetBaseFilename(LobbyMapPath);
-		const bool bIsLobbyMap = CurrentMapName.Equals(LobbyMapBase, ESearchCase::IgnoreCase);
-		if (!bIsLobbyMap && GI && !GI->GetPendingApplyRandomTeamRoles())
+		if (!IsLobbyMap() && GI && !GI->GetPendingApplyRandomTeamRoles())
 		{
 			BRGameState->bSkipLoadingScreen = true;
 			UE_LOG(LogTemp, Log, TEXT("[맵 직접 실행] 로딩 창 비표시 (bSkipLoadingScreen=true)"));
 		}
 	}
 
-	// 로비에서 랜덤 팀 배정 후 예약된 경우: 게임 맵 로드 후 플레이어 스폰이 끝날 때까지 지연 후 적용
-	// 플래그는 ApplyRoleChangesForRandomTeams에서만 클리어 (여기서 지우면 1.5초 후 타이머에서 진입 시 플래그가 false라 적용이 스킵됨)
+	// 로비에서 랜덤 팀 배정 후 이동한 경우: 역할 적용 배리어를 열어 전원 하체 빙의·확인 즉시 상체 적용
+	// 플래그는 순차 상체 스폰 완료 시에만 클리어 (배리어가 열리기 전에 도착한 OnPossess도 플래그로 배리어를 엶)
 	if (UBRGameInstance* GI = Cast<UBRGameInstance>(GetGameInstance()))
 	{
 		if (GI->GetPendingApplyRandomTeamRoles())
 		{
-			ScheduleInitialRoleApplyIfNeeded();
+			ApplyRoleChangesForRandomTeams();
 		}
 		else
 		{
@@ -158,20 +176,185 @@ void ABRGameMode::TryApplyDirectStartRolesFallback()
 
 	// 저장된 역할 없고 전원 하체 → 랜덤 팀 배정 후 저장·적용
 	BRGameState->AssignRandomTeams();
-	GI->SavePendingRolesForTravel(BRGameState);
+	GI->SaveTravelManifest(BRGameState);
 	GI->SetPendingApplyRandomTeamRoles(true);
 	UE_LOG(LogTemp, Warning, TEXT("[게임 맵 직접 실행] 팀/역할 미선택 → 자동 랜덤 팀 배정 후 상체/하체 적용"));
 	ApplyRoleChangesForRandomTeams();
 }
 
-void ABRGameMode::ScheduleInitialRoleApplyIfNeeded()
+void ABRGameMode::GenericPlayerInitialization(AController* C)
 {
-	if (bHasScheduledInitialRoleApply || !GetWorld()) return;
-	bHasScheduledInitialRoleApply = true;
-	// Stage02_Bushes 등 로딩이 느린 맵에서 하체 스폰이 늦는 현상 완화
-	const float InitialDelay = 2.0f;
-	GetWorld()->GetTimerManager().SetTimer(InitialRoleApplyTimerHandle, this, &ABRGameMode::ApplyRoleChangesForRandomTeams, InitialDelay, false);
-	UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] %.1f초 후 상체/하체 Pawn 적용 예정 (한 번만 예약)"), InitialDelay);
+	Super::GenericPlayerInitialization(C);
+
+	// PostLogin과 Seamless Travel(HandleSeamlessTravelPlayer) 모두 이 지점을 거친 뒤 HandleStartingNewPlayer에서 하체를 스폰
+	APlayerController* PC = Cast<APlayerController>(C);
+	if (!HasAuthority() || !PC || bRoleApplyBarrierReleased)
+		return;
+
+	FBRRoleApplyReadiness& Entry = FindOrAddRoleApplyReadiness(PC);
+	Entry.bJoined = true;
+	ABRPlayerState* BRPS = PC->GetPlayerState<ABRPlayerState>();
+	UBRGameInstance* GI = GetGameInstance<UBRGameInstance>();
+	if (BRPS && GI && GI->HasTravelManifest())
+	{
+		// UserUID/UniqueNetId 키로 O(1) 적용. 파트너 연결은 배리어 해제 시 ReconcileTravelManifest에서 한 번에
+		if (GI->ApplyTravelManifestEntry(BRPS))
+		{
+			Entry.bNeedsBody = BRPS->TeamNumber > 0;
+		}
+		else
+		{
+			Entry.bNeedsBody = false;
+			UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 입장 시 매니페스트 항목 없음: '%s' (UID='%s') → 대기열"), *BRPS->GetPlayerName(), *BRPS->UserUID);
+		}
+	}
+	Entry.bStateRestored = (BRPS != nullptr);
+	EvaluateRoleApplyBarrier();
+}
+
+void ABRGameMode::NotifyRoleApplyPawnPossessed(APlayerController* PC, APawn* Pawn)
+{
+	if (!HasAuthority() || !PC || !Pawn || bRoleApplyBarrierReleased)
+		return;
+
+	if (Pawn->IsA<APlayerCharacter>())
+	{
+		FBRRoleApplyReadiness& Entry = FindOrAddRoleApplyReadiness(PC);
+		Entry.bLowerPossessed = true;
+		// 리슨 서버 호스트는 AcknowledgePossession → ServerReportSpawnReady 경로가 없으므로 빙의가 곧 확인
+		if (PC->IsLocalController())
+			Entry.bClientAcked = true;
+	}
+
+	// Seamless Travel 후 게임 맵 GameMode BeginPlay가 플레이어 빙의보다 늦을 수 있음 → 첫 빙의 시점에 배리어 열기 (GI 플래그 없으면 무시됨)
+	if (!bRoleApplyBarrierOpen)
+		ApplyRoleChangesForRandomTeams();
+	else
+		EvaluateRoleApplyBarrier();
+}
+
+void ABRGameMode::NotifyRoleApplyClientAck(APlayerController* PC)
+{
+	if (!HasAuthority() || !PC || !PC->GetPawn())
+		return;
+
+	// 배리어 해제 후: 상체 스폰 스케줄러가 기다리는 팀의 상체 빙의 확인
+	if (bRoleApplyBarrierReleased)
+	{
+		for (FBRUpperBodySpawnTask& Task : UpperBodySpawnTasks)
+		{
+			if (Task.State != EBRUpperBodySpawnState::AwaitingAck || Task.UpperPawn.Get() != PC->GetPawn())
+				continue;
+			Task.State = EBRUpperBodySpawnState::Acked;
+			Task.AckTime = GetWorld()->GetTimeSeconds();
+			UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 팀 %d 상체 빙의 확인 (+%.0fms)"), Task.TeamNumber, (Task.AckTime - UpperBodySpawnStartTime) * 1000.0);
+			TickUpperBodySpawns();
+			break;
+		}
+		return;
+	}
+	if (!PC->GetPawn()->IsA<APlayerCharacter>())
+		return;
+
+	FBRRoleApplyReadiness& Entry = FindOrAddRoleApplyReadiness(PC);
+	Entry.bClientAcked = true;
+	EvaluateRoleApplyBarrier();
+}
+
+FBRRoleApplyReadiness& ABRGameMode::FindOrAddRoleApplyReadiness(APlayerController* PC)
+{
+	FBRRoleApplyReadiness& Entry = RoleApplyReadiness.FindOrAdd(PC);
+	Entry.LastEventTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	return Entry;
+}
+
+int32 ABRGameMode::CountConnectedPlayers() const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return 0;
+	int32 Count = 0;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (It->Get() && It->Get()->IsLocalController())
+			Count++;
+	}
+	if (UNetDriver* NetDriver = World->GetNetDriver())
+		Count += NetDriver->ClientConnections.Num();
+	return Count;
+}
+
+void ABRGameMode::OpenRoleApplyBarrier()
+{
+	if (bRoleApplyBarrierOpen || bRoleApplyBarrierReleased)
+		return;
+	UWorld* World = GetWorld();
+	if (!World)
+		return;
+	UBRGameInstance* GI = GetGameInstance<UBRGameInstance>();
+	if (!GI || !GI->GetPendingApplyRandomTeamRoles())
+		return;
+	if (!UpperBodyClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[랜덤 팀 적용] UpperBodyClass가 설정되지 않았습니다. BP_MainGameMode(또는 사용 중인 GameMode 블루프린트)에서 Upper Body Class에 BP_UpperBodyPawn을 할당하세요."));
+		return;
+	}
+
+	// 기대 인원: 로비에서 저장한 인원과 지금 이 맵으로 오고 있는 연결 수 중 큰 값. 이동 중 끊긴 인원은 Logout에서 빼고, 그래도 안 오면 안전장치 타임아웃
+	const int32 SavedCount = GI->GetTravelManifestCount();
+	const int32 ConnectedCount = CountConnectedPlayers();
+	RoleApplyExpectedPlayers = FMath::Max(SavedCount, ConnectedCount);
+	RoleApplyBarrierOpenTime = World->GetTimeSeconds();
+	bRoleApplyBarrierOpen = true;
+
+	World->GetTimerManager().SetTimer(RoleApplyBarrierTimeoutHandle, this, &ABRGameMode::OnRoleApplyBarrierTimeout, RoleApplyBarrierTimeout, false);
+	UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 역할 적용 배리어 시작: 기대 %d명 (저장 %d명, 연결 %d명), 이미 기록 %d명, 안전장치 %.0f초"),
+		RoleApplyExpectedPlayers, SavedCount, ConnectedCount, RoleApplyReadiness.Num(), RoleApplyBarrierTimeout);
+
+	EvaluateRoleApplyBarrier();
+}
+
+void ABRGameMode::EvaluateRoleApplyBarrier()
+{
+	if (!bRoleApplyBarrierOpen || bRoleApplyBarrierReleased)
+		return;
+
+	int32 NumReady = 0;
+	for (const TPair<TWeakObjectPtr<APlayerController>, FBRRoleApplyReadiness>& Pair : RoleApplyReadiness)
+	{
+		if (Pair.Key.IsValid() && Pair.Value.IsReady())
+			NumReady++;
+	}
+	if (NumReady >= RoleApplyExpectedPlayers)
+		ReleaseRoleApplyBarrier(false);
+}
+
+void ABRGameMode::OnRoleApplyBarrierTimeout()
+{
+	ReleaseRoleApplyBarrier(true);
+}
+
+APlayerController* ABRGameMode::FindRoleApplyController(const ABRPlayerState* PS) const
+{
+	if (!PS)
+		return nullptr;
+	for (const TPair<TWeakObjectPtr<APlayerController>, FBRRoleApplyReadiness>& Pair : RoleApplyReadiness)
+	{
+		APlayerController* PC = Pair.Key.Get();
+		if (PC && PC->PlayerState == PS)
+			return PC;
+	}
+	if (APlayerController* PC = Cast<APlayerController>(PS->GetOwningController()))
+		return PC;
+	// Seamless Travel 직후 서버에서 PC->PlayerState가 다른 객체를 가리킬 수 있음 → 이름으로 매칭
+	const FString TargetName = PS->GetPlayerName();
+	for (const TPair<TWeakObjectPtr<APlayerController>, FBRRoleApplyReadiness>& Pair : RoleApplyReadiness)
+	{
+		APlayerController* PC = Pair.Key.Get();
+		if (PC && PC->PlayerState && PC->PlayerState->GetPlayerName() == TargetName)
+			return PC;
+	}
+	return nullptr;
 }
 
 void ABRGameMode::PreLogin(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage)
@@ -241,12 +424,8 @@ void ABRGameMode::PostLogin(APlayerController* NewPlayer)
 		const bool bIsLocalPlayer = WorldForCheck && (WorldForCheck->GetNetMode() == NM_Standalone || NewPlayer->IsLocalController());
 		UBRGameInstance* GI = Cast<UBRGameInstance>(GetGameInstance());
 
-		// [UserInfo 보존] 게임 시작 Travel 직후 PostLogin인 경우 저장된 UserInfo 즉시 복원 (나머지는 RestorePendingRolesFromTravel에서)
-		bool bRestoredFromTravel = GI && GI->HasPendingUserInfoForIndex(CurrentPlayerIndex);
-		if (bRestoredFromTravel)
-		{
-			GI->RestoreUserInfoToPlayerStateForPostLogin(BRPS, CurrentPlayerIndex);
-		}
+		// [UserInfo 보존] 게임 시작 Travel 직후 PostLogin인 경우 매니페스트 항목은 GenericPlayerInitialization에서 이미 적용됨
+		const bool bRestoredFromTravel = GI && GI->FindTravelManifestEntry(BRPS) != nullptr;
 
 		// [보존] 플레이어 이름 설정 및 로그 (Travel 복원이 아닐 때만)
 		FString PlayerName = BRPS->GetPlayerName();
@@ -356,7 +535,7 @@ void ABRGameMode::PostLogin(APlayerController* NewPlayer)
 		}
 
 		// [A안] 새 접속자는 접속 순(0,1/2,3) 역할 할당 없이 대기열(관전)만. 팀/역할은 랜덤 버튼 또는 1P·2P 선택으로만 설정.
-		// Travel 복원 시에는 RestorePendingRolesFromTravel / RestoreUserInfoToPlayerStateForPostLogin에서 처리.
+		// Travel 복원 시에는 Travel 매니페스트(ApplyTravelManifestEntry / ReconcileTravelManifest)에서 처리.
 		if (!bRestoredFromTravel)
 		{
 			BRPS->SetTeamNumber(0);
@@ -485,6 +664,17 @@ void ABRGameMode::Logout(AController* Exiting)
 		}
 	}
 
+	// 역할 적용 배리어 대기 중 퇴장: 기대 인원에서 빼고 남은 인원으로 바로 다시 평가 (안전장치 타임아웃까지 기다리지 않음)
+	if (!bRoleApplyBarrierReleased)
+	{
+		RoleApplyReadiness.Remove(Cast<APlayerController>(Exiting));
+		if (bRoleApplyBarrierOpen)
+		{
+			RoleApplyExpectedPlayers = FMath::Max(0, RoleApplyExpectedPlayers - 1);
+			EvaluateRoleApplyBarrier();
+		}
+	}
+
 	Super::Logout(Exiting);
 
 	// 플레이어 목록 업데이트 및 역할 재할당 (즉시 실행, 타이머 없음)
@@ -529,88 +719,143 @@ void ABRGameMode::Logout(AController* Exiting)
 void ABRGameMode::ApplyRoleChangesForRandomTeams()
 {
 	if (!HasAuthority()) return;
-	// 순차 스폰 진행 중엔 재진입 금지 (OnPossess 등 다른 타이머가 Staged 상태를 덮어쓰지 않도록)
-	if (StagedNumTeams > 0)
-		return;
-	if (!UpperBodyClass)
-	{
-		UE_LOG(LogTemp, Error, TEXT("[랜덤 팀 적용] UpperBodyClass가 설정되지 않았습니다. BP_MainGameMode(또는 사용 중인 GameMode 블루프린트)에서 Upper Body Class에 BP_UpperBodyPawn을 할당하세요."));
+	// 이미 배리어가 열려 있으면(대기 중이거나 상체 스폰 중) 재진입 금지
+	if (bRoleApplyBarrierOpen)
 		return;
-	}
+	OpenRoleApplyBarrier();
+}
 
-	UBRGameInstance* GI = Cast<UBRGameInstance>(GetGameInstance());
-	if (!GI || !GI->GetPendingApplyRandomTeamRoles())
+void ABRGameMode::ReleaseRoleApplyBarrier(bool bTimedOut)
+{
+	UWorld* World = GetWorld();
+	if (!World || bRoleApplyBarrierReleased)
 		return;
+	bRoleApplyBarrierReleased = true;
+	World->GetTimerManager().ClearTimer(RoleApplyBarrierTimeoutHandle);
+
+	int32 NumReady = 0;
+	for (const TPair<TWeakObjectPtr<APlayerController>, FBRRoleApplyReadiness>& Pair : RoleApplyReadiness)
+	{
+		const APlayerController* PC = Pair.Key.Get();
+		if (!PC) continue;
+		const FBRRoleApplyReadiness& Entry = Pair.Value;
+		if (Entry.IsReady())
+		{
+			NumReady++;
+			continue;
+		}
+		UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 배리어 미준비: %s | 입장=%d 복원=%d 하체빙의=%d 확인=%d"),
+			PC->PlayerState ? *PC->PlayerState->GetPlayerName() : *PC->GetName(),
+			Entry.bJoined ? 1 : 0, Entry.bStateRestored ? 1 : 0, Entry.bLowerPossessed ? 1 : 0, Entry.bClientAcked ? 1 : 0);
+	}
+	const double WaitMs = (World->GetTimeSeconds() - RoleApplyBarrierOpenTime) * 1000.0;
+	if (bTimedOut)
+		UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 배리어 타임아웃(%.0f초) → 현재 인원으로 진행 (준비 %d/%d명)"), RoleApplyBarrierTimeout, NumReady, RoleApplyExpectedPlayers);
+	else
+		UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 배리어 통과: 전원 준비 %d/%d명, 대기 %.0fms"), NumReady, RoleApplyExpectedPlayers, WaitMs);
 
+	UBRGameInstance* GI = GetGameInstance<UBRGameInstance>();
 	ABRGameState* BRGameState = GetGameState<ABRGameState>();
-	if (!BRGameState)
+	if (!GI || !BRGameState)
 		return;
-	// Seamless Travel 직후 2초 타이머가 클라이언트 재접속 전에 돌면 PlayerArray가 1명(호스트만) → 상체 적용 스킵 → 하체만 스폰. 2명 될 때까지 0.5초 간격 재시도
 	if (BRGameState->PlayerArray.Num() < 2)
 	{
-		if (MinPlayerWaitRetries >= MaxMinPlayerWaitRetries)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 플레이어 2명 대기 %d회 초과 → 상체/하체 적용 포기 (현재 %d명)"), MaxMinPlayerWaitRetries, BRGameState->PlayerArray.Num());
-			MinPlayerWaitRetries = 0;
-			return;
-		}
-		MinPlayerWaitRetries++;
-		FTimerHandle H;
-		GetWorld()->GetTimerManager().SetTimer(H, this, &ABRGameMode::ApplyRoleChangesForRandomTeams, 0.5f, false);
-		UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 플레이어 2명 대기 중 (현재 %d명), 0.5초 후 재시도 (%d/%d)"), BRGameState->PlayerArray.Num(), MinPlayerWaitRetries, MaxMinPlayerWaitRetries);
+		UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 플레이어 2명 미만 → 상체/하체 적용 포기 (현재 %d명)"), BRGameState->PlayerArray.Num());
+		// 포기해도 대기 플래그·매니페스트를 남기면 다음 Travel에서 지난 매치 역할이 다시 적용됨
+		GI->ClearPendingApplyRandomTeamRoles();
+		GI->ClearTravelManifest();
 		return;
 	}
-	MinPlayerWaitRetries = 0;
 
-	// 저장된 인원 수만큼 플레이어가 다 들어올 때까지 짧게 대기 (전원 하체로 나오는 현상 방지). 최대 재시도 후에는 현재 인원으로 진행
-	const int32 ExpectedCount = GI->GetPendingRoleRestoreCount();
-	const int32 CurrentNum = BRGameState->PlayerArray.Num();
-	if (ExpectedCount > 0 && CurrentNum < ExpectedCount)
+	// 플래그는 순차 상체 스폰 완료 시에만 클리어
+	UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 배리어 해제 → 상체/하체 Pawn 적용"));
+
+	// 입장 시 적용 못한 인원 적용 + 파트너를 UID로 현재 PlayerArray 인덱스에 연결 (Travel 후 접속 순서가 바뀌어도 유지)
+	GI->ReconcileTravelManifest(BRGameState);
+	// [진단] 복원 직후 팀/플레이어 인덱스·역할
+	for (int32 i = 0; i < BRGameState->PlayerArray.Num(); i++)
 	{
-		if (InitialPlayerWaitRetries >= MaxInitialPlayerWaitRetries)
+		if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(BRGameState->PlayerArray[i]))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 플레이어 대기 %d회 초과 → 현재 인원(%d명)으로 상체/하체 적용 진행 (하체만 스폰 방지)"), MaxInitialPlayerWaitRetries, CurrentNum);
-			InitialPlayerWaitRetries = 0;
-		}
-		else
-		{
-			InitialPlayerWaitRetries++;
-			FTimerHandle H;
-			GetWorld()->GetTimerManager().SetTimer(H, this, &ABRGameMode::ApplyRoleChangesForRandomTeams, 0.5f, false);
-			UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 플레이어 대기 중 (%d/%d), 0.5초 후 재시도 (%d/%d)"), CurrentNum, ExpectedCount, InitialPlayerWaitRetries, MaxInitialPlayerWaitRetries);
-			return;
+			UE_LOG(LogTemp, Log, TEXT("[진단] 복원후 PlayerArray[%d] %s | TeamNumber=%d | %s | ConnectedIdx=%d"),
+				i, *BRPS->GetPlayerName(), BRPS->TeamNumber, BRPS->bIsLowerBody ? TEXT("하체") : TEXT("상체"), BRPS->ConnectedPlayerIndex);
 		}
 	}
-	else if (ExpectedCount == 0 && CurrentNum == 2)
+
+	// 배리어 해제 시 한 번만 팀 목록 구성. 대기열·관전(TeamNumber<=0) 제외, 팀에 배정된 플레이어만 수집 후 팀 순서 + 팀 내 하체 먼저로 정렬
+	TArray<ABRPlayerState*> SortedByTeam;
+	for (APlayerState* PS : BRGameState->PlayerArray)
 	{
-		// 저장 인원 수가 0(예: PIE GI 비어 있음)이면 2명에서 바로 진행 → 1팀만 적용 후 3·4번째가 들어오면 전부 하체로 남음. 2명일 때만 3초 더 대기
-		if (ExpectedZeroWaitRetries < MaxExpectedZeroWaitRetries)
+		if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(PS))
 		{
-			ExpectedZeroWaitRetries++;
-			FTimerHandle H;
-			GetWorld()->GetTimerManager().SetTimer(H, this, &ABRGameMode::ApplyRoleChangesForRandomTeams, 0.5f, false);
-			UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 저장 인원 없음·현재 2명 → 4명 올 때까지 0.5초 후 재시도 (%d/%d)"), ExpectedZeroWaitRetries, MaxExpectedZeroWaitRetries);
-			return;
+			if (BRPS->bIsSpectatorSlot || BRPS->TeamNumber <= 0) continue; // 관전·대기열 제외
+			SortedByTeam.Add(BRPS);
 		}
-		ExpectedZeroWaitRetries = 0;
 	}
-	else
+	Algo::Sort(SortedByTeam, [](const ABRPlayerState* A, const ABRPlayerState* B)
 	{
-		InitialPlayerWaitRetries = 0;
-		ExpectedZeroWaitRetries = 0;
-	}
-
-	// 플래그는 하체 Pawn 확인 통과 후에만 클리어 (Pawn 없이 재시도할 때 플래그 유지)
-	UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] ApplyRoleChangesForRandomTeams 진입 (상체/하체 Pawn 적용)"));
+		if (A->TeamNumber != B->TeamNumber) return A->TeamNumber < B->TeamNumber;
+		return A->bIsLowerBody && !B->bIsLowerBody; // 하체 먼저
+	});
+	int32 NumPlayersInTeams = SortedByTeam.Num();
+	int32 NumTeams = NumPlayersInTeams / 2;
+	const int32 ExpectedLowerCount = ABRGameMode::GetExpectedLowerBodyCount(NumPlayersInTeams);
+	const int32 ExpectedUpperCount = ABRGameMode::GetExpectedUpperBodyCount(NumPlayersInTeams);
 
-	// '전체 하체 Pawn 대기' 재진입 시에는 역할 복원/재계산 스킵 (이미 복원된 역할이 덮어씌워져 전원 하체가 되는 것 방지)
-	const bool bIsRetryWaitingForLowerPawns = (StagedAllLowerReadyRetries > 0);
-	if (!bIsRetryWaitingForLowerPawns)
+	// [진단] SortedByTeam 구성 결과 (팀 배정 인원만, 관전 제외) + 고정 스폰 수
+	UE_LOG(LogTemp, Log, TEXT("[진단] 팀 배정 인원(관전 제외): %d명, 팀 수 %d (고정: 하체 %d명, 상체 %d명)"), NumPlayersInTeams, NumTeams, ExpectedLowerCount, ExpectedUpperCount);
+	for (int32 i = 0; i < SortedByTeam.Num(); i++)
 	{
-		// Seamless Travel 후 PlayerState가 초기화될 수 있으므로, 저장해 둔 팀/역할을 복원
-		GI->RestorePendingRolesFromTravel(BRGameState);
+		if (const ABRPlayerState* PS = SortedByTeam[i])
+		{
+			UE_LOG(LogTemp, Log, TEXT("[진단]   Sorted[%d] 팀%d %s %s"), i, PS->TeamNumber, PS->bIsLowerBody ? TEXT("하체") : TEXT("상체"), *PS->GetPlayerName());
+		}
+	}
 
-		// 복원된 ConnectedPlayerIndex는 로비 시점 PlayerArray 기준이므로, 현재 배열 기준으로 파트너 인덱스 재계산 (Travel 후 접속 순서 변경 시 잘못된 참조 방지)
+	// [안전장치] 팀에 배정된 사람이 없거나, 일부만 팀 배정됐거나, 역할 분포/팀별 쌍이 잘못된 경우 게임 맵에서 랜덤 팀/역할 재배정
+	// (총 4명인데 팀 배정 2명이면 팀 수 1 → 상체 1명만 스폰 → 하체3+상체1 현상)
+	int32 TotalBRPS = 0;
+	for (APlayerState* PS : BRGameState->PlayerArray) { if (Cast<ABRPlayerState>(PS)) TotalBRPS++; }
+	// 팀 미배정 인원이 있으면(복원 실패 등) 전원 팀 배정 → 하체/상체 수를 고정 규칙대로 맞춤
+	const bool bSomeNotInTeam = (TotalBRPS >= 2 && (TotalBRPS % 2 == 0) && NumPlayersInTeams < TotalBRPS);
+	int32 UpperCountInSorted = 0;
+	int32 LowerCountInSorted = 0;
+	for (const ABRPlayerState* PS : SortedByTeam)
+	{
+		if (PS && !PS->bIsLowerBody) UpperCountInSorted++;
+		else if (PS) LowerCountInSorted++;
+	}
+	// 고정 규칙: 플레이어 수에 따라 상체/하체 수는 반드시 N/2 each
+	const bool bCountMismatch = (UpperCountInSorted != ExpectedUpperCount) || (LowerCountInSorted != ExpectedLowerCount);
+	bool bTeamPairInvalid = false;
+	for (int32 t = 0; t < NumTeams; t++)
+	{
+		ABRPlayerState* Lower = SortedByTeam.IsValidIndex(2 * t) ? SortedByTeam[2 * t] : nullptr;
+		ABRPlayerState* Upper = SortedByTeam.IsValidIndex(2 * t + 1) ? SortedByTeam[2 * t + 1] : nullptr;
+		if (!Lower || !Upper || !Lower->bIsLowerBody || Upper->bIsLowerBody)
+		{
+			bTeamPairInvalid = true;
+			UE_LOG(LogTemp, Warning, TEXT("[진단] 팀 %d 역할 쌍 이상: 하체슬롯=%s(%d) 상체슬롯=%s(%d) → 랜덤 재배정 필요"),
+				t + 1, Lower ? *Lower->GetPlayerName() : TEXT("없음"), Lower ? (Lower->bIsLowerBody ? 1 : 0) : -1,
+				Upper ? *Upper->GetPlayerName() : TEXT("없음"), Upper ? (Upper->bIsLowerBody ? 1 : 0) : -1);
+			break;
+		}
+	}
+	const bool bNeedRandomAssign = (NumTeams < 1 && TotalBRPS >= 2)
+		|| bSomeNotInTeam
+		|| (NumPlayersInTeams >= 2 && (bCountMismatch || bTeamPairInvalid));
+	if (bNeedRandomAssign)
+	{
+		if (bSomeNotInTeam)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 팀 미배정 인원 있음(전체 %d명 중 팀 배정 %d명) → 전원 팀/역할 재배정 (하체3+상체1 방지)"), TotalBRPS, NumPlayersInTeams);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 역할/팀 배정 없음 또는 분포/팀쌍 이상(현재 하체%d 상체%d, 고정 규칙 하체%d 상체%d) → 게임 맵에서 랜덤 팀/역할 재배정"), LowerCountInSorted, UpperCountInSorted, ExpectedLowerCount, ExpectedUpperCount);
+		}
+		UE_LOG(LogTemp, Warning, TEXT("[진단] 하체3+상체1 원인: 팀 미배정 또는 팀별 하체1+상체1 아님 → 안전장치로 랜덤 재배정 실행"));
+		BRGameState->AssignRandomTeams();
 		for (int32 i = 0; i < BRGameState->PlayerArray.Num(); i++)
 		{
 			ABRPlayerState* BRPS = Cast<ABRPlayerState>(BRGameState->PlayerArray[i]);
@@ -625,397 +870,267 @@ void ABRGameMode::ApplyRoleChangesForRandomTeams()
 			}
 			BRPS->SetPlayerRole(BRPS->bIsLowerBody, PartnerIndex);
 		}
-		// [진단] 복원 직후 팀/플레이어 인덱스·역할
-		for (int32 i = 0; i < BRGameState->PlayerArray.Num(); i++)
-		{
-			if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(BRGameState->PlayerArray[i]))
-			{
-				UE_LOG(LogTemp, Log, TEXT("[진단] 복원후 PlayerArray[%d] %s | TeamNumber=%d | %s | ConnectedIdx=%d"),
-					i, *BRPS->GetPlayerName(), BRPS->TeamNumber, BRPS->bIsLowerBody ? TEXT("하체") : TEXT("상체"), BRPS->ConnectedPlayerIndex);
-			}
-		}
-	}
-
-	UWorld* World = GetWorld();
-	if (!World) return;
-
-	// '하체 Pawn 대기' 재진입 시: 팀 목록을 첫 진입 시 스냅샷으로 고정 (재진입 시 PlayerArray 기준으로 다시 만들면 일부가 TeamNumber 0으로 바뀌어 3명만 남아 하체3+상체1 발생)
-	TArray<ABRPlayerState*> SortedByTeam;
-	int32 NumPlayersInTeams = 0;
-	int32 NumTeams = 0;
-	if (bIsRetryWaitingForLowerPawns && PendingSortedByTeamSnapshot.Num() > 0)
-	{
-		SortedByTeam = PendingSortedByTeamSnapshot;
-		NumPlayersInTeams = SortedByTeam.Num();
-		NumTeams = NumPlayersInTeams / 2;
-		UE_LOG(LogTemp, Log, TEXT("[진단] 재진입: 저장된 팀 스냅샷 사용 %d명 (하체 Pawn 대기 재시도 중 팀 수 고정)"), NumPlayersInTeams);
-	}
-	else
-	{
-		PendingSortedByTeamSnapshot.Empty();
-		// 대기열·관전(TeamNumber<=0) 제외, 팀에 배정된 플레이어만 수집 후 팀 순서 + 팀 내 하체 먼저로 정렬
+		SortedByTeam.Empty();
 		for (APlayerState* PS : BRGameState->PlayerArray)
 		{
 			if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(PS))
 			{
-				if (BRPS->bIsSpectatorSlot || BRPS->TeamNumber <= 0) continue; // 관전·대기열 제외
+				if (BRPS->bIsSpectatorSlot || BRPS->TeamNumber <= 0) continue;
 				SortedByTeam.Add(BRPS);
 			}
 		}
 		Algo::Sort(SortedByTeam, [](const ABRPlayerState* A, const ABRPlayerState* B)
 		{
 			if (A->TeamNumber != B->TeamNumber) return A->TeamNumber < B->TeamNumber;
-			return A->bIsLowerBody && !B->bIsLowerBody; // 하체 먼저
+			return A->bIsLowerBody && !B->bIsLowerBody;
 		});
 		NumPlayersInTeams = SortedByTeam.Num();
 		NumTeams = NumPlayersInTeams / 2;
 	}
-	const int32 ExpectedLowerCount = ABRGameMode::GetExpectedLowerBodyCount(NumPlayersInTeams);
-	const int32 ExpectedUpperCount = ABRGameMode::GetExpectedUpperBodyCount(NumPlayersInTeams);
-
-	// [진단] SortedByTeam 구성 결과 (팀 배정 인원만, 관전 제외) + 고정 스폰 수
-	UE_LOG(LogTemp, Log, TEXT("[진단] 팀 배정 인원(관전 제외): %d명, 팀 수 %d (고정: 하체 %d명, 상체 %d명)"), NumPlayersInTeams, NumTeams, ExpectedLowerCount, ExpectedUpperCount);
-	for (int32 i = 0; i < SortedByTeam.Num(); i++)
+	if (NumTeams < 1)
 	{
-		if (const ABRPlayerState* PS = SortedByTeam[i])
-		{
-			UE_LOG(LogTemp, Log, TEXT("[진단]   Sorted[%d] 팀%d %s %s"), i, PS->TeamNumber, PS->bIsLowerBody ? TEXT("하체") : TEXT("상체"), *PS->GetPlayerName());
-		}
+		GI->ClearPendingApplyRandomTeamRoles();
+		GI->ClearTravelManifest();
+		return;
 	}
 
-	// [안전장치] 팀에 배정된 사람이 없거나, 일부만 팀 배정됐거나, 역할 분포/팀별 쌍이 잘못된 경우 게임 맵에서 랜덤 팀/역할 재배정
-	// (총 4명인데 팀 배정 2명이면 팀 수 1 → 상체 1명만 스폰 → 하체3+상체1 현상)
-	if (!bIsRetryWaitingForLowerPawns)
-	{
-		int32 TotalBRPS = 0;
-		for (APlayerState* PS : BRGameState->PlayerArray) { if (Cast<ABRPlayerState>(PS)) TotalBRPS++; }
-		// 팀 미배정 인원이 있으면(복원 실패 등) 전원 팀 배정 → 하체/상체 수를 고정 규칙대로 맞춤
-		const bool bSomeNotInTeam = (TotalBRPS >= 2 && (TotalBRPS % 2 == 0) && NumPlayersInTeams < TotalBRPS);
-		int32 UpperCountInSorted = 0;
-		int32 LowerCountInSorted = 0;
-		for (const ABRPlayerState* PS : SortedByTeam)
+	// 하체 빙의·확인은 배리어에서 이미 완료 → 전 팀 상체를 한꺼번에 스폰
+	BeginUpperBodySpawns(SortedByTeam, NumTeams);
+}
+
+void ABRGameMode::BeginUpperBodySpawns(const TArray<ABRPlayerState*>& SortedByTeam, int32 NumTeams)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	const double Now = World->GetTimeSeconds();
+	UpperBodySpawnStartTime = Now;
+	UpperBodySpawnTasks.Reset(NumTeams);
+	for (int32 t = 0; t < NumTeams; t++)
+	{
+		ABRPlayerState* LowerPS = SortedByTeam.IsValidIndex(2 * t) ? SortedByTeam[2 * t] : nullptr;
+		ABRPlayerState* UpperPS = SortedByTeam.IsValidIndex(2 * t + 1) ? SortedByTeam[2 * t + 1] : nullptr;
+
+		FBRUpperBodySpawnTask& Task = UpperBodySpawnTasks.AddDefaulted_GetRef();
+		Task.TeamNumber = LowerPS ? LowerPS->TeamNumber : t + 1;
+		Task.LowerPS = LowerPS;
+		Task.UpperPS = UpperPS;
+		Task.DeadlineTime = Now;
+		if (!LowerPS || !UpperPS || !LowerPS->bIsLowerBody || UpperPS->bIsLowerBody)
 		{
-			if (PS && !PS->bIsLowerBody) UpperCountInSorted++;
-			else if (PS) LowerCountInSorted++;
-		}
-		// 고정 규칙: 플레이어 수에 따라 상체/하체 수는 반드시 N/2 each
-		const bool bCountMismatch = (UpperCountInSorted != ExpectedUpperCount) || (LowerCountInSorted != ExpectedLowerCount);
-		bool bTeamPairInvalid = false;
-		for (int32 t = 0; t < NumTeams; t++)
-		{
-			ABRPlayerState* Lower = SortedByTeam.IsValidIndex(2 * t) ? SortedByTeam[2 * t] : nullptr;
-			ABRPlayerState* Upper = SortedByTeam.IsValidIndex(2 * t + 1) ? SortedByTeam[2 * t + 1] : nullptr;
-			if (!Lower || !Upper || !Lower->bIsLowerBody || Upper->bIsLowerBody)
-			{
-				bTeamPairInvalid = true;
-				UE_LOG(LogTemp, Warning, TEXT("[진단] 팀 %d 역할 쌍 이상: 하체슬롯=%s(%d) 상체슬롯=%s(%d) → 랜덤 재배정 필요"),
-					t + 1, Lower ? *Lower->GetPlayerName() : TEXT("없음"), Lower ? (Lower->bIsLowerBody ? 1 : 0) : -1,
-					Upper ? *Upper->GetPlayerName() : TEXT("없음"), Upper ? (Upper->bIsLowerBody ? 1 : 0) : -1);
-				break;
-			}
-		}
-		const bool bNeedRandomAssign = (NumTeams < 1 && TotalBRPS >= 2)
-			|| bSomeNotInTeam
-			|| (NumPlayersInTeams >= 2 && (bCountMismatch || bTeamPairInvalid));
-		if (bNeedRandomAssign)
-		{
-			if (bSomeNotInTeam)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 팀 미배정 인원 있음(전체 %d명 중 팀 배정 %d명) → 전원 팀/역할 재배정 (하체3+상체1 방지)"), TotalBRPS, NumPlayersInTeams);
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 역할/팀 배정 없음 또는 분포/팀쌍 이상(현재 하체%d 상체%d, 고정 규칙 하체%d 상체%d) → 게임 맵에서 랜덤 팀/역할 재배정"), LowerCountInSorted, UpperCountInSorted, ExpectedLowerCount, ExpectedUpperCount);
-			}
-			UE_LOG(LogTemp, Warning, TEXT("[진단] 하체3+상체1 원인: 팀 미배정 또는 팀별 하체1+상체1 아님 → 안전장치로 랜덤 재배정 실행"));
-			BRGameState->AssignRandomTeams();
-			for (int32 i = 0; i < BRGameState->PlayerArray.Num(); i++)
-			{
-				ABRPlayerState* BRPS = Cast<ABRPlayerState>(BRGameState->PlayerArray[i]);
-				if (!BRPS || BRPS->bIsSpectatorSlot || BRPS->TeamNumber <= 0) continue;
-				int32 PartnerIndex = -1;
-				for (int32 j = 0; j < BRGameState->PlayerArray.Num(); j++)
-				{
-					if (i == j) continue;
-					ABRPlayerState* Other = Cast<ABRPlayerState>(BRGameState->PlayerArray[j]);
-					if (!Other || Other->TeamNumber != BRPS->TeamNumber) continue;
-					if (Other->bIsLowerBody != BRPS->bIsLowerBody) { PartnerIndex = j; break; }
-				}
-				BRPS->SetPlayerRole(BRPS->bIsLowerBody, PartnerIndex);
-			}
-			SortedByTeam.Empty();
-			for (APlayerState* PS : BRGameState->PlayerArray)
-			{
-				if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(PS))
-				{
-					if (BRPS->bIsSpectatorSlot || BRPS->TeamNumber <= 0) continue;
-					SortedByTeam.Add(BRPS);
-				}
-			}
-			Algo::Sort(SortedByTeam, [](const ABRPlayerState* A, const ABRPlayerState* B)
-			{
-				if (A->TeamNumber != B->TeamNumber) return A->TeamNumber < B->TeamNumber;
-				return A->bIsLowerBody && !B->bIsLowerBody;
-			});
-			NumPlayersInTeams = SortedByTeam.Num();
-			NumTeams = NumPlayersInTeams / 2;
+			UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 팀 %d 역할 불일치 - 스킵 (하체=%s bIsLowerBody=%d, 상체=%s bIsLowerBody=%d)"),
+				Task.TeamNumber, LowerPS ? *LowerPS->GetPlayerName() : TEXT("없음"), LowerPS ? (LowerPS->bIsLowerBody ? 1 : 0) : -1,
+				UpperPS ? *UpperPS->GetPlayerName() : TEXT("없음"), UpperPS ? (UpperPS->bIsLowerBody ? 1 : 0) : -1);
+			Task.State = EBRUpperBodySpawnState::Failed;
 		}
 	}
-	if (NumTeams < 1)
+	UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 상체 스폰 시작: %d팀 (프레임당 최대 %d팀, 확인 대기 %.1f초, 최대 %d회 시도)"),
+		NumTeams, MaxUpperBodySpawnsPerFrame, UpperBodyAckTimeout, MaxUpperBodySpawnAttempts);
+	TickUpperBodySpawns();
+}
+
+void ABRGameMode::TickUpperBodySpawns()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_TickUpperBodySpawns);
+	UWorld* World = GetWorld();
+	if (!World || UpperBodySpawnTasks.Num() == 0) return;
+
+	const double Now = World->GetTimeSeconds();
+	if (UpperBodySpawnFrame != GFrameCounter)
 	{
-		GI->ClearPendingApplyRandomTeamRoles();
-		GI->ClearPendingRoleRestoreData();
-		return;
+		UpperBodySpawnFrame = GFrameCounter;
+		UpperBodySpawnsThisFrame = 0;
 	}
 
-	// [강화] 전체 하체 Pawn이 준비될 때까지 대기 (로딩 빠른 맵에서 상체가 하체로 남는 현상 방지). Controller도 이름 fallback으로 검색
-	auto FindControllerForPS = [World](ABRPlayerState* PS) -> APlayerController*
+	bool bAllDone = true;
+	for (FBRUpperBodySpawnTask& Task : UpperBodySpawnTasks)
 	{
-		if (!PS) return nullptr;
-		APlayerController* PC = Cast<APlayerController>(PS->GetOwningController());
-		if (PC) return PC;
-		const FString TargetName = PS->GetPlayerName();
-		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		if (Task.State == EBRUpperBodySpawnState::AwaitingAck && Now >= Task.DeadlineTime)
 		{
-			APlayerController* C = It->Get();
-			if (!C) continue;
-			if (C->GetPlayerState<APlayerState>() == PS) return C;
-			if (APlayerState* OtherPS = C->GetPlayerState<APlayerState>())
+			// 상체가 그대로 빙의돼 있으면 ClientRestart만 다시 보내 확인 재요청, 아니면 다시 스폰
+			AUpperBodyPawn* Upper = Task.UpperPawn.Get();
+			APlayerController* UpperPC = FindRoleApplyController(Task.UpperPS.Get());
+			if (Upper && UpperPC && UpperPC->GetPawn() == Upper && Task.Attempts < MaxUpperBodySpawnAttempts)
 			{
-				if (OtherPS->GetPlayerName() == TargetName) return C;
+				Task.Attempts++;
+				Task.DeadlineTime = Now + UpperBodyAckTimeout;
+				UpperPC->ClientRestart(Upper);
+				UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 팀 %d 상체 빙의 확인 없음 → ClientRestart 재전송 (%d/%d)"), Task.TeamNumber, Task.Attempts, MaxUpperBodySpawnAttempts);
 			}
-		}
-		return nullptr;
-	};
-	constexpr int32 MaxAllLowerReadyRetries = 20;  // 최대 6초 대기 (0.3초 × 20)
-	for (int32 i = 0; i < NumTeams; i++)
-	{
-		ABRPlayerState* LowerPS = SortedByTeam.IsValidIndex(2 * i) ? SortedByTeam[2 * i] : nullptr;
-		if (!LowerPS || !LowerPS->bIsLowerBody) continue;
-		APlayerController* LowerPC = FindControllerForPS(LowerPS);
-		if (!LowerPC)
-		{
-			// 팀2 등 원격 플레이어 Controller가 아직 없으면 스킵하지 말고 대기 (그래야 이후 팀2 상체 스폰 가능)
-			if (StagedAllLowerReadyRetries < MaxAllLowerReadyRetries)
+			else
 			{
-				StagedAllLowerReadyRetries++;
-				PendingSortedByTeamSnapshot = SortedByTeam;
-				World->GetTimerManager().SetTimer(StagedAllLowerReadyHandle, this, &ABRGameMode::ApplyRoleChangesForRandomTeams, 0.3f, false);
-				UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 전체 하체 Pawn 대기 중 — 팀 %d Controller 없음 (%d/%d), 0.3초 후 재시도"), i + 1, StagedAllLowerReadyRetries, MaxAllLowerReadyRetries);
-				return;
+				HandleUpperBodySpawnFailure(Task, Now, TEXT("빙의 확인 시간 초과"));
 			}
-			UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 전체 하체 Pawn 대기 실패(팀 %d Controller 미등장), 팀 %d 스킵 가능"), i + 1, i + 1);
-			PendingSortedByTeamSnapshot.Empty();
-			break;
 		}
-		APlayerCharacter* LowerChar = Cast<APlayerCharacter>(LowerPC->GetPawn());
-		if (!LowerChar || !IsValid(LowerChar))
+		if (Task.State == EBRUpperBodySpawnState::Pending && Now >= Task.DeadlineTime && UpperBodySpawnsThisFrame < MaxUpperBodySpawnsPerFrame)
 		{
-			if (StagedAllLowerReadyRetries < MaxAllLowerReadyRetries)
-			{
-				StagedAllLowerReadyRetries++;
-				// 재진입 시 팀 수가 바뀌지 않도록 현재 SortedByTeam 스냅샷 저장 (재진입 시 일부가 TeamNumber 0으로 바뀌면 3명만 남아 하체3+상체1 발생)
-				PendingSortedByTeamSnapshot = SortedByTeam;
-				World->GetTimerManager().SetTimer(StagedAllLowerReadyHandle, this, &ABRGameMode::ApplyRoleChangesForRandomTeams, 0.3f, false);
-				UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 전체 하체 Pawn 대기 중 (%d/%d), 0.3초 후 재시도 (팀 스냅샷 %d명 저장)"), StagedAllLowerReadyRetries, MaxAllLowerReadyRetries, PendingSortedByTeamSnapshot.Num());
-				return;
-			}
-			UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 전체 하체 Pawn 대기 실패(재시도 %d회 초과), 팀 %d 스킵 가능"), MaxAllLowerReadyRetries, i + 1);
-			PendingSortedByTeamSnapshot.Empty();
-			break;
+			UpperBodySpawnsThisFrame++;
+			IssueUpperBodySpawn(Task, Now);
 		}
+		if (Task.State == EBRUpperBodySpawnState::Pending || Task.State == EBRUpperBodySpawnState::AwaitingAck)
+			bAllDone = false;
 	}
-	StagedAllLowerReadyRetries = 0;
-	PendingSortedByTeamSnapshot.Empty(); // 하체 대기 통과 또는 실패 후 스냅샷 해제
-
-	// 순차 스폰: 1팀 하체 확인 → 1팀 상체 스폰 → 2팀 하체 확인 → 2팀 상체 스폰 … (앞사람이 전부 정상 스폰된 뒤 다음으로 진행)
-	// 기존 순차 스폰 타이머가 있으면 취소
-	World->GetTimerManager().ClearTimer(StagedApplyTimerHandle);
-	World->GetTimerManager().ClearTimer(StagedAllLowerReadyHandle);
-	StagedSortedByTeam = SortedByTeam;
-	StagedNumTeams = NumTeams;
-	StagedCurrentTeamIndex = 0;
-	StagedPawnWaitRetriesForTeam = 0;
-	StagedControllerWaitRetriesForTeam = 0;
-	StagedUpperBodiesSpawnedCount = 0;
-	ApplyRoleChangesForRandomTeams_ApplyOneTeam();
+
+	if (bAllDone)
+		FinishUpperBodySpawns();
+	else
+		ScheduleUpperBodySpawnTick(Now);
 }
 
-void ABRGameMode::ApplyRoleChangesForRandomTeams_ApplyOneTeam()
+void ABRGameMode::IssueUpperBodySpawn(FBRUpperBodySpawnTask& Task, double Now)
 {
-	if (!HasAuthority() || !GetWorld()) return;
-
 	UWorld* World = GetWorld();
-	if (StagedCurrentTeamIndex >= StagedNumTeams)
+	Task.Attempts++;
+	if (Task.FirstIssueTime < 0.0)
+		Task.FirstIssueTime = Now;
+
+	// 하체 빙의·클라이언트 확인은 배리어에서 끝났으므로 보통 바로 찾음. 배리어 타임아웃 등으로 없으면 이 팀만 재시도
+	APlayerController* LowerPC = FindRoleApplyController(Task.LowerPS.Get());
+	APlayerController* UpperPC = FindRoleApplyController(Task.UpperPS.Get());
+	APlayerCharacter* LowerChar = LowerPC ? Cast<APlayerCharacter>(LowerPC->GetPawn()) : nullptr;
+	if (!World || !LowerPC || !UpperPC || !IsValid(LowerChar))
+	{
+		const FString Reason = FString::Printf(TEXT("준비 안 됨 (하체 Controller=%s 상체 Controller=%s 하체 Pawn=%s)"),
+			LowerPC ? TEXT("O") : TEXT("X"), UpperPC ? TEXT("O") : TEXT("X"), IsValid(LowerChar) ? TEXT("O") : TEXT("X"));
+		HandleUpperBodySpawnFailure(Task, Now, *Reason);
+		return;
+	}
+
+	// 이전 시도에서 스폰했지만 빙의/확인에 실패한 상체 정리
+	if (AUpperBodyPawn* PrevUpper = Task.UpperPawn.Get())
 	{
-		if (UBRGameInstance* GI = GetGameInstance<UBRGameInstance>())
-		{
-			GI->ClearPendingApplyRandomTeamRoles();
-			GI->ClearPendingRoleRestoreData();
-		}
-		if (StagedUpperBodiesSpawnedCount == 0)
-			UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 순차 상체 스폰 완료 but 상체 0명 스폰됨 (하체만 스폰된 상태일 수 있음)"));
-		UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 순차 상체 스폰 완료 (고정 규칙: 하체 %d명, 상체 %d명 / 실제 상체 스폰 %d명)"), StagedNumTeams, StagedNumTeams, StagedUpperBodiesSpawnedCount);
+		PrevUpper->Destroy();
+		Task.UpperPawn.Reset();
+	}
 
-		if (ABRGameState* BRGS = GetGameState<ABRGameState>())
-		{
-			BRGS->bBodyAssignmentComplete = true;
-			BRGS->OnBodyAssignmentComplete.Broadcast();
-			// 전원 스폰 완료 신호를 기다림. ReportClientSpawnReady는 컨트롤러당 1회만 집계하므로 기대 개수 = 플레이어(팀) 수
-			BRGS->SetExpectedSpawnReadyCount(StagedNumTeams);
-		}
+	APawn* OldUpperPawn = UpperPC->GetPawn();
+	UpperPC->UnPossess();
+	if (OldUpperPawn)
+		OldUpperPawn->Destroy();
 
-		StagedSortedByTeam.Empty();
-		StagedNumTeams = 0;
-		StagedCurrentTeamIndex = 0;
-		StagedPawnWaitRetriesForTeam = 0;
-		StagedControllerWaitRetriesForTeam = 0;
-		StagedUpperBodiesSpawnedCount = 0;
-		return;
-	}
+	UBRActorRegistrySubsystem* Registry = UBRActorRegistrySubsystem::Get(World);
+	AUpperBodyPawn* OldUpperOnLower = Registry ? Registry->FindUpperBodyByParent(LowerChar) : nullptr;
+	if (OldUpperOnLower)
+		OldUpperOnLower->Destroy();
 
-	const int32 TeamIndex = StagedCurrentTeamIndex;
-	ABRPlayerState* LowerPS = StagedSortedByTeam.IsValidIndex(2 * TeamIndex) ? StagedSortedByTeam[2 * TeamIndex] : nullptr;
-	ABRPlayerState* UpperPS = StagedSortedByTeam.IsValidIndex(2 * TeamIndex + 1) ? StagedSortedByTeam[2 * TeamIndex + 1] : nullptr;
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = UpperPC;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	if (!LowerPS || !UpperPS)
+	AUpperBodyPawn* NewUpper = World->SpawnActor<AUpperBodyPawn>(
+		UpperBodyClass, LowerChar->GetActorLocation(), LowerChar->GetActorRotation(), SpawnParams);
+	if (!NewUpper)
 	{
-		StagedPawnWaitRetriesForTeam = 0;
-		StagedControllerWaitRetriesForTeam = 0;
-		StagedCurrentTeamIndex++;
-		World->GetTimerManager().SetTimer(StagedApplyTimerHandle, this, &ABRGameMode::ApplyRoleChangesForRandomTeams_ApplyOneTeam, FMath::Max(0.01f, SpawnDelayBetweenTeams), false);
+		HandleUpperBodySpawnFailure(Task, Now, TEXT("상체 스폰 실패"));
 		return;
 	}
+	NewUpper->AttachToComponent(
+		LowerChar->HeadMountPoint,
+		FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	NewUpper->ParentBodyCharacter = LowerChar;
+	LowerChar->SetUpperBodyPawn(NewUpper);
+	UBRActorRegistrySubsystem::NotifyUpperBodyAttached(NewUpper);
+	Task.UpperPawn = NewUpper;
 
-	if (LowerPS->bIsLowerBody == false || UpperPS->bIsLowerBody == true)
+	UpperPC->Possess(NewUpper);
+	if (UpperPC->GetPawn() != NewUpper)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 팀 %d 역할 불일치 - 스킵 (하체=%s bIsLowerBody=%d, 상체=%s bIsLowerBody=%d)"),
-			TeamIndex + 1, *LowerPS->GetPlayerName(), LowerPS->bIsLowerBody ? 1 : 0, *UpperPS->GetPlayerName(), UpperPS->bIsLowerBody ? 1 : 0);
-		StagedPawnWaitRetriesForTeam = 0;
-		StagedControllerWaitRetriesForTeam = 0;
-		StagedCurrentTeamIndex++;
-		World->GetTimerManager().SetTimer(StagedApplyTimerHandle, this, &ABRGameMode::ApplyRoleChangesForRandomTeams_ApplyOneTeam, FMath::Max(0.01f, SpawnDelayBetweenTeams), false);
+		HandleUpperBodySpawnFailure(Task, Now, TEXT("상체 빙의 실패"));
 		return;
 	}
+	Task.PossessTime = Now;
 
-	// GetOwningController()·PlayerState 포인터가 Seamless Travel 직후 불일치할 수 있음 → World에서 PC 검색 (포인터 → 이름 매칭 fallback)
-	auto FindControllerForPlayerState = [World](ABRPlayerState* PS) -> APlayerController*
+	// 리슨 서버 호스트는 AcknowledgePossession → ServerReportSpawnReady 경로가 없으므로 빙의가 곧 확인
+	if (UpperPC->IsLocalController())
 	{
-		if (!PS) return nullptr;
-		APlayerController* PC = Cast<APlayerController>(PS->GetOwningController());
-		if (PC) return PC;
-		const FString TargetName = PS->GetPlayerName();
-		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
-		{
-			APlayerController* C = It->Get();
-			if (!C) continue;
-			if (C->GetPlayerState<APlayerState>() == PS)
-				return C;
-			// Seamless Travel 직후 서버에서 PC->PlayerState가 다른 객체를 가리킬 수 있음 → 이름으로 매칭
-			if (APlayerState* OtherPS = C->GetPlayerState<APlayerState>())
-			{
-				if (OtherPS->GetPlayerName() == TargetName)
-					return C;
-			}
-		}
-		return nullptr;
-	};
-	// 해당 팀의 Controller가 서버에 올 때까지 대기 (1팀 하체→상체 완료 후 2팀 진행하듯, 이 팀 준비될 때까지 기다린 뒤 스폰)
-	APlayerController* LowerPC = FindControllerForPlayerState(LowerPS);
-	APlayerController* UpperPC = FindControllerForPlayerState(UpperPS);
-	if (!LowerPC || !UpperPC)
+		Task.State = EBRUpperBodySpawnState::Acked;
+		Task.AckTime = Now;
+	}
+	else
 	{
-		if (StagedControllerWaitRetriesForTeam < MaxStagedControllerWaitRetriesForTeam)
-		{
-			StagedControllerWaitRetriesForTeam++;
-			World->GetTimerManager().SetTimer(StagedApplyTimerHandle, this, &ABRGameMode::ApplyRoleChangesForRandomTeams_ApplyOneTeam, 0.5f, false);
-			UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 팀 %d Controller 대기 중 (%d/%d) — 서버에 생성되면 상체 스폰 (하체=%s 상체=%s)"),
-				TeamIndex + 1, StagedControllerWaitRetriesForTeam, MaxStagedControllerWaitRetriesForTeam,
-				LowerPC ? TEXT("O") : TEXT("X"), UpperPC ? TEXT("O") : TEXT("X"));
-			return;
-		}
-		// 20초 초과 시에만 스킵 (연결 끊김 등 예외)
-		UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 팀 %d Controller 대기 %d회 초과, 스킵 (하체=%s 상체=%s)"),
-			TeamIndex + 1, MaxStagedControllerWaitRetriesForTeam, LowerPC ? TEXT("O") : TEXT("X"), UpperPC ? TEXT("O") : TEXT("X"));
-		StagedControllerWaitRetriesForTeam = 0;
-		StagedPawnWaitRetriesForTeam = 0;
-		StagedCurrentTeamIndex++;
-		World->GetTimerManager().SetTimer(StagedApplyTimerHandle, this, &ABRGameMode::ApplyRoleChangesForRandomTeams_ApplyOneTeam, FMath::Max(0.01f, SpawnDelayBetweenTeams), false);
-		return;
+		Task.State = EBRUpperBodySpawnState::AwaitingAck;
+		Task.DeadlineTime = Now + UpperBodyAckTimeout;
 	}
-	StagedControllerWaitRetriesForTeam = 0;  // Controller 찾음 → 해당 팀 상체 스폰 진행
+	UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 팀 %d: %s 상체 스폰 후 빙의 (시도 %d, +%.0fms)"),
+		Task.TeamNumber, Task.UpperPS.IsValid() ? *Task.UpperPS->GetPlayerName() : TEXT("?"), Task.Attempts, (Now - UpperBodySpawnStartTime) * 1000.0);
+}
 
-	APlayerCharacter* LowerChar = Cast<APlayerCharacter>(LowerPC->GetPawn());
-	if (!LowerChar || !IsValid(LowerChar))
+void ABRGameMode::HandleUpperBodySpawnFailure(FBRUpperBodySpawnTask& Task, double Now, const TCHAR* Reason)
+{
+	if (Task.Attempts >= MaxUpperBodySpawnAttempts)
 	{
-		// Stage02_Bushes 등 맵에서 하체 Pawn 스폰이 늦을 수 있음 → 같은 팀 재시도 (최대 8회, 0.3초 간격)
-		if (StagedPawnWaitRetriesForTeam < MaxStagedPawnWaitRetriesPerTeam)
-		{
-			StagedPawnWaitRetriesForTeam++;
-			World->GetTimerManager().SetTimer(StagedApplyTimerHandle, this, &ABRGameMode::ApplyRoleChangesForRandomTeams_ApplyOneTeam, 0.3f, false);
-			UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 팀 %d 하체 Pawn 대기 중 (%d/%d), 0.3초 후 재시도"), TeamIndex + 1, StagedPawnWaitRetriesForTeam, MaxStagedPawnWaitRetriesPerTeam);
-			return;
-		}
-		UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 팀 %d 하체 Pawn 없음(재시도 %d회 초과), 스킵"), TeamIndex + 1, MaxStagedPawnWaitRetriesPerTeam);
-		StagedPawnWaitRetriesForTeam = 0;
-		StagedControllerWaitRetriesForTeam = 0;
-		StagedCurrentTeamIndex++;
-		World->GetTimerManager().SetTimer(StagedApplyTimerHandle, this, &ABRGameMode::ApplyRoleChangesForRandomTeams_ApplyOneTeam, FMath::Max(0.01f, SpawnDelayBetweenTeams), false);
+		Task.State = EBRUpperBodySpawnState::Failed;
+		UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 팀 %d 상체 적용 실패 (%s, %d회 시도) → 이 팀만 스킵"), Task.TeamNumber, Reason, Task.Attempts);
 		return;
 	}
-	StagedPawnWaitRetriesForTeam = 0; // 성공 시 재시도 카운트 초기화
+	// 바로 다시 시도하면 같은 원인으로 실패하므로 확인 대기 시간의 일부만큼 쉬었다가 이 팀만 재시도
+	Task.State = EBRUpperBodySpawnState::Pending;
+	Task.DeadlineTime = Now + FMath::Min(0.5, UpperBodyAckTimeout * 0.5);
+	UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 팀 %d %s → 재시도 예약 (%d/%d)"), Task.TeamNumber, Reason, Task.Attempts, MaxUpperBodySpawnAttempts);
+}
+
+void ABRGameMode::ScheduleUpperBodySpawnTick(double Now)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
 
-	if (LowerPC->GetPawn() != LowerChar)
+	double NextTime = TNumericLimits<double>::Max();
+	for (const FBRUpperBodySpawnTask& Task : UpperBodySpawnTasks)
 	{
-		LowerPC->UnPossess();
-		LowerPC->Possess(LowerChar);
+		if (Task.State == EBRUpperBodySpawnState::Pending || Task.State == EBRUpperBodySpawnState::AwaitingAck)
+			NextTime = FMath::Min(NextTime, Task.DeadlineTime);
 	}
+	// 프레임당 한도에 걸려 남은 작업은 다음 프레임에 바로 발행
+	if (NextTime <= Now)
+		World->GetTimerManager().SetTimerForNextTick(this, &ABRGameMode::TickUpperBodySpawns);
+	else
+		World->GetTimerManager().SetTimer(UpperBodySpawnTimerHandle, this, &ABRGameMode::TickUpperBodySpawns, static_cast<float>(NextTime - Now), false);
+}
 
-	APawn* OldUpperPawn = UpperPC->GetPawn();
-	UpperPC->UnPossess();
-	if (OldUpperPawn)
-		OldUpperPawn->Destroy();
+void ABRGameMode::FinishUpperBodySpawns()
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+	World->GetTimerManager().ClearTimer(UpperBodySpawnTimerHandle);
 
-	AUpperBodyPawn* OldUpperOnLower = nullptr;
-	for (TActorIterator<AUpperBodyPawn> It(World); It; ++It)
+	if (UBRGameInstance* GI = GetGameInstance<UBRGameInstance>())
 	{
-		if (It->ParentBodyCharacter == LowerChar)
-		{
-			OldUpperOnLower = *It;
-			break;
-		}
+		GI->ClearPendingApplyRandomTeamRoles();
+		GI->ClearTravelManifest();
 	}
-	if (OldUpperOnLower)
-		OldUpperOnLower->Destroy();
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = UpperPC;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AUpperBodyPawn* NewUpper = World->SpawnActor<AUpperBodyPawn>(
-		UpperBodyClass, LowerChar->GetActorLocation(), LowerChar->GetActorRotation(), SpawnParams);
-	if (NewUpper)
+	// 팀별 타이밍: 스케줄러 시작 기준 첫 발행 / 빙의 / 클라이언트 확인
+	const double Now = World->GetTimeSeconds();
+	auto ToMs = [this](double Time) { return Time < 0.0 ? -1.0 : (Time - UpperBodySpawnStartTime) * 1000.0; };
+	TArray<APlayerController*> ReadyControllers;
+	int32 NumAcked = 0;
+	for (const FBRUpperBodySpawnTask& Task : UpperBodySpawnTasks)
 	{
-		NewUpper->AttachToComponent(
-			LowerChar->HeadMountPoint,
-			FAttachmentTransformRules::SnapToTargetNotIncludingScale);
-		NewUpper->ParentBodyCharacter = LowerChar;
-		LowerChar->SetUpperBodyPawn(NewUpper);
-		UpperPC->Possess(NewUpper);
-		StagedUpperBodiesSpawnedCount++;
-		UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 팀 %d: %s 상체 스폰 후 빙의 (순차 %d/%d)"), TeamIndex + 1, *UpperPS->GetPlayerName(), TeamIndex + 1, StagedNumTeams);
+		const bool bAcked = (Task.State == EBRUpperBodySpawnState::Acked);
+		UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 팀 %d %s | 시도 %d | 발행 %.0fms 빙의 %.0fms 확인 %.0fms"),
+			Task.TeamNumber, bAcked ? TEXT("완료") : TEXT("실패"), Task.Attempts,
+			ToMs(Task.FirstIssueTime), ToMs(Task.PossessTime), ToMs(Task.AckTime));
+		if (!bAcked) continue;
+		NumAcked++;
+		if (APlayerController* LowerPC = FindRoleApplyController(Task.LowerPS.Get())) ReadyControllers.Add(LowerPC);
+		if (APlayerController* UpperPC = FindRoleApplyController(Task.UpperPS.Get())) ReadyControllers.Add(UpperPC);
 	}
+	if (NumAcked == 0)
+		UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 적용] 상체 스폰 완료 but 상체 0명 스폰됨 (하체만 스폰된 상태일 수 있음)"));
+	UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 상체 스폰 완료: %d/%d팀, %.0fms"), NumAcked, UpperBodySpawnTasks.Num(), (Now - UpperBodySpawnStartTime) * 1000.0);
 
-	// 이전 팀(하체 확인 + 상체 스폰)이 완료된 뒤에만 다음 팀 진행. SpawnDelayBetweenTeams 동안 대기 후 다음 팀 처리.
-	StagedCurrentTeamIndex++;
-	if (StagedCurrentTeamIndex < StagedNumTeams)
+	if (ABRGameState* BRGS = GetGameState<ABRGameState>())
 	{
-		const float Delay = FMath::Max(0.5f, SpawnDelayBetweenTeams);
-		World->GetTimerManager().SetTimer(StagedApplyTimerHandle, this, &ABRGameMode::ApplyRoleChangesForRandomTeams_ApplyOneTeam, Delay, false);
-		UE_LOG(LogTemp, Log, TEXT("[랜덤 팀 적용] 팀 %d 상체 스폰 완료, %.2f초 후 팀 %d 진행"), TeamIndex + 1, Delay, StagedCurrentTeamIndex + 1);
+		BRGS->bBodyAssignmentComplete = true;
+		BRGS->OnBodyAssignmentComplete.Broadcast();
+		// 하체 확인(배리어)과 상체 확인(스케줄러)이 이미 끝난 컨트롤러는 바로 집계 → 마지막 확인 즉시 bAllClientsSpawnReady
+		BRGS->SetExpectedSpawnReadyCount(ReadyControllers.Num());
+		for (APlayerController* PC : ReadyControllers)
+			BRGS->ReportClientSpawnReady(PC);
 	}
-	else
-		ApplyRoleChangesForRandomTeams_ApplyOneTeam(); // 마지막 팀 처리 후 정리
+
+	UpperBodySpawnTasks.Empty();
+	RoleApplyReadiness.Empty();
 }
 
 void ABRGameMode::StartGame()
@@ -1079,23 +1194,25 @@ void ABRGameMode::StartGame()
 		}
 	}
 
-	// 맵 선택: Stage 폴더에서 수집한 맵 중 랜덤 선택 (수집 실패 시 폴백 목록 또는 GameMapPath)
-	TArray<FString> AvailableMaps = GetAvailableStageMapPaths();
+	// 맵 선택: 시작 조건 충족 시 미리 골라 선행 로드 중인 Stage를 그대로 사용 (없으면 지금 선택)
 	FString SelectedMapPath;
-	if (bUseRandomMap && AvailableMaps.Num() > 0)
+	ABRGameState* StartGameState = GetGameState<ABRGameState>();
+	if (StartGameState && !StartGameState->PendingStageMapPath.IsEmpty())
 	{
-		int32 RandomIndex = FMath::RandRange(0, AvailableMaps.Num() - 1);
-		SelectedMapPath = AvailableMaps[RandomIndex];
-		UE_LOG(LogTemp, Log, TEXT("[게임 시작] 랜덤 맵 선택: %s (인덱스: %d/%d)"),
-			*SelectedMapPath, RandomIndex + 1, AvailableMaps.Num());
+		SelectedMapPath = StartGameState->PendingStageMapPath;
+		UE_LOG(LogTemp, Log, TEXT("[게임 시작] 선행 로드된 Stage 사용: %s (가장 느린 플레이어 %.0f%%)"),
+			*SelectedMapPath, StartGameState->GetStagePreloadProgress() * 100.0f);
 	}
 	else
 	{
-		SelectedMapPath = GameMapPath;
-		UE_LOG(LogTemp, Log, TEXT("[게임 시작] 기본 맵 사용: %s"), *SelectedMapPath);
+		SelectedMapPath = SelectStageMapPath();
 	}
 	
 	UE_LOG(LogTemp, Log, TEXT("[게임 시작] 성공: 맵으로 이동 중... (%s)"), *SelectedMapPath);
+	if (UBRStageCatalogSubsystem* Catalog = UBRStageCatalogSubsystem::Get(this))
+	{
+		Catalog->MarkPlayed(SelectedMapPath);
+	}
 	
 	UWorld* World = GetWorld();
 	if (!World)
@@ -1124,7 +1241,7 @@ void ABRGameMode::StartGame()
 				GS->AssignRandomTeams();
 				UE_LOG(LogTemp, Warning, TEXT("[게임 시작] 팀/역할 미선택 상태 → 자동 랜덤 팀 배정 후 저장"));
 			}
-			GI->SavePendingRolesForTravel(GS);
+			GI->SaveTravelManifest(GS);
 			GI->SetPendingApplyRandomTeamRoles(true);  // 랜덤이 아니어도 로비 역할(1P=하체, 2P=상체) 적용을 위해 플래그 설정
 			UE_LOG(LogTemp, Warning, TEXT("[게임 시작] Travel 직전 역할 저장 완료 (GameMode), 게임 맵에서 상체/하체 적용 예정"));
 		}
@@ -1214,9 +1331,8 @@ void ABRGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	UWorld* World = GetWorld();
 	if (World)
 	{
-		World->GetTimerManager().ClearTimer(InitialRoleApplyTimerHandle);
-		World->GetTimerManager().ClearTimer(StagedApplyTimerHandle);
-		World->GetTimerManager().ClearTimer(StagedAllLowerReadyHandle);
+		World->GetTimerManager().ClearTimer(RoleApplyBarrierTimeoutHandle);
+		World->GetTimerManager().ClearTimer(UpperBodySpawnTimerHandle);
 		World->GetTimerManager().ClearTimer(DirectStartRoleApplyTimerHandle);
 		World->GetTimerManager().ClearTimer(SpecTimerHandle_DeathSpectator);
 		World->GetTimerManager().ClearTimer(ReturnToLobbyTimerHandle);
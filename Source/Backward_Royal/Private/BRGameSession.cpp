@@ -2,6 +2,7 @@
 #include "BRGameSession.h"
 #include "BRGameInstance.h"
 #include "BRGameMode.h"
+#include "BRActorRegistrySubsystem.h"
 #include "OnlineSubsystem.h"
 #include "OnlineSessionSettings.h"
 #include "Interfaces/OnlineSessionInterface.h"
@@ -23,6 +24,8 @@ ABRGameSession::ABRGameSession()
 void ABRGameSession::BeginPlay()
 {
 	Super::BeginPlay();
+
+	UBRActorRegistrySubsystem::RegisterGameSession(this);
 	
 	// Online Subsystem 초기화
 	InitializeOnlineSubsystem();
@@ -156,6 +159,8 @@ void ABRGameSession::InitializeOnlineSubsystem()
 
 void ABRGameSession::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	UBRActorRegistrySubsystem::UnregisterGameSession(this);
+
 	Super::EndPlay(EndPlayReason);
 	
 	// 콜백 해제
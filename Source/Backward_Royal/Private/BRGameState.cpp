@@ -2,6 +2,10 @@
 #include "BRGameState.h"
 #include "BRPlayerState.h"
 #include "BRGameInstance.h"
+#include "BRGameMode.h"
+#include "BRAssetStreamingSubsystem.h"
+#include "BRLobbyViewModelSubsystem.h"
+#include "BRCombatEventSubsystem.h"
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/PlayerState.h"
 #include "GameFramework/PlayerController.h"
@@ -13,10 +17,95 @@ bool ShouldUseFallbackDisplayName(const FString& PlayerName, const FString& User
 	return PlayerName.IsEmpty() || PlayerName == UserUID;
 }
 
+// ========== FBRUserInfoList (FastArray) ==========
+
+void FBRUserInfoListEntry::PreReplicatedRemove(const FBRUserInfoList& InArraySerializer)
+{
+	InArraySerializer.MarkReceivedChange(*this, TEXT("제거"));
+}
+
+void FBRUserInfoListEntry::PostReplicatedAdd(const FBRUserInfoList& InArraySerializer)
+{
+	InArraySerializer.MarkReceivedChange(*this, TEXT("추가"));
+}
+
+void FBRUserInfoListEntry::PostReplicatedChange(const FBRUserInfoList& InArraySerializer)
+{
+	InArraySerializer.MarkReceivedChange(*this, TEXT("변경"));
+}
+
+bool FBRUserInfoList::AddOrUpdate(APlayerState* PlayerState, const FBRUserInfo& Info)
+{
+	for (FBRUserInfoListEntry& Entry : Items)
+	{
+		if (Entry.PlayerState == PlayerState)
+		{
+			if (Entry.Info == Info)
+			{
+				return false;
+			}
+			Entry.Info = Info;
+			MarkItemDirty(Entry);
+			return true;
+		}
+	}
+
+	FBRUserInfoListEntry& NewEntry = Items.AddDefaulted_GetRef();
+	NewEntry.PlayerState = PlayerState;
+	NewEntry.Info = Info;
+	MarkItemDirty(NewEntry);
+	return true;
+}
+
+bool FBRUserInfoList::RemoveMissing(const TArray<TObjectPtr<APlayerState>>& PlayerArray)
+{
+	const int32 NumRemoved = Items.RemoveAll([&PlayerArray](const FBRUserInfoListEntry& Entry)
+		{
+			return !IsValid(Entry.PlayerState) || !PlayerArray.Contains(Entry.PlayerState);
+		});
+	if (NumRemoved > 0)
+	{
+		MarkArrayDirty();
+	}
+	return NumRemoved > 0;
+}
+
+const FBRUserInfo* FBRUserInfoList::FindByPlayerIndex(int32 PlayerIndex) const
+{
+	for (const FBRUserInfoListEntry& Entry : Items)
+	{
+		if (Entry.Info.PlayerIndex == PlayerIndex)
+		{
+			return &Entry.Info;
+		}
+	}
+	return nullptr;
+}
+
+void FBRUserInfoList::MarkReceivedChange(const FBRUserInfoListEntry& Entry, const TCHAR* ChangeType) const
+{
+	UE_LOG(LogTemp, Verbose, TEXT("[플레이어 목록] 항목 %s: [%d] '%s'"), ChangeType, Entry.Info.PlayerIndex, *Entry.Info.PlayerName);
+	bReceivedChange = true;
+}
+
+void FBRUserInfoList::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (!bReceivedChange)
+	{
+		return;
+	}
+	bReceivedChange = false;
+	if (OwnerGameState)
+	{
+		OwnerGameState->OnRep_PlayerListForDisplay();
+	}
+}
+
 ABRGameState::ABRGameState()
 {
 	PlayerCount = 0;
 	bCanStartGame = false;
+	PlayerListForDisplay.OwnerGameState = this;
 }
 
 void ABRGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -25,19 +114,62 @@ void ABRGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLife
 
 	DOREPLIFETIME(ABRGameState, PlayerCount);
 	DOREPLIFETIME(ABRGameState, PlayerListForDisplay);
+	DOREPLIFETIME(ABRGameState, NumLobbyEntrySlots);
+	DOREPLIFETIME(ABRGameState, NumLobbyTeams);
 	DOREPLIFETIME(ABRGameState, LobbyEntrySlots);
 	DOREPLIFETIME(ABRGameState, LobbyTeamSlots);
 	DOREPLIFETIME(ABRGameState, bCanStartGame);
+	DOREPLIFETIME(ABRGameState, PendingStageMapPath);
 	DOREPLIFETIME(ABRGameState, RoomTitle);
 	DOREPLIFETIME(ABRGameState, WinningTeamNumber);
 	DOREPLIFETIME(ABRGameState, bBodyAssignmentComplete);
 	DOREPLIFETIME(ABRGameState, bAllClientsSpawnReady);
 	DOREPLIFETIME(ABRGameState, bSkipLoadingScreen);
+	DOREPLIFETIME(ABRGameState, BalanceSnapshot);
 }
 
 void ABRGameState::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// 로비 UI 뷰모델이 목록/팀 이벤트를 받아 프레임 단위로 묶어 갱신하도록 연결
+	if (UBRLobbyViewModelSubsystem* LobbyViewModel = UBRLobbyViewModelSubsystem::Get(this))
+	{
+		LobbyViewModel->BindGameState(this);
+	}
+
+	// 서버: 현재 밸런스 스냅샷을 복제 사본에 담고 이후 발행을 따라감
+	if (HasAuthority())
+	{
+		if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+		{
+			Balance->OnBalanceChanged.AddUObject(this, &ABRGameState::HandleBalancePublished);
+			HandleBalancePublished(*Balance->GetSnapshot());
+		}
+	}
+}
+
+void ABRGameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+	{
+		Balance->OnBalanceChanged.RemoveAll(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ABRGameState::HandleBalancePublished(const FBRBalanceSnapshot& Snapshot)
+{
+	BalanceSnapshot = Snapshot;
+}
+
+void ABRGameState::OnRep_BalanceSnapshot()
+{
+	if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+	{
+		Balance->AdoptReplicated(BalanceSnapshot);
+	}
 }
 
 void ABRGameState::UpdatePlayerList()
@@ -52,88 +184,56 @@ void ABRGameState::UpdatePlayerList()
 			UE_LOG(LogTemp, Log, TEXT("[플레이어 목록] 업데이트: %d -> %d명"), OldCount, PlayerCount);
 		}
 		// 서버가 플레이어 목록을 채워 복제 → 클라이언트도 동일 목록으로 UI 표시. "Player N" 폴백 없음 → 이름 없으면 공란, ServerSetPlayerName 도착 시 갱신
-		PlayerListForDisplay.Empty();
+		// 플레이어별로 갱신: 값이 바뀐 항목만 dirty → 바뀐 플레이어 정보만 전송됨
+		PlayerListForDisplay.RemoveMissing(PlayerArray);
 		for (int32 i = 0; i < PlayerArray.Num(); i++)
 		{
 			if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(PlayerArray[i]))
 			{
 				FBRUserInfo Info = BRPS->GetUserInfo();
 				Info.PlayerIndex = i;
-				UE_LOG(LogTemp, Warning, TEXT("[로비이름] UpdatePlayerList | [%d] PlayerName='%s' UserUID='%s'"), i, *Info.PlayerName, *Info.UserUID);
-				PlayerListForDisplay.Add(Info);
+				if (PlayerListForDisplay.AddOrUpdate(BRPS, Info))
+				{
+					UE_LOG(LogTemp, Log, TEXT("[로비이름] UpdatePlayerList | [%d] PlayerName='%s' UserUID='%s'"), i, *Info.PlayerName, *Info.UserUID);
+				}
 			}
 		}
 
-		// 로비 Entry / SelectTeam 슬롯 초기화·갱신 (서버만). 팀당 3슬롯: 0=관전, 1=하체, 2=상체
-		const int32 NumEntrySlots = 8;
-		const int32 SlotsPerTeam = 3;
-		const int32 NumTeamSlots = 4 * SlotsPerTeam; // 12
-		if (LobbyEntrySlots.Num() != NumEntrySlots)
-		{
-			LobbyEntrySlots.SetNum(NumEntrySlots);
-			for (int32 i = 0; i < NumEntrySlots; i++) LobbyEntrySlots[i] = -1;
-		}
-		if (LobbyTeamSlots.Num() != NumTeamSlots)
-		{
-			LobbyTeamSlots.SetNum(NumTeamSlots);
-			for (int32 i = 0; i < NumTeamSlots; i++) LobbyTeamSlots[i] = -1;
-		}
-		// 나간 플레이어 인덱스는 슬롯에서 제거
-		auto IsValidPlayerIndex = [this](int32 Idx) -> bool
-		{
-			return Idx >= 0 && Idx < PlayerArray.Num() && PlayerArray[Idx];
-		};
-		for (int32 i = 0; i < LobbyEntrySlots.Num(); i++)
-		{
-			if (!IsValidPlayerIndex(LobbyEntrySlots[i])) LobbyEntrySlots[i] = -1;
-		}
-		for (int32 i = 0; i < LobbyTeamSlots.Num(); i++)
-		{
-			if (!IsValidPlayerIndex(LobbyTeamSlots[i])) LobbyTeamSlots[i] = -1;
-		}
-		// [UserInfo 보존] 게임 맵 Travel 직후에는 새 플레이어→대기열 초기화 스킵 (RestorePendingRolesFromTravel에서 역할 복원)
+		// 로비 Entry / SelectTeam 슬롯 갱신 (서버만). 팀당 3슬롯: 0=관전, 1=하체, 2=상체
+		// 슬롯 모델은 PlayerState 단위로 자리를 기억 → 나간 플레이어만 빼고, 남은 플레이어는 당겨진 PlayerArray 인덱스로 바뀐 칸만 다시 씀
+		EnsureLobbySlotModel();
+		TMap<const APlayerState*, int32> IndexByPlayer;
+		BuildPlayerIndexMap(IndexByPlayer);
+		LobbySlotModel.RemoveIf([&IndexByPlayer](const APlayerState* Player) { return !IndexByPlayer.Contains(Player); });
+
+		// [UserInfo 보존] 게임 맵 Travel 직후에는 새 플레이어→대기열 초기화 스킵 (Travel 매니페스트에서 역할 복원)
 		UBRGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance<UBRGameInstance>() : nullptr;
-		const bool bSkipEntryInit = GI && GI->HasPendingRoleRestore();
+		const bool bSkipEntryInit = GI && GI->HasTravelManifest();
 
-		// 새로 들어온 플레이어를 Entry 첫 빈 자리에 배치 (Travel 직후 스킵)
+		// 새로 들어온 플레이어를 Entry 첫 빈 자리에 배치 (Travel 직후 스킵). 자리 여부는 역인덱스, 빈 자리는 비트마스크로 O(1)
 		if (!bSkipEntryInit)
 		{
-		for (int32 i = 0; i < PlayerArray.Num(); i++)
-		{
-			// [인게임 보호] 이미 유효한 팀에 배치된 플레이어(TeamNumber > 0)는 Entry 초기화 대상에서 제외
-			// → 스왑 등의 역할 변경 시 관전으로 리셋되지 않도록 보호
-			if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(PlayerArray[i]))
-			{
-				if (BRPS->TeamNumber > 0 && !BRPS->bIsSpectatorSlot)
-				{
-					// 이미 팀에 배치된 플레이어는 건너뛰기
-					continue;
-				}
-			}
-
-			bool bFound = false;
-			for (int32 k : LobbyEntrySlots) { if (k == i) { bFound = true; break; } }
-			if (!bFound)
-			{
-				for (int32 k : LobbyTeamSlots) { if (k == i) { bFound = true; break; } }
-			}
-			if (bFound) continue;
-			for (int32 j = 0; j < LobbyEntrySlots.Num(); j++)
+			for (int32 i = 0; i < PlayerArray.Num(); i++)
 			{
-				if (LobbyEntrySlots[j] == -1)
+				ABRPlayerState* BRPS = Cast<ABRPlayerState>(PlayerArray[i]);
+				// [인게임 보호] 이미 유효한 팀에 배치된 플레이어(TeamNumber > 0)는 Entry 초기화 대상에서 제외
+				// → 스왑 등의 역할 변경 시 관전으로 리셋되지 않도록 보호
+				if (!BRPS || (BRPS->TeamNumber > 0 && !BRPS->bIsSpectatorSlot)) continue;
+				if (LobbySlotModel.FindSlot(BRPS) != INDEX_NONE) continue;
+
+				const int32 FreeSlot = LobbySlotModel.FindFreeEntrySlot();
+				if (FreeSlot == INDEX_NONE)
 				{
-					LobbyEntrySlots[j] = i;
-					// 대기열(Entry) = 관전. TeamID 0, PlayerIndex 0
-					if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(PlayerArray[i]))
-					{
-						BRPS->SetTeamNumber(0);
-						BRPS->SetSpectator(true);
-					}
+					UE_LOG(LogTemp, Warning, TEXT("[플레이어 목록] 대기열 %d칸이 가득 차 배치 못함: %s"), LobbySlotModel.GetNumEntrySlots(), *BRPS->GetPlayerName());
 					break;
 				}
+				LobbySlotModel.Place(BRPS, FreeSlot);
+				// 대기열(Entry) = 관전. TeamID 0, PlayerIndex 0
+				BRPS->SetTeamNumber(0);
+				BRPS->SetSpectator(true);
 			}
 		}
-		}
+		SyncLobbySlotArrays(IndexByPlayer);
 
 		OnRep_PlayerCount();
 		CheckCanStartGame();
@@ -161,6 +261,26 @@ void ABRGameState::CheckCanStartGame()
 			}
 			OnRep_CanStartGame();
 		}
+
+		// 호스트는 나머지 전원 준비 시 시작할 수 있으므로 그 시점부터 다음 Stage를 정해 선행 로드 (이미 정했으면 유지)
+		const bool bHostCanStart = PlayerCount >= MinPlayers && PlayerCount <= MaxPlayers && AreAllNonHostPlayersReady();
+		const bool bStageConditionMet = bCanStart || bHostCanStart;
+
+		// 준비 해제·퇴장으로 조건이 깨졌거나 인원이 바뀌었으면 정해 둔 Stage는 무효 (인원에 맞는 Stage가 달라질 수 있음)
+		if (!PendingStageMapPath.IsEmpty() && (!bStageConditionMet || PendingStagePlayerCount != PlayerArray.Num()))
+		{
+			UE_LOG(LogTemp, Log, TEXT("[Stage 선행 로드] 시작 조건 변경(조건=%s, 인원 %d→%d) → %s 선행 로드 취소"),
+				bStageConditionMet ? TEXT("충족") : TEXT("불만족"), PendingStagePlayerCount, PlayerArray.Num(), *PendingStageMapPath);
+			SetPendingStageMapPath(FString());
+		}
+
+		if (bStageConditionMet && PendingStageMapPath.IsEmpty())
+		{
+			if (ABRGameMode* GM = GetWorld() ? GetWorld()->GetAuthGameMode<ABRGameMode>() : nullptr)
+			{
+				GM->PrepareStageForStart();
+			}
+		}
 	}
 }
 
@@ -246,36 +366,18 @@ void ABRGameState::AssignRandomTeams()
 	}
 
 	// 로비 UI 갱신: Entry 비우기, SelectTeam(팀별 관전/하체/상체)에 배정 결과 반영. 슬롯 0=관전, 1=하체, 2=상체
-	const int32 NumEntrySlots = 8;
-	const int32 SlotsPerTeam = 3;
-	const int32 NumTeamSlots = 4 * SlotsPerTeam; // 12
-	if (LobbyEntrySlots.Num() != NumEntrySlots)
-	{
-		LobbyEntrySlots.SetNum(NumEntrySlots);
-	}
-	for (int32 i = 0; i < NumEntrySlots; i++)
-	{
-		LobbyEntrySlots[i] = -1;
-	}
-	if (LobbyTeamSlots.Num() != NumTeamSlots)
-	{
-		LobbyTeamSlots.SetNum(NumTeamSlots);
-	}
-	for (int32 i = 0; i < NumTeamSlots; i++)
-	{
-		LobbyTeamSlots[i] = -1;
-	}
-	// 팀 순서대로: 팀당 슬롯 0=관전(비움), 1=하체, 2=상체. Flat = team*3 + slot (1 or 2)
+	EnsureLobbySlotModel();
+	LobbySlotModel.Reset();
 	for (int32 i = 0; i < NumPlayers; i++)
 	{
-		int32 TeamIdx = i / 2;
-		int32 SlotInTeam = 1 + (i % 2); // 1=하체, 2=상체 (관전 슬롯 0은 사용 안 함)
-		int32 Flat = TeamIdx * SlotsPerTeam + SlotInTeam;
-		if (Flat < NumTeamSlots)
+		const int32 TeamIdx = i / 2;
+		const int32 SlotInTeam = 1 + (i % 2); // 1=하체, 2=상체 (관전 슬롯 0은 사용 안 함)
+		if (TeamIdx < LobbySlotModel.GetNumTeams())
 		{
-			LobbyTeamSlots[Flat] = PlayerIndices[i];
+			LobbySlotModel.Place(Players[i], LobbySlotModel.TeamSlot(TeamIdx, SlotInTeam));
 		}
 	}
+	SyncLobbySlotArrays();
 
 	// 게임 시작 가능 여부 확인
 	CheckCanStartGame();
@@ -344,15 +446,76 @@ void ABRGameState::OnRep_PlayerListForDisplay()
 
 void ABRGameState::OnRep_CanStartGame()
 {
-	// UI 업데이트를 위한 이벤트 발생 가능
+	UBRLobbyViewModelSubsystem::Notify(this, EBRLobbyViewDirty::CanStartGame);
+}
+
+void ABRGameState::SetPendingStageMapPath(const FString& NewStageMapPath)
+{
+	if (!HasAuthority() || PendingStageMapPath == NewStageMapPath)
+		return;
+
+	PendingStageMapPath = NewStageMapPath;
+	PendingStagePlayerCount = NewStageMapPath.IsEmpty() ? INDEX_NONE : PlayerArray.Num();
+	for (APlayerState* PS : PlayerArray)
+	{
+		if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(PS))
+		{
+			BRPS->SetStagePreloadPercent(0);
+		}
+	}
+	OnRep_PendingStageMapPath();
+}
+
+void ABRGameState::OnRep_PendingStageMapPath()
+{
+	if (!PendingStageMapPath.IsEmpty())
+	{
+		if (UBRAssetStreamingSubsystem* Streaming = GetGameInstance() ? GetGameInstance()->GetSubsystem<UBRAssetStreamingSubsystem>() : nullptr)
+		{
+			Streaming->PreloadStage(PendingStageMapPath);
+		}
+	}
+	else if (UBRAssetStreamingSubsystem* Streaming = GetGameInstance() ? GetGameInstance()->GetSubsystem<UBRAssetStreamingSubsystem>() : nullptr)
+	{
+		// 로비에서 시작 조건이 깨져 서버가 Stage를 취소함 → 진행 중인 로드 취소·로드된 패키지 해제
+		if (!Streaming->GetPreloadedStage().IsEmpty())
+		{
+			Streaming->ReleaseStagePreload();
+		}
+	}
+	UBRLobbyViewModelSubsystem::Notify(this, EBRLobbyViewDirty::StagePreload);
+}
+
+float ABRGameState::GetStagePreloadProgress() const
+{
+	if (PendingStageMapPath.IsEmpty())
+		return 0.0f;
+
+	int32 MinPercent = 100;
+	for (APlayerState* PS : PlayerArray)
+	{
+		if (const ABRPlayerState* BRPS = Cast<ABRPlayerState>(PS))
+		{
+			MinPercent = FMath::Min<int32>(MinPercent, BRPS->StagePreloadPercent);
+		}
+	}
+	return MinPercent / 100.0f;
 }
 
 TArray<FBRUserInfo> ABRGameState::GetAllPlayerUserInfo() const
 {
-	// 서버가 채운 PlayerListForDisplay가 복제되므로, 서버·클라이언트 모두 이 배열로 UI 표시
+	// 서버가 채운 PlayerListForDisplay가 복제되므로, 서버·클라이언트 모두 이 목록으로 UI 표시
+	// (FastArray는 클라이언트에서 항목 순서를 보장하지 않으므로 PlayerIndex 순으로 정렬)
 	if (PlayerListForDisplay.Num() > 0)
 	{
-		return PlayerListForDisplay;
+		TArray<FBRUserInfo> SortedList;
+		SortedList.Reserve(PlayerListForDisplay.Num());
+		for (const FBRUserInfoListEntry& Entry : PlayerListForDisplay.Items)
+		{
+			SortedList.Add(Entry.Info);
+		}
+		SortedList.Sort([](const FBRUserInfo& A, const FBRUserInfo& B) { return A.PlayerIndex < B.PlayerIndex; });
+		return SortedList;
 	}
 	// 폴백: 아직 한 번도 UpdatePlayerList가 호출되지 않은 경우(초기 등)
 	TArray<FBRUserInfo> UserInfoArray;
@@ -387,16 +550,16 @@ FBRUserInfo ABRGameState::GetPlayerUserInfo(int32 PlayerIndex) const
 TArray<FBRUserInfo> ABRGameState::GetLobbyEntryDisplayList() const
 {
 	TArray<FBRUserInfo> Out;
-	Out.SetNum(8);
-	for (int32 i = 0; i < 8 && i < LobbyEntrySlots.Num(); i++)
+	Out.SetNum(LobbyEntrySlots.Num());
+	for (int32 i = 0; i < LobbyEntrySlots.Num(); i++)
 	{
 		int32 Pidx = LobbyEntrySlots[i];
 		if (Pidx >= 0 && Pidx < PlayerArray.Num())
 		{
 			// 서버가 채운 PlayerListForDisplay 우선 사용 → 클라이언트는 복제된 목록으로 올바른 이름 표시
-			if (Pidx < PlayerListForDisplay.Num())
+			if (const FBRUserInfo* Listed = PlayerListForDisplay.FindByPlayerIndex(Pidx))
 			{
-				Out[i] = PlayerListForDisplay[Pidx];
+				Out[i] = *Listed;
 				Out[i].PlayerIndex = Pidx;
 			}
 			else
@@ -413,15 +576,16 @@ TArray<FBRUserInfo> ABRGameState::GetLobbyEntryDisplayList() const
 FBRUserInfo ABRGameState::GetLobbyTeamSlotInfo(int32 TeamIndex, int32 SlotIndex) const
 {
 	FBRUserInfo Empty;
-	const int32 SlotsPerTeam = 3;
+	const int32 SlotsPerTeam = FBRLobbySlotModel::SlotsPerTeam;
+	if (SlotIndex < 0 || SlotIndex >= SlotsPerTeam) return Empty;
 	int32 Idx = TeamIndex * SlotsPerTeam + SlotIndex;
 	if (LobbyTeamSlots.Num() <= Idx || Idx < 0) return Empty;
 	int32 Pidx = LobbyTeamSlots[Idx];
 	if (Pidx < 0 || Pidx >= PlayerArray.Num()) return Empty;
 	// 대기열과 동일: 서버가 채운 PlayerListForDisplay 우선 사용 → 복제 후 클라이언트에서도 이름이 안정적으로 표시됨
-	if (Pidx < PlayerListForDisplay.Num())
+	if (const FBRUserInfo* Listed = PlayerListForDisplay.FindByPlayerIndex(Pidx))
 	{
-		FBRUserInfo Info = PlayerListForDisplay[Pidx];
+		FBRUserInfo Info = *Listed;
 		Info.TeamID = TeamIndex + 1;
 		Info.PlayerIndex = SlotIndex;  // 0=관전, 1=하체, 2=상체
 		return Info;
@@ -435,7 +599,7 @@ FBRUserInfo ABRGameState::GetLobbyTeamSlotInfo(int32 TeamIndex, int32 SlotIndex)
 FBRUserInfo ABRGameState::GetLobbyTeamSlotInfoByTeamIDAndPlayerIndex(int32 TeamID, int32 PlayerIndex) const
 {
 	FBRUserInfo Empty;
-	if (TeamID < 1 || TeamID > 4 || PlayerIndex < 0 || PlayerIndex > 2) return Empty;
+	if (TeamID < 1 || TeamID > NumLobbyTeams || PlayerIndex < 0 || PlayerIndex >= FBRLobbySlotModel::SlotsPerTeam) return Empty;
 	// 각 플레이어의 TeamID(TeamNumber)·PlayerIndex(0=관전, 1=하체, 2=상체)로 찾기
 	for (int32 i = 0; i < PlayerArray.Num(); i++)
 	{
@@ -458,77 +622,132 @@ void ABRGameState::OnRep_LobbySlots()
 	OnPlayerListChanged.Broadcast();
 }
 
-/** 대기열(LobbyEntrySlots)을 압축: 채워진 슬롯을 앞으로 모으고, 빈 슬롯(-1)은 뒤로. 인덱스 2번이 비면 3번 이후가 2번부터 채워짐 */
-void ABRGameState::CompactLobbyEntrySlots()
+void ABRGameState::ConfigureLobbySlots(int32 InNumEntrySlots, int32 InNumTeams)
 {
-	if (LobbyEntrySlots.Num() < 8) return;
-	TArray<int32> Compacted;
-	Compacted.Reserve(8);
-	for (int32 i = 0; i < LobbyEntrySlots.Num(); i++)
+	if (!HasAuthority()) return;
+	LobbySlotModel.Configure(InNumEntrySlots, InNumTeams);
+	NumLobbyEntrySlots = LobbySlotModel.GetNumEntrySlots();
+	NumLobbyTeams = LobbySlotModel.GetNumTeams();
+	SyncLobbySlotArrays();
+	UE_LOG(LogTemp, Log, TEXT("[로비 슬롯] 대기열 %d칸, 팀 %d개 x %d칸"), NumLobbyEntrySlots, NumLobbyTeams, FBRLobbySlotModel::SlotsPerTeam);
+}
+
+void ABRGameState::EnsureLobbySlotModel()
+{
+	if (LobbySlotModel.GetNumSlots() == 0)
+	{
+		LobbySlotModel.Configure(NumLobbyEntrySlots, NumLobbyTeams);
+		NumLobbyEntrySlots = LobbySlotModel.GetNumEntrySlots();
+		NumLobbyTeams = LobbySlotModel.GetNumTeams();
+	}
+}
+
+void ABRGameState::BuildPlayerIndexMap(TMap<const APlayerState*, int32>& OutIndexByPlayer) const
+{
+	OutIndexByPlayer.Reset();
+	OutIndexByPlayer.Reserve(PlayerArray.Num());
+	for (int32 i = 0; i < PlayerArray.Num(); i++)
+	{
+		if (PlayerArray[i])
+		{
+			OutIndexByPlayer.Add(PlayerArray[i], i);
+		}
+	}
+}
+
+bool ABRGameState::SyncLobbySlotArrays(const TMap<const APlayerState*, int32>& IndexByPlayer)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_SyncLobbySlots);
+	bool bChanged = false;
+	const int32 NumEntrySlots = LobbySlotModel.GetNumEntrySlots();
+	const int32 NumTeamSlots = LobbySlotModel.GetNumTeamSlots();
+	if (LobbyEntrySlots.Num() != NumEntrySlots)
+	{
+		LobbyEntrySlots.Init(-1, NumEntrySlots);
+		bChanged = true;
+	}
+	if (LobbyTeamSlots.Num() != NumTeamSlots)
+	{
+		LobbyTeamSlots.Init(-1, NumTeamSlots);
+		bChanged = true;
+	}
+
+	// 복제 배열은 칸 단위로 비교해 보내므로, 값이 같은 칸은 건드리지 않음
+	auto WriteSlot = [&](int32& Dest, int32 ModelSlot)
 	{
-		if (LobbyEntrySlots[i] >= 0)
+		const APlayerState* Player = LobbySlotModel.GetOccupant(ModelSlot);
+		const int32* Found = Player ? IndexByPlayer.Find(Player) : nullptr;
+		const int32 NewValue = Found ? *Found : -1;
+		if (Dest != NewValue)
 		{
-			Compacted.Add(LobbyEntrySlots[i]);
+			Dest = NewValue;
+			bChanged = true;
 		}
+	};
+	for (int32 i = 0; i < NumEntrySlots; i++)
+	{
+		WriteSlot(LobbyEntrySlots[i], i);
+	}
+	for (int32 Flat = 0; Flat < NumTeamSlots; Flat++)
+	{
+		WriteSlot(LobbyTeamSlots[Flat], NumEntrySlots + Flat);
 	}
-	const int32 NumEntrySlots = 8;
-	while (Compacted.Num() < NumEntrySlots)
+	return bChanged;
+}
+
+bool ABRGameState::SyncLobbySlotArrays()
+{
+	TMap<const APlayerState*, int32> IndexByPlayer;
+	BuildPlayerIndexMap(IndexByPlayer);
+	return SyncLobbySlotArrays(IndexByPlayer);
+}
+
+/** 대기열을 압축: 채워진 슬롯을 앞으로 모으고, 빈 슬롯(-1)은 뒤로. 인덱스 2번이 비면 3번 이후가 2번부터 채워짐 */
+void ABRGameState::CompactLobbyEntrySlots()
+{
+	if (!HasAuthority()) return;
+	if (LobbySlotModel.CompactEntries())
 	{
-		Compacted.Add(-1);
+		SyncLobbySlotArrays();
 	}
-	LobbyEntrySlots = MoveTemp(Compacted);
 }
 
 bool ABRGameState::AssignPlayerToLobbyTeam(int32 PlayerIndex, int32 TeamIndex, int32 SlotIndex)
 {
-	const int32 SlotsPerTeam = 3;
 	if (!HasAuthority()) return false;
-	if (TeamIndex < 0 || TeamIndex > 3 || SlotIndex < 0 || SlotIndex > 2) return false;
-	if (PlayerIndex < 0 || PlayerIndex >= PlayerArray.Num()) return false;
-	const int32 Flat = TeamIndex * SlotsPerTeam + SlotIndex;
-	if (LobbyTeamSlots.Num() <= Flat || LobbyEntrySlots.Num() < 8) return false;
+	EnsureLobbySlotModel();
+	if (TeamIndex < 0 || TeamIndex >= LobbySlotModel.GetNumTeams() || SlotIndex < 0 || SlotIndex >= FBRLobbySlotModel::SlotsPerTeam) return false;
+	if (PlayerIndex < 0 || PlayerIndex >= PlayerArray.Num() || !PlayerArray[PlayerIndex]) return false;
+	APlayerState* Player = PlayerArray[PlayerIndex];
+	const int32 Slot = LobbySlotModel.TeamSlot(TeamIndex, SlotIndex);
 
 	// 이미 이 슬롯에 있으면 아무것도 하지 않음 (같은 버튼 다시 클릭 시 대기열로 돌아가는 버그 방지)
-	if (LobbyTeamSlots[Flat] == PlayerIndex)
+	if (LobbySlotModel.GetOccupant(Slot) == Player)
 	{
 		return true;
 	}
 
-	// Entry에서 해당 플레이어 제거
-	bool bFoundInEntry = false;
-	for (int32 i = 0; i < LobbyEntrySlots.Num(); i++)
-	{
-		if (LobbyEntrySlots[i] == PlayerIndex)
-		{
-			LobbyEntrySlots[i] = -1;
-			bFoundInEntry = true;
-			break;
-		}
-	}
+	// 대기열이든 다른 팀 슬롯이든 기존 자리에서 뺌 (역인덱스로 바로 찾음)
+	LobbySlotModel.Remove(Player);
 	// 기존 팀 슬롯에 있던 플레이어(다른 사람)는 Entry 첫 빈 자리로
-	int32 OldPlayer = LobbyTeamSlots[Flat];
-	if (OldPlayer >= 0 && OldPlayer != PlayerIndex)
+	if (APlayerState* OldPlayer = LobbySlotModel.GetOccupant(Slot))
 	{
-		for (int32 i = 0; i < LobbyEntrySlots.Num(); i++)
+		LobbySlotModel.Remove(OldPlayer);
+		const int32 FreeSlot = LobbySlotModel.FindFreeEntrySlot();
+		if (FreeSlot != INDEX_NONE)
 		{
-			if (LobbyEntrySlots[i] == -1) { LobbyEntrySlots[i] = OldPlayer; break; }
-		}
-	}
-	LobbyTeamSlots[Flat] = PlayerIndex;
-	if (!bFoundInEntry)
-	{
-		// 이미 팀 다른 슬롯에 있었을 수 있음 → 그 슬롯 비우기 (방금 할당한 Flat 제외)
-		for (int32 i = 0; i < LobbyTeamSlots.Num(); i++)
-		{
-			if (i != Flat && LobbyTeamSlots[i] == PlayerIndex)
-			{
-				LobbyTeamSlots[i] = -1;
-			}
+			LobbySlotModel.Place(OldPlayer, FreeSlot);
 		}
 	}
+	LobbySlotModel.Place(Player, Slot);
+	LobbySlotModel.CompactEntries();
+
+	TMap<const APlayerState*, int32> IndexByPlayer;
+	BuildPlayerIndexMap(IndexByPlayer);
+	SyncLobbySlotArrays(IndexByPlayer);
 
 	// 팀 선택한 플레이어의 UserInfo(PlayerState) 갱신. SlotIndex 0=관전, 1=하체, 2=상체
-	if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(PlayerArray[PlayerIndex]))
+	if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(Player))
 	{
 		const int32 NewTeamNumber = TeamIndex + 1;
 		BRPS->SetTeamNumber(NewTeamNumber);
@@ -540,15 +759,12 @@ bool ABRGameState::AssignPlayerToLobbyTeam(int32 PlayerIndex, int32 TeamIndex, i
 		{
 			// 1=하체, 2=상체. 파트너는 같은 팀의 다른 플레이 슬롯(1 또는 2)
 			const int32 PartnerSlot = (SlotIndex == 1) ? 2 : 1;
-			const int32 OtherFlat = TeamIndex * SlotsPerTeam + PartnerSlot;
-			const int32 PartnerIndex = (LobbyTeamSlots.IsValidIndex(OtherFlat)) ? LobbyTeamSlots[OtherFlat] : -1;
-			BRPS->SetPlayerRole(SlotIndex == 1, (PartnerIndex >= 0) ? PartnerIndex : -1);
-			if (PartnerIndex >= 0 && PartnerIndex < PlayerArray.Num())
+			ABRPlayerState* PartnerPS = Cast<ABRPlayerState>(LobbySlotModel.GetOccupant(LobbySlotModel.TeamSlot(TeamIndex, PartnerSlot)));
+			const int32* PartnerIndex = PartnerPS ? IndexByPlayer.Find(PartnerPS) : nullptr;
+			BRPS->SetPlayerRole(SlotIndex == 1, PartnerIndex ? *PartnerIndex : -1);
+			if (PartnerPS)
 			{
-				if (ABRPlayerState* PartnerPS = Cast<ABRPlayerState>(PlayerArray[PartnerIndex]))
-				{
-					PartnerPS->SetPlayerRole(PartnerPS->bIsLowerBody, PlayerIndex);
-				}
+				PartnerPS->SetPlayerRole(PartnerPS->bIsLowerBody, PlayerIndex);
 			}
 		}
 		if (!BRPS->bIsReady)
@@ -559,72 +775,47 @@ bool ABRGameState::AssignPlayerToLobbyTeam(int32 PlayerIndex, int32 TeamIndex, i
 	}
 
 	CheckCanStartGame();
-	CompactLobbyEntrySlots();
 	OnPlayerListChanged.Broadcast();
 	return true;
 }
 
 bool ABRGameState::MovePlayerToLobbyEntry(int32 TeamIndex, int32 SlotIndex)
 {
-	const int32 SlotsPerTeam = 3;
 	if (!HasAuthority()) return false;
-	if (TeamIndex < 0 || TeamIndex > 3 || SlotIndex < 0 || SlotIndex > 2) return false;
-	const int32 Flat = TeamIndex * SlotsPerTeam + SlotIndex;
-	if (LobbyTeamSlots.Num() <= Flat || LobbyEntrySlots.Num() < 8) return false;
-	int32 PlayerIndex = LobbyTeamSlots[Flat];
-	if (PlayerIndex < 0) return false;
-	LobbyTeamSlots[Flat] = -1;
+	EnsureLobbySlotModel();
+	if (TeamIndex < 0 || TeamIndex >= LobbySlotModel.GetNumTeams() || SlotIndex < 0 || SlotIndex >= FBRLobbySlotModel::SlotsPerTeam) return false;
+	APlayerState* Player = LobbySlotModel.GetOccupant(LobbySlotModel.TeamSlot(TeamIndex, SlotIndex));
+	if (!Player) return false;
+
+	// 빈 자리 없으면 그대로 둠 (한 플레이어는 한 슬롯에만 있으므로 대기열 중복 표시도 없음)
+	const int32 FreeSlot = LobbySlotModel.FindFreeEntrySlot();
+	if (FreeSlot == INDEX_NONE) return false;
+	LobbySlotModel.Place(Player, FreeSlot);
 
 	// 대기열로 나간 플레이어의 UserInfo(PlayerState) 초기화. TeamID 0 = 대기열(관전)
-	if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(PlayerArray[PlayerIndex]))
+	if (ABRPlayerState* BRPS = Cast<ABRPlayerState>(Player))
 	{
 		BRPS->SetTeamNumber(0);
 		BRPS->SetSpectator(true); // 대기열 = 관전
 		// 같은 팀 슬롯 1/2에 남아 있는 파트너가 있으면 연결 해제
 		for (int32 s = 1; s <= 2; s++)
 		{
-			const int32 OtherFlat = TeamIndex * SlotsPerTeam + s;
-			if (LobbyTeamSlots.IsValidIndex(OtherFlat))
+			if (ABRPlayerState* PartnerPS = Cast<ABRPlayerState>(LobbySlotModel.GetOccupant(LobbySlotModel.TeamSlot(TeamIndex, s))))
 			{
-				const int32 PartnerIndex = LobbyTeamSlots[OtherFlat];
-				if (PartnerIndex >= 0 && PartnerIndex < PlayerArray.Num())
-				{
-					if (ABRPlayerState* PartnerPS = Cast<ABRPlayerState>(PlayerArray[PartnerIndex]))
-					{
-						PartnerPS->PartnerPlayerState = nullptr;
-						PartnerPS->ConnectedPlayerIndex = -1;
-						PartnerPS->SetPlayerRole(PartnerPS->bIsLowerBody, -1);
-					}
-				}
+				PartnerPS->PartnerPlayerState = nullptr;
+				PartnerPS->ConnectedPlayerIndex = -1;
+				PartnerPS->SetPlayerRole(PartnerPS->bIsLowerBody, -1);
 			}
 		}
 		BRPS->PartnerPlayerState = nullptr;
 		BRPS->ConnectedPlayerIndex = -1;
 	}
 
-	// 같은 플레이어가 이미 대기열에 있으면 제거 (중복 표시 방지: 대기열 버튼 이중 호출 등)
-	for (int32 i = 0; i < LobbyEntrySlots.Num(); i++)
-	{
-		if (LobbyEntrySlots[i] == PlayerIndex)
-		{
-			LobbyEntrySlots[i] = -1;
-			break;
-		}
-	}
-
-	for (int32 i = 0; i < LobbyEntrySlots.Num(); i++)
-	{
-		if (LobbyEntrySlots[i] == -1)
-		{
-			LobbyEntrySlots[i] = PlayerIndex;
-			// 대기열에 넣은 뒤 압축해서 순서 유지 (뒤에 빈 칸이 있으면 당겨서 채움)
-			CompactLobbyEntrySlots();
-			OnPlayerListChanged.Broadcast();
-			return true;
-		}
-	}
-	LobbyTeamSlots[Flat] = PlayerIndex; // 빈 자리 없으면 원복
-	return false;
+	// 대기열에 넣은 뒤 압축해서 순서 유지 (뒤에 빈 칸이 있으면 당겨서 채움)
+	LobbySlotModel.CompactEntries();
+	SyncLobbySlotArrays();
+	OnPlayerListChanged.Broadcast();
+	return true;
 }
 
 FString ABRGameState::GetHostPlayerName() const
@@ -655,7 +846,7 @@ void ABRGameState::SetRoomTitle(const FString& InRoomTitle)
 
 void ABRGameState::OnRep_RoomTitle()
 {
-	// UI 갱신 시 활용 가능
+	UBRLobbyViewModelSubsystem::Notify(this, EBRLobbyViewDirty::RoomTitle);
 }
 
 void ABRGameState::OnRep_WinningTeamNumber()
@@ -758,3 +949,11 @@ void ABRGameState::MulticastMatchEnded_Implementation(FVector WinnerLocation, co
 	// BlueprintAssignable 델리게이트 브로드캐스트 -> 위젯 등에서 수신
 	OnMatchEnded.Broadcast(WinnerLocation, UpperName, LowerName);
 }
+
+void ABRGameState::MulticastCombatEvents_Implementation(const TArray<FBRCombatEvent>& Events)
+{
+	for (const FBRCombatEvent& Event : Events)
+	{
+		UBRCombatEventSubsystem::PlayEvent(this, Event);
+	}
+}
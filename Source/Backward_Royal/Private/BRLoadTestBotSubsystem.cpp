@@ -0,0 +1,515 @@
+// BRLoadTestBotSubsystem.cpp
+#include "BRLoadTestBotSubsystem.h"
+#include "CoreGlobals.h"
+#include "BRActorRegistrySubsystem.h"
+#include "BRBenchmarkCsv.h"
+#include "BRGameSession.h"
+#include "BRGameState.h"
+#include "BRPlayerController.h"
+#include "BRPlayerState.h"
+#include "PlayerCharacter.h"
+#include "UpperBodyPawn.h"
+#include "EnhancedInputSubsystems.h"
+#include "InputAction.h"
+#include "Engine/Channel.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/PlatformMisc.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "OnlineSessionSettings.h"
+
+DEFINE_LOG_CATEGORY(LogLoadTestBot);
+
+namespace BRLoadTestBot
+{
+	static const TCHAR* CsvHeader = TEXT("Timestamp,Map,Clients,Seconds,LobbyFillSec,MatchStartLatencySec,")
+		TEXT("FrameMsP50,FrameMsP99,FrameMsMax,GameThreadMsP50,GameThreadMsP99,GameThreadMsMax,")
+		TEXT("OutBytesPerClientPerSecAvg,OutBytesPerClientPerSecMax,InBytesPerClientPerSecAvg,ReliableHighWaterMax");
+
+	static void Inject(UEnhancedInputLocalPlayerSubsystem* Input, const UInputAction* Action, const FInputActionValue& Value)
+	{
+		if (Input && Action)
+		{
+			Input->InjectInputForAction(Action, Value);
+		}
+	}
+}
+
+bool UBRLoadTestBotSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("BRBot")) && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UBRLoadTestBotSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	bIsHost = FParse::Param(CommandLine, TEXT("BRBotHost"));
+	bQuitWhenDone = FParse::Param(CommandLine, TEXT("BRBotQuit"));
+
+	if (!FParse::Value(CommandLine, TEXT("BRBotName="), BotName) || BotName.IsEmpty())
+	{
+		BotName = FString::Printf(TEXT("Bot_%04d"), FMath::RandRange(0, 9999));
+	}
+	if (!FParse::Value(CommandLine, TEXT("BRBotRoom="), RoomName) || RoomName.IsEmpty())
+	{
+		RoomName = TEXT("LoadTest");
+	}
+	FParse::Value(CommandLine, TEXT("BRBotPlayers="), ExpectedPlayers);
+	FParse::Value(CommandLine, TEXT("BRBotMatchSeconds="), MatchSeconds);
+	FParse::Value(CommandLine, TEXT("BRBotTimeout="), TimeoutSeconds);
+	ExpectedPlayers = FMath::Max(ExpectedPlayers, 2);
+
+	// 봇마다 다른 움직임이 나오되 같은 이름이면 재현 가능하도록 이름으로 시드
+	Random.Initialize((int32)GetTypeHash(BotName));
+
+	BootTime = FPlatformTime::Seconds();
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBRLoadTestBotSubsystem::HandleTick));
+
+	UE_LOG(LogLoadTestBot, Log, TEXT("부하 테스트 봇 시작: %s (%s, 기대 인원 %d, 매치 %.0f초)"),
+		*BotName, bIsHost ? TEXT("호스트") : TEXT("참가자"), ExpectedPlayers, MatchSeconds);
+}
+
+void UBRLoadTestBotSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	if (ABRGameSession* GameSession = BoundGameSession.Get())
+	{
+		GameSession->OnFindSessionsComplete.Remove(FindSessionsHandle);
+	}
+	FindSessionsHandle.Reset();
+	BoundGameSession.Reset();
+
+	Super::Deinitialize();
+}
+
+FString UBRLoadTestBotSubsystem::GetResultFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Benchmarks") / TEXT("LoadTest.csv");
+}
+
+void UBRLoadTestBotSubsystem::SetPhase(EBRBotPhase NewPhase, double Now)
+{
+	if (Phase == NewPhase) return;
+
+	UE_LOG(LogLoadTestBot, Log, TEXT("[%s] 단계 %d -> %d (%.1f초 경과)"), *BotName, (int32)Phase, (int32)NewPhase, Now - BootTime);
+	Phase = NewPhase;
+	PhaseStartTime = Now;
+
+	// 로비 분기(이미 역할 배정 완료)·시작 대기 분기 어느 쪽으로 들어와도 측정 구간은 여기서 시작
+	if (NewPhase == EBRBotPhase::InMatch)
+	{
+		BeginMeasure(Now);
+	}
+}
+
+void UBRLoadTestBotSubsystem::BeginMeasure(double Now)
+{
+	// 시작 요청 → 맵 이동 → 역할 배정 → 전원 스폰 완료 신호까지 (시작을 요청하지 않았으면 -1 유지)
+	if (StartRequestTime > 0.0)
+	{
+		MatchStartLatency = Now - StartRequestTime;
+	}
+	MeasureStartTime = Now;
+	FrameTimesMs.Reset();
+	GameThreadTimesMs.Reset();
+	ConnectionStats.Reset();
+
+	UE_LOG(LogLoadTestBot, Log, TEXT("[%s] 매치 시작 지연 %.2f초, 측정 시작"), *BotName, MatchStartLatency);
+}
+
+void UBRLoadTestBotSubsystem::Finish(const TCHAR* Reason)
+{
+	if (Phase == EBRBotPhase::Finished) return;
+
+	UE_LOG(LogLoadTestBot, Log, TEXT("[%s] 종료: %s"), *BotName, Reason);
+	Phase = EBRBotPhase::Finished;
+
+	if (bQuitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("BRLoadTestBot"));
+	}
+}
+
+bool UBRLoadTestBotSubsystem::HandleTick(float DeltaTime)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_LoadTestBotTick);
+
+	if (Phase == EBRBotPhase::Finished) return true;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - BootTime > TimeoutSeconds)
+	{
+		Finish(TEXT("시간 초과"));
+		return true;
+	}
+
+	UGameInstance* GI = GetGameInstance();
+	UWorld* World = GI ? GI->GetWorld() : nullptr;
+	if (!World || !World->HasBegunPlay()) return true;
+
+	// 맵 이동 중에는 로컬 컨트롤러가 잠시 없음
+	ABRPlayerController* PC = Cast<ABRPlayerController>(GI->GetFirstLocalPlayerController(World));
+	if (!PC) return true;
+
+	switch (Phase)
+	{
+	case EBRBotPhase::Boot:
+		TickBoot(PC, World, Now);
+		break;
+
+	case EBRBotPhase::CreatingRoom:
+		if (World->GetNetMode() == NM_ListenServer && World->GetGameState<ABRGameState>())
+		{
+			SetPhase(EBRBotPhase::Lobby, Now);
+		}
+		else if (Now - PhaseStartTime > CreateRoomTimeout)
+		{
+			SetPhase(EBRBotPhase::Boot, Now);
+		}
+		break;
+
+	case EBRBotPhase::SearchingRoom:
+		if (World->GetNetMode() == NM_Client)
+		{
+			SetPhase(EBRBotPhase::Lobby, Now);
+		}
+		else if (Now >= NextSearchTime)
+		{
+			TickBoot(PC, World, Now);
+		}
+		break;
+
+	case EBRBotPhase::Joining:
+		if (World->GetNetMode() == NM_Client)
+		{
+			SetPhase(EBRBotPhase::Lobby, Now);
+		}
+		else if (Now - PhaseStartTime > JoinTimeout)
+		{
+			SetPhase(EBRBotPhase::SearchingRoom, Now);
+		}
+		break;
+
+	case EBRBotPhase::Lobby:
+		TickLobby(PC, World, Now);
+		break;
+
+	case EBRBotPhase::Starting:
+		TickStarting(PC, World, Now);
+		break;
+
+	case EBRBotPhase::InMatch:
+		TickMatch(PC, World, Now);
+		break;
+
+	default:
+		break;
+	}
+
+	return true;
+}
+
+void UBRLoadTestBotSubsystem::TickBoot(ABRPlayerController* PC, UWorld* World, double Now)
+{
+	if (World->GetNetMode() != NM_Standalone) return;
+
+	if (bIsHost)
+	{
+		PC->CreateRoomWithPlayerName(RoomName, BotName);
+		SetPhase(EBRBotPhase::CreatingRoom, Now);
+		return;
+	}
+
+	// 방 찾기 결과는 스탠드얼론 월드의 GameSession 델리게이트로 받음 (맵이 바뀌면 다시 바인딩)
+	ABRGameSession* GameSession = nullptr;
+	if (UBRActorRegistrySubsystem* Registry = UBRActorRegistrySubsystem::Get(World))
+	{
+		GameSession = Registry->GetGameSession();
+	}
+	if (!GameSession) return;
+
+	if (BoundGameSession.Get() != GameSession)
+	{
+		if (ABRGameSession* OldSession = BoundGameSession.Get())
+		{
+			OldSession->OnFindSessionsComplete.Remove(FindSessionsHandle);
+		}
+		FindSessionsHandle = GameSession->OnFindSessionsComplete.AddUObject(this, &UBRLoadTestBotSubsystem::HandleFindSessionsComplete);
+		BoundGameSession = GameSession;
+	}
+
+	PC->FindRooms();
+	NextSearchTime = Now + SearchInterval;
+	SetPhase(EBRBotPhase::SearchingRoom, Now);
+}
+
+void UBRLoadTestBotSubsystem::HandleFindSessionsComplete(const TArray<FOnlineSessionSearchResult>& Results)
+{
+	if (Phase != EBRBotPhase::SearchingRoom || Results.Num() == 0) return;
+
+	UGameInstance* GI = GetGameInstance();
+	ABRPlayerController* PC = GI ? Cast<ABRPlayerController>(GI->GetFirstLocalPlayerController()) : nullptr;
+	if (!PC) return;
+
+	// 한 장비 테스트이므로 검색된 첫 방(호스트 봇)에 참가
+	PC->JoinRoomWithPlayerName(0, BotName);
+	SetPhase(EBRBotPhase::Joining, FPlatformTime::Seconds());
+}
+
+void UBRLoadTestBotSubsystem::TickLobby(ABRPlayerController* PC, UWorld* World, double Now)
+{
+	ABRGameState* GS = World->GetGameState<ABRGameState>();
+	if (!GS) return;
+
+	// 참가자는 역할 배정이 끝난 게임 맵에 들어오면 매치 시작
+	if (GS->bBodyAssignmentComplete)
+	{
+		SetPhase(EBRBotPhase::InMatch, Now);
+		return;
+	}
+
+	if (!bIsHost)
+	{
+		// 토글 결과가 복제되기 전에 다시 누르지 않도록 간격을 둠
+		ABRPlayerState* PS = PC->GetPlayerState<ABRPlayerState>();
+		if (PS && !PS->bIsReady && Now >= NextReadyTime)
+		{
+			PC->ToggleReady();
+			NextReadyTime = Now + ReadyRetryInterval;
+		}
+		return;
+	}
+
+	if (GS->PlayerArray.Num() < ExpectedPlayers || !GS->AreAllNonHostPlayersReady()) return;
+
+	if (LobbyFilledTime <= 0.0)
+	{
+		LobbyFilledTime = Now;
+		UE_LOG(LogLoadTestBot, Log, TEXT("[%s] 전원 입장/준비 완료 (%d명, %.1f초)"), *BotName, GS->PlayerArray.Num(), Now - BootTime);
+	}
+
+	if (GS->bCanStartGame)
+	{
+		PC->StartGame();
+		StartRequestTime = Now;
+		SetPhase(EBRBotPhase::Starting, Now);
+	}
+	else if (Now >= NextTeamsTime)
+	{
+		PC->RandomTeams();
+		NextTeamsTime = Now + TeamsRetryInterval;
+	}
+}
+
+void UBRLoadTestBotSubsystem::TickStarting(ABRPlayerController* PC, UWorld* World, double Now)
+{
+	ABRGameState* GS = World->GetGameState<ABRGameState>();
+	if (GS && GS->bBodyAssignmentComplete && GS->bAllClientsSpawnReady)
+	{
+		SetPhase(EBRBotPhase::InMatch, Now);
+		return;
+	}
+
+	// 로비에 그대로 남아 있으면 (시작 조건이 바뀌었거나 요청 유실) 다시 요청
+	if (GS && !GS->bBodyAssignmentComplete && World->GetNetMode() == NM_ListenServer && Now - PhaseStartTime > StartRetryInterval)
+	{
+		UE_LOG(LogLoadTestBot, Warning, TEXT("[%s] %.0f초 동안 매치가 시작되지 않아 로비 단계부터 재시도"), *BotName, StartRetryInterval);
+		SetPhase(EBRBotPhase::Lobby, Now);
+	}
+}
+
+void UBRLoadTestBotSubsystem::TickMatch(ABRPlayerController* PC, UWorld* World, double Now)
+{
+	// 참가자: 호스트가 끝나 연결이 끊기면(스탠드얼론 복귀) 종료
+	if (!bIsHost && World->GetNetMode() == NM_Standalone)
+	{
+		Finish(TEXT("서버 연결 종료"));
+		return;
+	}
+
+	UEnhancedInputLocalPlayerSubsystem* Input = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer());
+	APawn* Pawn = PC->GetPawn();
+	if (APlayerCharacter* Lower = Cast<APlayerCharacter>(Pawn))
+	{
+		DriveLowerBody(Lower, Input, Now);
+	}
+	else if (AUpperBodyPawn* Upper = Cast<AUpperBodyPawn>(Pawn))
+	{
+		DriveUpperBody(Upper, Input, Now);
+	}
+
+	if (bIsHost)
+	{
+		SampleServer(World, Now);
+		if (Now - MeasureStartTime >= MatchSeconds)
+		{
+			WriteReport(World, Now);
+			Finish(TEXT("측정 완료"));
+		}
+	}
+}
+
+void UBRLoadTestBotSubsystem::DriveLowerBody(APlayerCharacter* Lower, UEnhancedInputLocalPlayerSubsystem* Input, double Now)
+{
+	// 몇 초마다 방향과 달리기 여부를 새로 정함. 이동/달리기는 누르고 있는 입력이라 매 프레임 주입
+	if (Now >= NextWanderTime)
+	{
+		const float Angle = Random.FRandRange(0.0f, 2.0f * PI);
+		WanderInput = FVector2D(FMath::Cos(Angle), FMath::Sin(Angle));
+		bSprinting = Random.FRand() < 0.35f;
+		NextWanderTime = Now + Random.FRandRange(1.5f, 4.0f);
+	}
+
+	BRLoadTestBot::Inject(Input, Lower->MoveAction, FInputActionValue(WanderInput));
+	if (bSprinting)
+	{
+		BRLoadTestBot::Inject(Input, Lower->SprintAction, FInputActionValue(true));
+	}
+
+	// 점프는 한 프레임만 눌렀다 뗌 (Started → Completed)
+	if (Now >= NextJumpTime)
+	{
+		BRLoadTestBot::Inject(Input, Lower->JumpAction, FInputActionValue(true));
+		NextJumpTime = Now + Random.FRandRange(2.0f, 6.0f);
+	}
+}
+
+void UBRLoadTestBotSubsystem::DriveUpperBody(AUpperBodyPawn* Upper, UEnhancedInputLocalPlayerSubsystem* Input, double Now)
+{
+	// 조준: 일정 시간 같은 방향으로 시점을 돌려 ServerUpdateAimRotation 트래픽을 실제 플레이와 비슷하게 유지
+	if (Now >= NextAimTime)
+	{
+		AimInput = FVector2D(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-0.3f, 0.3f));
+		NextAimTime = Now + Random.FRandRange(0.5f, 2.0f);
+	}
+	BRLoadTestBot::Inject(Input, Upper->LookAction, FInputActionValue(AimInput));
+
+	if (Now >= NextAttackTime)
+	{
+		BRLoadTestBot::Inject(Input, Upper->AttackAction, FInputActionValue(true));
+		NextAttackTime = Now + Random.FRandRange(0.8f, 2.0f);
+	}
+
+	if (Now >= NextInteractTime)
+	{
+		BRLoadTestBot::Inject(Input, Upper->InteractAction, FInputActionValue(true));
+		NextInteractTime = Now + Random.FRandRange(3.0f, 6.0f);
+	}
+}
+
+void UBRLoadTestBotSubsystem::SampleServer(UWorld* World, double Now)
+{
+	FrameTimesMs.Add((float)(FApp::GetDeltaTime() * 1000.0));
+	GameThreadTimesMs.Add((float)FPlatformTime::ToMilliseconds(GGameThreadTime));
+
+	UNetDriver* NetDriver = World->GetNetDriver();
+	if (!NetDriver) return;
+
+	for (UNetConnection* Connection : NetDriver->ClientConnections)
+	{
+		if (!Connection) continue;
+
+		FConnectionStats* Stats = ConnectionStats.Find(Connection);
+		if (!Stats)
+		{
+			Stats = &ConnectionStats.Add(Connection);
+			Stats->FirstSeenTime = Now;
+			Stats->StartOutBytes = Connection->OutTotalBytes;
+			Stats->StartInBytes = Connection->InTotalBytes;
+		}
+
+		if (Stats->Name.IsEmpty() && Connection->PlayerController && Connection->PlayerController->PlayerState)
+		{
+			Stats->Name = Connection->PlayerController->PlayerState->GetPlayerName();
+		}
+		Stats->LastSeenTime = Now;
+		Stats->LastOutBytes = Connection->OutTotalBytes;
+		Stats->LastInBytes = Connection->InTotalBytes;
+
+		// 아직 ACK 받지 못한 reliable 번치 수. 한도(채널당 RELIABLE_BUFFER)에 닿으면 연결이 끊기므로 최고치를 추적
+		for (const UChannel* Channel : Connection->OpenChannels)
+		{
+			if (Channel)
+			{
+				Stats->ReliableHighWater = FMath::Max(Stats->ReliableHighWater, Channel->NumOutRec);
+			}
+		}
+	}
+}
+
+void UBRLoadTestBotSubsystem::WriteReport(UWorld* World, double Now) const
+{
+	const double Seconds = FMath::Max(Now - MeasureStartTime, UE_DOUBLE_SMALL_NUMBER);
+
+	TArray<float> SortedFrames = FrameTimesMs;
+	TArray<float> SortedGameThread = GameThreadTimesMs;
+	SortedFrames.Sort();
+	SortedGameThread.Sort();
+
+	double OutRateSum = 0.0;
+	double OutRateMax = 0.0;
+	double InRateSum = 0.0;
+	int32 ReliableHighWaterMax = 0;
+	for (const TPair<TWeakObjectPtr<UNetConnection>, FConnectionStats>& Pair : ConnectionStats)
+	{
+		const FConnectionStats& Stats = Pair.Value;
+		const double ConnectionSeconds = FMath::Max(Stats.LastSeenTime - Stats.FirstSeenTime, UE_DOUBLE_SMALL_NUMBER);
+		const double OutRate = (Stats.LastOutBytes - Stats.StartOutBytes) / ConnectionSeconds;
+		const double InRate = (Stats.LastInBytes - Stats.StartInBytes) / ConnectionSeconds;
+
+		OutRateSum += OutRate;
+		OutRateMax = FMath::Max(OutRateMax, OutRate);
+		InRateSum += InRate;
+		ReliableHighWaterMax = FMath::Max(ReliableHighWaterMax, Stats.ReliableHighWater);
+
+		UE_LOG(LogLoadTestBot, Log, TEXT("  클라이언트 %s: 송신 %.0f B/s, 수신 %.0f B/s, reliable 최고 수위 %d"),
+			Stats.Name.IsEmpty() ? TEXT("(이름 없음)") : *Stats.Name, OutRate, InRate, Stats.ReliableHighWater);
+	}
+	const int32 NumClients = ConnectionStats.Num();
+
+	const FString Row = FString::Printf(TEXT("%s,%s,%d,%.1f,%.2f,%.2f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.0f,%.0f,%.0f,%d"),
+		*FDateTime::UtcNow().ToIso8601(),
+		*UGameplayStatics::GetCurrentLevelName(World, true),
+		NumClients,
+		Seconds,
+		LobbyFilledTime > 0.0 ? LobbyFilledTime - BootTime : -1.0,
+		MatchStartLatency,
+		BRBenchmarkCsv::Percentile(SortedFrames, 0.5f),
+		BRBenchmarkCsv::Percentile(SortedFrames, 0.99f),
+		SortedFrames.Num() > 0 ? SortedFrames.Last() : 0.0f,
+		BRBenchmarkCsv::Percentile(SortedGameThread, 0.5f),
+		BRBenchmarkCsv::Percentile(SortedGameThread, 0.99f),
+		SortedGameThread.Num() > 0 ? SortedGameThread.Last() : 0.0f,
+		NumClients > 0 ? OutRateSum / NumClients : 0.0,
+		OutRateMax,
+		NumClients > 0 ? InRateSum / NumClients : 0.0,
+		ReliableHighWaterMax);
+
+	const FString FilePath = GetResultFilePath();
+	if (BRBenchmarkCsv::AppendRow(FilePath, BRLoadTestBot::CsvHeader, Row))
+	{
+		UE_LOG(LogLoadTestBot, Log, TEXT("부하 테스트 결과 (%s): %s"), *FilePath, *Row);
+	}
+	else
+	{
+		UE_LOG(LogLoadTestBot, Error, TEXT("결과 기록 실패: %s"), *FilePath);
+	}
+
+	UE_LOG(LogLoadTestBot, Log, TEXT("클라이언트 %d명 %.0f초: 게임 스레드 p50 %.2fms / p99 %.2fms, 클라이언트당 송신 평균 %.0f B/s, reliable 최고 수위 %d, 매치 시작 지연 %.2f초"),
+		NumClients, Seconds,
+		BRBenchmarkCsv::Percentile(SortedGameThread, 0.5f), BRBenchmarkCsv::Percentile(SortedGameThread, 0.99f),
+		NumClients > 0 ? OutRateSum / NumClients : 0.0, ReliableHighWaterMax, MatchStartLatency);
+}
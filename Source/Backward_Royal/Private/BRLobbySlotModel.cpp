@@ -0,0 +1,151 @@
+// BRLobbySlotModel.cpp
+#include "BRLobbySlotModel.h"
+#include "GameFramework/PlayerState.h"
+
+namespace
+{
+	uint64 LowBitsMask(int32 NumBits)
+	{
+		return NumBits >= 64 ? ~0ull : ((1ull << NumBits) - 1ull);
+	}
+}
+
+void FBRLobbySlotModel::Configure(int32 InNumEntrySlots, int32 InNumTeams)
+{
+	const int32 NewNumEntrySlots = FMath::Clamp(InNumEntrySlots, 1, MaxSlotsPerMask);
+	const int32 NewNumTeams = FMath::Clamp(InNumTeams, 1, MaxSlotsPerMask / SlotsPerTeam);
+	if (NewNumEntrySlots == NumEntrySlots && NewNumTeams == NumTeams)
+	{
+		return;
+	}
+	NumEntrySlots = NewNumEntrySlots;
+	NumTeams = NewNumTeams;
+	Reset();
+}
+
+void FBRLobbySlotModel::Reset()
+{
+	Occupants.Reset();
+	Occupants.SetNum(NumEntrySlots + GetNumTeamSlots());
+	SlotByPlayer.Reset();
+	FreeEntryMask = LowBitsMask(NumEntrySlots);
+	FreeTeamMask = LowBitsMask(GetNumTeamSlots());
+}
+
+int32 FBRLobbySlotModel::FindSlot(const APlayerState* Player) const
+{
+	const int32* Found = Player ? SlotByPlayer.Find(Player) : nullptr;
+	return Found ? *Found : INDEX_NONE;
+}
+
+APlayerState* FBRLobbySlotModel::GetOccupant(int32 Slot) const
+{
+	return Occupants.IsValidIndex(Slot) ? Occupants[Slot].Get() : nullptr;
+}
+
+int32 FBRLobbySlotModel::FindFreeEntrySlot() const
+{
+	return FreeEntryMask ? (int32)FMath::CountTrailingZeros64(FreeEntryMask) : INDEX_NONE;
+}
+
+void FBRLobbySlotModel::SetOccupant(int32 Slot, APlayerState* Player)
+{
+	Occupants[Slot] = Player;
+	SlotByPlayer.Add(Player, Slot);
+	if (IsEntrySlot(Slot))
+	{
+		FreeEntryMask &= ~(1ull << Slot);
+	}
+	else
+	{
+		FreeTeamMask &= ~(1ull << TeamFlatOf(Slot));
+	}
+}
+
+void FBRLobbySlotModel::ClearSlot(int32 Slot)
+{
+	Occupants[Slot].Reset();
+	if (IsEntrySlot(Slot))
+	{
+		FreeEntryMask |= 1ull << Slot;
+	}
+	else
+	{
+		FreeTeamMask |= 1ull << TeamFlatOf(Slot);
+	}
+}
+
+bool FBRLobbySlotModel::Place(APlayerState* Player, int32 Slot)
+{
+	if (!Player || !Occupants.IsValidIndex(Slot))
+	{
+		return false;
+	}
+	const APlayerState* Current = Occupants[Slot].Get();
+	if (Current == Player)
+	{
+		return true;
+	}
+	if (Current)
+	{
+		return false;
+	}
+	Remove(Player);
+	SetOccupant(Slot, Player);
+	return true;
+}
+
+int32 FBRLobbySlotModel::Remove(const APlayerState* Player)
+{
+	int32 Slot = INDEX_NONE;
+	if (!Player || !SlotByPlayer.RemoveAndCopyValue(Player, Slot))
+	{
+		return INDEX_NONE;
+	}
+	ClearSlot(Slot);
+	return Slot;
+}
+
+int32 FBRLobbySlotModel::RemoveIf(TFunctionRef<bool(const APlayerState*)> ShouldRemove)
+{
+	int32 NumRemoved = 0;
+	for (auto It = SlotByPlayer.CreateIterator(); It; ++It)
+	{
+		const APlayerState* Player = It.Key().Get();
+		if (Player && !ShouldRemove(Player))
+		{
+			continue;
+		}
+		ClearSlot(It.Value());
+		It.RemoveCurrent();
+		NumRemoved++;
+	}
+	return NumRemoved;
+}
+
+bool FBRLobbySlotModel::CompactEntries()
+{
+	// 점유 비트가 0번부터 연속이면(= 0b0..01..1) 이미 압축된 상태
+	const uint64 Occupied = ~FreeEntryMask & LowBitsMask(NumEntrySlots);
+	if ((Occupied & (Occupied + 1ull)) == 0)
+	{
+		return false;
+	}
+
+	int32 Write = 0;
+	for (int32 Read = 0; Read < NumEntrySlots; Read++)
+	{
+		APlayerState* Player = Occupants[Read].Get();
+		if (!Player)
+		{
+			continue;
+		}
+		if (Read != Write)
+		{
+			ClearSlot(Read);
+			SetOccupant(Write, Player);
+		}
+		Write++;
+	}
+	return true;
+}
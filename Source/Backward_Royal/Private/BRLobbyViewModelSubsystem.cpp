@@ -0,0 +1,93 @@
+// BRLobbyViewModelSubsystem.cpp
+#include "BRLobbyViewModelSubsystem.h"
+#include "BRGameState.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "TimerManager.h"
+
+bool UBRLobbyViewModelSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// 전용 서버에는 로비 UI가 없음
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UBRLobbyViewModelSubsystem::Deinitialize()
+{
+	if (ABRGameState* GS = BoundGameState.Get())
+	{
+		GS->OnPlayerListChanged.RemoveDynamic(this, &UBRLobbyViewModelSubsystem::HandlePlayerListChanged);
+		GS->OnTeamChanged.RemoveDynamic(this, &UBRLobbyViewModelSubsystem::HandleTeamChanged);
+	}
+	BoundGameState.Reset();
+	OnLobbyViewUpdated.Clear();
+	PendingFlags = EBRLobbyViewDirty::None;
+
+	Super::Deinitialize();
+}
+
+UBRLobbyViewModelSubsystem* UBRLobbyViewModelSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UBRLobbyViewModelSubsystem>() : nullptr;
+}
+
+void UBRLobbyViewModelSubsystem::Notify(const UObject* WorldContextObject, EBRLobbyViewDirty Flags)
+{
+	if (UBRLobbyViewModelSubsystem* ViewModel = Get(WorldContextObject))
+	{
+		ViewModel->MarkDirty(Flags);
+	}
+}
+
+void UBRLobbyViewModelSubsystem::BindGameState(ABRGameState* InGameState)
+{
+	if (!InGameState || BoundGameState.Get() == InGameState) return;
+
+	if (ABRGameState* OldGS = BoundGameState.Get())
+	{
+		OldGS->OnPlayerListChanged.RemoveDynamic(this, &UBRLobbyViewModelSubsystem::HandlePlayerListChanged);
+		OldGS->OnTeamChanged.RemoveDynamic(this, &UBRLobbyViewModelSubsystem::HandleTeamChanged);
+	}
+
+	BoundGameState = InGameState;
+	InGameState->OnPlayerListChanged.AddUniqueDynamic(this, &UBRLobbyViewModelSubsystem::HandlePlayerListChanged);
+	InGameState->OnTeamChanged.AddUniqueDynamic(this, &UBRLobbyViewModelSubsystem::HandleTeamChanged);
+
+	// 구독 이전에 이미 도착한 복제분 반영
+	MarkDirty(EBRLobbyViewDirty::All);
+}
+
+void UBRLobbyViewModelSubsystem::MarkDirty(EBRLobbyViewDirty Flags)
+{
+	if (Flags == EBRLobbyViewDirty::None) return;
+
+	const bool bAlreadyScheduled = PendingFlags != EBRLobbyViewDirty::None;
+	PendingFlags |= Flags;
+	if (bAlreadyScheduled) return;
+
+	// 같은 프레임에 들어온 OnRep들을 모아 다음 틱에 1회만 갱신
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UBRLobbyViewModelSubsystem::Flush));
+	}
+}
+
+void UBRLobbyViewModelSubsystem::HandlePlayerListChanged()
+{
+	MarkDirty(EBRLobbyViewDirty::PlayerList | EBRLobbyViewDirty::RoomTitle);
+}
+
+void UBRLobbyViewModelSubsystem::HandleTeamChanged()
+{
+	MarkDirty(EBRLobbyViewDirty::Teams);
+}
+
+void UBRLobbyViewModelSubsystem::Flush()
+{
+	const EBRLobbyViewDirty Flags = PendingFlags;
+	PendingFlags = EBRLobbyViewDirty::None;
+	if (Flags == EBRLobbyViewDirty::None) return;
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_LobbyViewFlush);
+	OnLobbyViewUpdated.Broadcast(Flags);
+}
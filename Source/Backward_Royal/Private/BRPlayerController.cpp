@@ -2,6 +2,7 @@
 #include "BRPlayerController.h"
 #include "BRCheatManager.h"
 #include "BRGameSession.h"
+#include "BRActorRegistrySubsystem.h"
 #include "BRGameState.h"
 #include "BRPlayerState.h"
 #include "BRGameMode.h"
@@ -20,7 +21,6 @@
 #include "TimerManager.h"
 #include "Net/UnrealNetwork.h"
 #include "Blueprint/UserWidget.h"
-#include "EngineUtils.h"
 #include "Misc/Char.h"
 #include "Kismet/GameplayStatics.h"
 #include "Misc/Paths.h"
@@ -400,18 +400,11 @@ void ABRPlayerController::OnPossess(APawn* aPawn)
 {
 	Super::OnPossess(aPawn);
 
-	// Seamless Travel 후 게임 맵에서 GameMode BeginPlay가 호출되지 않을 수 있음 → Possess 시점에 랜덤 팀 적용 예약 (폴백, 이미 예약됐으면 한 번만)
+	// 랜덤 팀 역할 적용 배리어에 하체 빙의 기록 (GameMode BeginPlay보다 먼저 오면 여기서 배리어를 엶)
 	if (HasAuthority() && aPawn)
 	{
-		if (UBRGameInstance* GI = Cast<UBRGameInstance>(GetGameInstance()))
-		{
-			if (GI->GetPendingApplyRandomTeamRoles())
-			{
-				ABRGameMode* GM = GetWorld() ? GetWorld()->GetAuthGameMode<ABRGameMode>() : nullptr;
-				if (GM && !GM->HasScheduledInitialRoleApply())
-					GM->ScheduleInitialRoleApplyIfNeeded();
-			}
-		}
+		if (ABRGameMode* GM = GetWorld() ? GetWorld()->GetAuthGameMode<ABRGameMode>() : nullptr)
+			GM->NotifyRoleApplyPawnPossessed(this, aPawn);
 	}
 
 	if (IsLocalController() && aPawn)
@@ -554,12 +547,26 @@ void ABRPlayerController::AcknowledgePossession(APawn* P)
 
 void ABRPlayerController::ServerReportSpawnReady_Implementation()
 {
+	// 하체 빙의 확인은 역할 적용 배리어의 마지막 단계
+	if (ABRGameMode* GM = GetWorld() ? GetWorld()->GetAuthGameMode<ABRGameMode>() : nullptr)
+	{
+		GM->NotifyRoleApplyClientAck(this);
+	}
 	if (ABRGameState* GS = GetWorld() ? GetWorld()->GetGameState<ABRGameState>() : nullptr)
 	{
 		GS->ReportClientSpawnReady(this);
 	}
 }
 
+void ABRPlayerController::ServerReportStagePreloadProgress_Implementation(const FString& StagePackageName, uint8 Percent)
+{
+	ABRGameState* GS = GetWorld() ? GetWorld()->GetGameState<ABRGameState>() : nullptr;
+	ABRPlayerState* BRPS = GetPlayerState<ABRPlayerState>();
+	if (!GS || !BRPS || StagePackageName != GS->PendingStageMapPath)
+		return;
+	BRPS->SetStagePreloadPercent(FMath::Min<uint8>(Percent, 100));
+}
+
 // 클라이언트: 네트워크를 통해 내 폰 정보가 갱신되었을 때
 void ABRPlayerController::OnRep_Pawn()
 {
@@ -1044,13 +1051,12 @@ void ABRPlayerController::JoinRoom(int32 SessionIndex)
 			BRGameSession = Cast<ABRGameSession>(GameMode->GameSession);
 		}
 		
-		// 2. GameMode에 없으면 (NM_Client 모드 등), 직접 GameSession 찾기
+		// 2. GameMode에 없으면 (NM_Client 모드 등), 레지스트리에 등록된 GameSession 사용
 		if (!BRGameSession)
 		{
-			for (TActorIterator<ABRGameSession> It(World); It; ++It)
+			if (UBRActorRegistrySubsystem* Registry = UBRActorRegistrySubsystem::Get(World))
 			{
-				BRGameSession = *It;
-				break;
+				BRGameSession = Registry->GetGameSession();
 			}
 		}
 
@@ -1276,9 +1282,14 @@ void ABRPlayerController::StartGame()
 static constexpr int32 MaxPlayerNameLength = 24;
 static constexpr int32 MaxRoomNameLength = 64;
 static constexpr int32 MinTeamNumber = 0;
-static constexpr int32 MaxTeamNumber = 3;
 static constexpr int32 MaxSlotsPerTeam = 3;
-static constexpr int32 NumLobbyTeams = 4;
+
+/** 허용 팀 번호 상한 = 서버 설정 팀 수 (GameMode LobbyTeamCount → GameState NumLobbyTeams). 팀 번호는 1부터 */
+static int32 GetMaxTeamNumber(const UWorld* World)
+{
+	const ABRGameState* GS = World ? World->GetGameState<ABRGameState>() : nullptr;
+	return GS ? GS->NumLobbyTeams : 0;
+}
 
 /** RPC 수신 이름 정제: 앞뒤 공백 제거, 최대 길이, 제어문자 제거 */
 static FString SanitizePlayerName(const FString& InName)
@@ -1411,7 +1422,7 @@ void ABRPlayerController::ServerRequestRandomTeams_Implementation()
 		UBRGameInstance* GI = GetWorld() ? Cast<UBRGameInstance>(GetWorld()->GetGameInstance()) : nullptr;
 		if (GI)
 		{
-			GI->SavePendingRolesForTravel(BRGameState);
+			GI->SaveTravelManifest(BRGameState);
 			GI->SetPendingApplyRandomTeamRoles(true);
 			UE_LOG(LogTemp, Warning, TEXT("[랜덤 팀 배정] 역할 저장 완료, 게임 맵 이동 시 상체/하체 Pawn 적용 예약"));
 		}
@@ -1443,6 +1454,7 @@ void ABRPlayerController::ServerRequestChangePlayerTeam_Implementation(int32 Pla
 		UE_LOG(LogTemp, Warning, TEXT("[서버 보안] 로비 전용 RPC(팀 변경): 로비 맵이 아니어서 무시"));
 		return;
 	}
+	const int32 MaxTeamNumber = GetMaxTeamNumber(GetWorld());
 	if (NewTeamNumber < MinTeamNumber || NewTeamNumber > MaxTeamNumber)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[팀 변경] 서버 보안: 잘못된 팀 번호 무시 (%d, 허용 0~%d)"), NewTeamNumber, MaxTeamNumber);
@@ -1518,6 +1530,7 @@ void ABRPlayerController::ServerSetPlayerName_Implementation(const FString& NewP
 void ABRPlayerController::ServerSetTeamNumber_Implementation(int32 NewTeamNumber)
 {
 	if (!CheckSensitiveRPCRateLimit()) return;
+	const int32 MaxTeamNumber = GetMaxTeamNumber(GetWorld());
 	if (NewTeamNumber < MinTeamNumber || NewTeamNumber > MaxTeamNumber)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[팀 번호 설정] 서버 보안: 잘못된 팀 번호 무시 (%d, 허용 0~%d)"), NewTeamNumber, MaxTeamNumber);
@@ -1581,19 +1594,10 @@ void ABRPlayerController::RequestMoveMyPlayerToLobbyEntry()
 	if (!GS || !PS) return;
 	const int32 PlayerIndex = GS->PlayerArray.Find(PS);
 	if (PlayerIndex == INDEX_NONE) return;
-	const int32 SlotsPerTeam = 3;
-	for (int32 TeamIndex = 0; TeamIndex < 4; ++TeamIndex)
-	{
-		for (int32 SlotIndex = 0; SlotIndex < SlotsPerTeam; ++SlotIndex)
-		{
-			const int32 Flat = TeamIndex * SlotsPerTeam + SlotIndex;
-			if (GS->LobbyTeamSlots.IsValidIndex(Flat) && GS->LobbyTeamSlots[Flat] == PlayerIndex)
-			{
-				RequestMoveToLobbyEntry(TeamIndex, SlotIndex);
-				return;
-			}
-		}
-	}
+	// 팀 수는 서버 설정(NumLobbyTeams)을 따름. Flat = TeamIndex * SlotsPerTeam + SlotIndex
+	const int32 Flat = GS->LobbyTeamSlots.Find(PlayerIndex);
+	if (Flat == INDEX_NONE) return;
+	RequestMoveToLobbyEntry(Flat / MaxSlotsPerTeam, Flat % MaxSlotsPerTeam);
 }
 
 void ABRPlayerController::ServerRequestAssignToLobbyTeam_Implementation(int32 TeamIndex, int32 SlotIndex)
@@ -1605,13 +1609,13 @@ void ABRPlayerController::ServerRequestAssignToLobbyTeam_Implementation(int32 Te
 		UE_LOG(LogTemp, Warning, TEXT("[서버 보안] 로비 전용 RPC(팀 슬롯 배치): 로비 맵이 아니어서 무시"));
 		return;
 	}
-	if (TeamIndex < 0 || TeamIndex >= NumLobbyTeams || SlotIndex < 0 || SlotIndex >= MaxSlotsPerTeam)
+	ABRGameState* GS = GetWorld() ? GetWorld()->GetGameState<ABRGameState>() : nullptr;
+	if (!GS || !HasAuthority()) return;
+	if (TeamIndex < 0 || TeamIndex >= GS->NumLobbyTeams || SlotIndex < 0 || SlotIndex >= MaxSlotsPerTeam)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[로비] 서버 보안: 잘못된 슬롯 인덱스 무시 (Team=%d Slot=%d)"), TeamIndex, SlotIndex);
 		return;
 	}
-	ABRGameState* GS = GetWorld() ? GetWorld()->GetGameState<ABRGameState>() : nullptr;
-	if (!GS || !HasAuthority()) return;
 	APlayerState* PS = GetPlayerState<APlayerState>();
 	int32 PlayerIndex = PS ? GS->PlayerArray.Find(PS) : INDEX_NONE;
 	if (PlayerIndex != INDEX_NONE && GS->AssignPlayerToLobbyTeam(PlayerIndex, TeamIndex, SlotIndex))
@@ -1629,13 +1633,13 @@ void ABRPlayerController::ServerRequestMoveToLobbyEntry_Implementation(int32 Tea
 		UE_LOG(LogTemp, Warning, TEXT("[서버 보안] 로비 전용 RPC(대기열 이동): 로비 맵이 아니어서 무시"));
 		return;
 	}
-	if (TeamIndex < 0 || TeamIndex >= NumLobbyTeams || SlotIndex < 0 || SlotIndex >= MaxSlotsPerTeam)
+	ABRGameState* GS = GetWorld() ? GetWorld()->GetGameState<ABRGameState>() : nullptr;
+	if (!GS || !HasAuthority()) return;
+	if (TeamIndex < 0 || TeamIndex >= GS->NumLobbyTeams || SlotIndex < 0 || SlotIndex >= MaxSlotsPerTeam)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[로비] 서버 보안: 잘못된 슬롯 인덱스 무시 (Team=%d Slot=%d)"), TeamIndex, SlotIndex);
 		return;
 	}
-	ABRGameState* GS = GetWorld() ? GetWorld()->GetGameState<ABRGameState>() : nullptr;
-	if (!GS || !HasAuthority()) return;
 	if (GS->MovePlayerToLobbyEntry(TeamIndex, SlotIndex))
 	{
 		UE_LOG(LogTemp, Log, TEXT("[로비] 서버: 팀 %d 슬롯 %d -> Entry 이동"), TeamIndex + 1, SlotIndex + 1);
@@ -1685,23 +1689,16 @@ void ABRPlayerController::ClientReceiveRoomTitle_Implementation(const FString& R
 void ABRPlayerController::ClientRequestLobbyUIRefresh_Implementation()
 {
 	// 복제 타이밍을 놓친 클라이언트를 위해 서버가 요청한 로비 UI 갱신.
-	// 짧은 지연 후 GameState에서 Broadcast하여 이미 떠 있는 LobbyMenu가 갱신되도록 함.
+	// 이후 도착하는 복제는 OnRep → 로비 뷰모델로 반영되므로 지연 없이 현재 상태로 한 번 갱신.
 	UWorld* World = GetWorld();
 	if (!World || !IsLocalController()) return;
 
-	TWeakObjectPtr<ABRPlayerController> WeakThis(this);
-	FTimerHandle DummyHandle;
-	World->GetTimerManager().SetTimer(DummyHandle, [WeakThis]()
+	if (ABRGameState* GS = World->GetGameState<ABRGameState>())
 	{
-		if (!WeakThis.IsValid()) return;
-		UWorld* W = WeakThis->GetWorld();
-		if (ABRGameState* GS = W ? W->GetGameState<ABRGameState>() : nullptr)
-		{
-			GS->OnPlayerListChanged.Broadcast();
-			GS->OnTeamChanged.Broadcast();
-			UE_LOG(LogTemp, Log, TEXT("[로비 UI] 서버 요청으로 로비 갱신 브로드캐스트 완료"));
-		}
-	}, 0.2f, false);
+		GS->OnPlayerListChanged.Broadcast();
+		GS->OnTeamChanged.Broadcast();
+		UE_LOG(LogTemp, Log, TEXT("[로비 UI] 서버 요청으로 로비 갱신 브로드캐스트 완료"));
+	}
 }
 
 void ABRPlayerController::RequestRandomTeams()
@@ -2,6 +2,9 @@
 #include "BRPlayerState.h"
 #include "BRGameState.h"
 #include "BRPlayerController.h"
+#include "BRActorRegistrySubsystem.h"
+#include "BRAssetStreamingSubsystem.h"
+#include "BRLobbyViewModelSubsystem.h"
 #include "Net/UnrealNetwork.h"
 #include "UpperBodyPawn.h"
 #include "PlayerCharacter.h"
@@ -35,6 +38,7 @@ void ABRPlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 	DOREPLIFETIME(ABRPlayerState, UserUID);
 	DOREPLIFETIME(ABRPlayerState, CustomizationData);
 	DOREPLIFETIME(ABRPlayerState, CurrentStatus);
+	DOREPLIFETIME(ABRPlayerState, StagePreloadPercent);
 }
 
 // 서버 보안: 커스텀 부위 ID 허용 범위 (비정상 패킷 방지)
@@ -54,8 +58,25 @@ void ABRPlayerState::ServerSetCustomizationData_Implementation(const FBRCustomiz
 	OnRep_CustomizationData();
 }
 
+/** 방 안의 모든 플레이어가 착용한 방어구 메시만 미리 비동기 로드 (나머지 메시는 메모리에 올리지 않음) */
+static void RefreshArmorPrefetch(const ABRPlayerState* PlayerState, const ABRPlayerState* LeavingPlayer)
+{
+	if (UWorld* World = PlayerState->GetWorld())
+	{
+		if (UGameInstance* GI = World->GetGameInstance())
+		{
+			if (UBRAssetStreamingSubsystem* Streaming = GI->GetSubsystem<UBRAssetStreamingSubsystem>())
+			{
+				Streaming->PrefetchForPlayers(World->GetGameState(), LeavingPlayer);
+			}
+		}
+	}
+}
+
 void ABRPlayerState::OnRep_CustomizationData()
 {
+	RefreshArmorPrefetch(this, nullptr);
+
 	// 데이터가 갱신되었음을 캐릭터에게 알리거나, 캐릭터가 이를 감지하여 외형 갱신
 	if (OnCustomizationDataChanged.IsBound())
 	{
@@ -68,6 +89,17 @@ void ABRPlayerState::BeginPlay()
 	Super::BeginPlay();
 }
 
+void ABRPlayerState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// 플레이어가 나가면 그 플레이어만 쓰던 방어구 prefetch 핸들을 놓음 (맵 이동은 새 PlayerState가 다시 채움)
+	if (EndPlayReason == EEndPlayReason::Destroyed)
+	{
+		RefreshArmorPrefetch(this, this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ABRPlayerState::SetTeamNumber(int32 NewTeamNumber)
 {
 	if (HasAuthority())
@@ -135,17 +167,29 @@ void ABRPlayerState::ToggleReady()
 
 void ABRPlayerState::OnRep_TeamNumber()
 {
-	// UI 업데이트를 위한 이벤트 발생 가능
+	UBRLobbyViewModelSubsystem::Notify(this, EBRLobbyViewDirty::PlayerList);
 }
 
 void ABRPlayerState::OnRep_IsHost()
 {
-	// UI 업데이트를 위한 이벤트 발생 가능
+	UBRLobbyViewModelSubsystem::Notify(this, EBRLobbyViewDirty::PlayerList);
 }
 
 void ABRPlayerState::OnRep_IsReady()
 {
-	// UI 업데이트를 위한 이벤트 발생 가능
+	UBRLobbyViewModelSubsystem::Notify(this, EBRLobbyViewDirty::PlayerList);
+}
+
+void ABRPlayerState::SetStagePreloadPercent(uint8 NewPercent)
+{
+	if (!HasAuthority() || StagePreloadPercent == NewPercent) return;
+	StagePreloadPercent = NewPercent;
+	OnRep_StagePreloadPercent();
+}
+
+void ABRPlayerState::OnRep_StagePreloadPercent()
+{
+	UBRLobbyViewModelSubsystem::Notify(this, EBRLobbyViewDirty::StagePreload);
 }
 
 void ABRPlayerState::SetPlayerRole(bool bLowerBody, int32 ConnectedIndex)
@@ -216,6 +260,7 @@ void ABRPlayerState::OnRep_PlayerRole()
 	// [수정] 역할 정보(상체/하체, 파트너 인덱스 등)가 갱신되면 델리게이트를 방송하여
 	// 캐릭터(PlayerCharacter)가 이를 감지하고 파트너 연결을 재시도하도록 함.
 	OnPlayerRoleChanged.Broadcast(bIsLowerBody);
+	UBRLobbyViewModelSubsystem::Notify(this, EBRLobbyViewDirty::PlayerList);
 }
 
 void ABRPlayerState::OnRep_PartnerPlayerState()
@@ -275,6 +320,8 @@ void ABRPlayerState::SwapControlWithPartner()
 		if (UpperPawn && LowerChar)
 		{
 			UpperPawn->AttachToComponent(LowerChar->HeadMountPoint, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+			UpperPawn->ParentBodyCharacter = LowerChar;
+			UBRActorRegistrySubsystem::NotifyUpperBodyAttached(UpperPawn);
 		}
 
 		// 5. [가장 중요] 클라이언트에게 입력 시스템 재시작 명령
@@ -364,7 +411,7 @@ void ABRPlayerState::SetUserUID(const FString& NewUserUID)
 
 void ABRPlayerState::OnRep_UserUID()
 {
-	// UI 업데이트를 위한 이벤트 발생 가능
+	UBRLobbyViewModelSubsystem::Notify(this, EBRLobbyViewDirty::PlayerList);
 }
 
 void ABRPlayerState::NotifyUserInfoChanged()
@@ -0,0 +1,327 @@
+// BRReplicationGraph.cpp
+#include "BRReplicationGraph.h"
+#include "BRPlayerState.h"
+#include "BaseWeapon.h"
+#include "DropItem.h"
+#include "ReplicationGraphTypes.h"
+#include "Engine/World.h"
+#include "Engine/NetConnection.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/GameStateBase.h"
+#include "UObject/UObjectIterator.h"
+
+bool UBRReplicationGraph::IsCharacterClass(const UClass* Class)
+{
+	// 하체(APlayerCharacter)·상체(AUpperBodyPawn) 모두 APawn
+	return Class && Class->IsChildOf(APawn::StaticClass());
+}
+
+bool UBRReplicationGraph::IsPickupClass(const UClass* Class)
+{
+	return Class && (Class->IsChildOf(ABaseWeapon::StaticClass()) || Class->IsChildOf(ADropItem::StaticClass()));
+}
+
+void UBRReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// 그래프는 프레임 단위로 동작: 클래스 CDO의 NetUpdateFrequency → 복제 주기(프레임), NetCullDistance → 그리드 컬 거리
+	int32 NumClasses = 0;
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject(false));
+		if (!ActorCDO || !ActorCDO->GetIsReplicated()) continue;
+		if (Class->GetName().StartsWith(TEXT("SKEL_")) || Class->GetName().StartsWith(TEXT("REINST_"))) continue;
+
+		FClassReplicationInfo ClassInfo;
+		ClassInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(ActorCDO->GetNetUpdateFrequency());
+		if (ActorCDO->bAlwaysRelevant || ActorCDO->bOnlyRelevantToOwner)
+		{
+			ClassInfo.SetCullDistanceSquared(0.f);
+		}
+		else
+		{
+			ClassInfo.SetCullDistanceSquared(ActorCDO->GetNetCullDistanceSquared());
+		}
+		GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+		NumClasses++;
+	}
+	UE_LOG(LogTemp, Log, TEXT("[리플리케이션 그래프] 복제 클래스 설정 %d개"), NumClasses);
+}
+
+void UBRReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = GridCellSize;
+	GridNode->SpatialBias = GridSpatialBias;
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	TeamPartnersNode = CreateNewNode<UBRReplicationGraphNode_TeamPartners>();
+	AddGlobalGraphNode(TeamPartnersNode);
+
+	PickupDormancyNode = CreateNewNode<UBRReplicationGraphNode_PickupDormancy>();
+	PickupDormancyNode->RestSecondsBeforeDormant = PickupRestSecondsBeforeDormant;
+	AddGlobalGraphNode(PickupDormancyNode);
+}
+
+void UBRReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* AlwaysRelevantConnectionNode = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	// 스트리밍 레벨 표시 여부에 따라 목록을 거르므로 클라이언트 레벨 가시성 변경을 받음
+	RepGraphConnection->OnClientVisibleLevelNameAdd.AddUObject(AlwaysRelevantConnectionNode, &UReplicationGraphNode_AlwaysRelevant_ForConnection::OnClientLevelVisibilityAdd);
+	RepGraphConnection->OnClientVisibleLevelNameRemove.AddUObject(AlwaysRelevantConnectionNode, &UReplicationGraphNode_AlwaysRelevant_ForConnection::OnClientLevelVisibilityRemove);
+	AddConnectionGraphNode(AlwaysRelevantConnectionNode, RepGraphConnection);
+}
+
+UBRReplicationGraph::EBRRepRoute UBRReplicationGraph::GetRoute(const AActor* Actor) const
+{
+	if (Actor->bAlwaysRelevant || Actor->IsA<AGameStateBase>())
+	{
+		return EBRRepRoute::AlwaysRelevant;
+	}
+	if (Actor->bOnlyRelevantToOwner)
+	{
+		return EBRRepRoute::OwnerOnly;
+	}
+	if (IsCharacterClass(Actor->GetClass()))
+	{
+		return EBRRepRoute::SpatializeDynamic;
+	}
+	// 픽업과 나머지(발판, 스위치 등)는 휴면이면 정적 셀, 깨어 있으면 동적 셀
+	return EBRRepRoute::SpatializeDormancy;
+}
+
+void UBRReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	AActor* Actor = ActorInfo.GetActor();
+	switch (GetRoute(Actor))
+	{
+	case EBRRepRoute::AlwaysRelevant:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	case EBRRepRoute::OwnerOnly:
+		// 소유 연결은 보통 스폰 직후에 정해지므로 ServerReplicateActors에서 연결 노드로 옮김
+		ActorsWithoutNetConnection.Add(Actor);
+		break;
+	case EBRRepRoute::SpatializeDynamic:
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+	case EBRRepRoute::SpatializeDormancy:
+		GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+		if (IsPickupClass(Actor->GetClass()))
+		{
+			PickupDormancyNode->NotifyAddNetworkActor(ActorInfo);
+		}
+		break;
+	}
+}
+
+void UBRReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	AActor* Actor = ActorInfo.GetActor();
+	switch (GetRoute(Actor))
+	{
+	case EBRRepRoute::AlwaysRelevant:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		SetActorDestructionInfoToIgnoreDistanceCulling(Actor);
+		break;
+	case EBRRepRoute::OwnerOnly:
+		if (ActorsWithoutNetConnection.RemoveSingleSwap(Actor, EAllowShrinking::No) == 0)
+		{
+			if (UReplicationGraphNode_AlwaysRelevant_ForConnection* Node = GetAlwaysRelevantNodeForConnection(Actor->GetNetConnection()))
+			{
+				Node->NotifyRemoveNetworkActor(ActorInfo);
+			}
+		}
+		break;
+	case EBRRepRoute::SpatializeDynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+	case EBRRepRoute::SpatializeDormancy:
+		GridNode->RemoveActor_Dormancy(ActorInfo);
+		if (IsPickupClass(Actor->GetClass()))
+		{
+			PickupDormancyNode->NotifyRemoveNetworkActor(ActorInfo, false);
+		}
+		break;
+	}
+}
+
+UReplicationGraphNode_AlwaysRelevant_ForConnection* UBRReplicationGraph::GetAlwaysRelevantNodeForConnection(UNetConnection* Connection)
+{
+	if (!Connection) return nullptr;
+	UNetReplicationGraphConnection* GraphConnection = FindOrAddConnectionManager(Connection);
+	if (!GraphConnection) return nullptr;
+	for (UReplicationGraphNode* ConnectionNode : GraphConnection->GetConnectionGraphNodes())
+	{
+		if (UReplicationGraphNode_AlwaysRelevant_ForConnection* Node = Cast<UReplicationGraphNode_AlwaysRelevant_ForConnection>(ConnectionNode))
+		{
+			return Node;
+		}
+	}
+	return nullptr;
+}
+
+int32 UBRReplicationGraph::ServerReplicateActors(float DeltaSeconds)
+{
+	// 소유 연결이 생긴 bOnlyRelevantToOwner 액터를 해당 연결 노드로 이동
+	for (int32 i = ActorsWithoutNetConnection.Num() - 1; i >= 0; --i)
+	{
+		bool bRemove = true;
+		if (AActor* Actor = ActorsWithoutNetConnection[i])
+		{
+			if (UNetConnection* Connection = Actor->GetNetConnection())
+			{
+				if (UReplicationGraphNode_AlwaysRelevant_ForConnection* Node = GetAlwaysRelevantNodeForConnection(Connection))
+				{
+					Node->NotifyAddNetworkActor(FNewReplicatedActorInfo(Actor));
+				}
+			}
+			else
+			{
+				bRemove = false;
+			}
+		}
+		if (bRemove)
+		{
+			ActorsWithoutNetConnection.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		}
+	}
+
+	return Super::ServerReplicateActors(DeltaSeconds);
+}
+
+// ─── 팀 파트너 노드 ───
+
+UBRReplicationGraphNode_TeamPartners::UBRReplicationGraphNode_TeamPartners()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void UBRReplicationGraphNode_TeamPartners::NotifyResetAllNetworkActors()
+{
+	TeamPawnLists.Reset();
+}
+
+void UBRReplicationGraphNode_TeamPartners::PrepareForReplication()
+{
+	for (TPair<int32, FActorRepListRefView>& Pair : TeamPawnLists)
+	{
+		Pair.Value.Reset();
+	}
+
+	UWorld* World = GraphGlobals.IsValid() ? GraphGlobals->World : nullptr;
+	AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+	if (!GameState) return;
+
+	// 인원 수만큼만 순회 (팀 배정은 로비/스왑에서 바뀌므로 캐시하지 않고 매 프레임 다시 만듦)
+	for (APlayerState* PS : GameState->PlayerArray)
+	{
+		const ABRPlayerState* BRPS = Cast<ABRPlayerState>(PS);
+		if (!BRPS || BRPS->TeamNumber <= 0 || BRPS->bIsSpectatorSlot) continue;
+		APawn* Pawn = BRPS->GetPawn();
+		if (!Pawn || !Pawn->GetIsReplicated()) continue;
+		TeamPawnLists.FindOrAdd(BRPS->TeamNumber).Add(Pawn);
+	}
+}
+
+void UBRReplicationGraphNode_TeamPartners::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	UNetConnection* Connection = Params.ConnectionManager.NetConnection;
+	APlayerController* PC = Connection ? Connection->PlayerController.Get() : nullptr;
+	const ABRPlayerState* BRPS = PC ? PC->GetPlayerState<ABRPlayerState>() : nullptr;
+	if (!BRPS || BRPS->TeamNumber <= 0) return;
+
+	const FActorRepListRefView* TeamList = TeamPawnLists.Find(BRPS->TeamNumber);
+	if (TeamList && TeamList->Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(*TeamList);
+	}
+}
+
+// ─── 픽업 휴면 노드 ───
+
+UBRReplicationGraphNode_PickupDormancy::UBRReplicationGraphNode_PickupDormancy()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void UBRReplicationGraphNode_PickupDormancy::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	AActor* Actor = ActorInfo.GetActor();
+	if (!Actor) return;
+	FPickupRestState& State = Pickups.AddDefaulted_GetRef();
+	State.Actor = Actor;
+	State.LastLocation = Actor->GetActorLocation();
+	State.LastAttachParent = Actor->GetAttachParentActor();
+	UWorld* World = Actor->GetWorld();
+	State.RestStartTime = World ? World->GetTimeSeconds() : 0.0;
+}
+
+bool UBRReplicationGraphNode_PickupDormancy::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	const AActor* Actor = ActorInfo.GetActor();
+	const int32 Index = Pickups.IndexOfByPredicate([Actor](const FPickupRestState& State) { return State.Actor.Get() == Actor; });
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+	Pickups.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	return true;
+}
+
+void UBRReplicationGraphNode_PickupDormancy::NotifyResetAllNetworkActors()
+{
+	Pickups.Reset();
+}
+
+void UBRReplicationGraphNode_PickupDormancy::PrepareForReplication()
+{
+	UWorld* World = GraphGlobals.IsValid() ? GraphGlobals->World : nullptr;
+	if (!World) return;
+	const double Now = World->GetTimeSeconds();
+
+	for (int32 i = Pickups.Num() - 1; i >= 0; --i)
+	{
+		FPickupRestState& State = Pickups[i];
+		AActor* Actor = State.Actor.Get();
+		if (!IsValid(Actor))
+		{
+			Pickups.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		// 장착(부착) 중이거나, 부착이 바뀌었거나, 움직였으면 깨어 있어야 함 → 같은 프레임 복제 전에 깨움
+		const FVector Location = Actor->GetActorLocation();
+		AActor* AttachParent = Actor->GetAttachParentActor();
+		const bool bMoved = AttachParent != nullptr
+			|| AttachParent != State.LastAttachParent.Get()
+			|| FVector::DistSquared(Location, State.LastLocation) > RestToleranceSq;
+		State.LastLocation = Location;
+		State.LastAttachParent = AttachParent;
+
+		if (bMoved)
+		{
+			State.RestStartTime = Now;
+			// DORM_Initial(레벨 배치 무기)도 처음 집거나 밀 때 깨워야 함
+			if (Actor->NetDormancy == DORM_DormantAll || Actor->NetDormancy == DORM_Initial)
+			{
+				Actor->SetNetDormancy(DORM_Awake);
+			}
+			continue;
+		}
+
+		// 바닥에 가만히 놓인 지 일정 시간 지나면 휴면 (그리드는 Dormancy 변경 이벤트로 정적 셀로 옮김)
+		if (Actor->NetDormancy == DORM_Awake && Now - State.RestStartTime >= RestSecondsBeforeDormant)
+		{
+			Actor->SetNetDormancy(DORM_DormantAll);
+		}
+	}
+}
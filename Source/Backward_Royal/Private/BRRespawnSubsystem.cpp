@@ -0,0 +1,305 @@
+// BRRespawnSubsystem.cpp
+#include "BRRespawnSubsystem.h"
+#include "BRActorRegistrySubsystem.h"
+#include "BRSafeRespawnPoint.h"
+#include "BaseCharacter.h"
+#include "PlayerCharacter.h"
+#include "UpperBodyPawn.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerStart.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY(LogRespawn);
+
+bool UBRRespawnSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer)) return false;
+
+	// 위치 이동은 서버 권한 (클라이언트는 이동 복제로 따라옴)
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->GetNetMode() != NM_Client;
+}
+
+void UBRRespawnSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 스트리밍 레벨이 붙거나 떨어지면 PlayerStart 목록이 바뀌므로 다음 조회 때 다시 색인
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UBRRespawnSubsystem::HandleLevelChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UBRRespawnSubsystem::HandleLevelChanged);
+}
+
+void UBRRespawnSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	SafePoints.Empty();
+	Points.Empty();
+	PointGrid.Empty();
+	OccupancyGrid.Empty();
+	LastResetTime.Empty();
+
+	Super::Deinitialize();
+}
+
+UBRRespawnSubsystem* UBRRespawnSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UBRRespawnSubsystem>() : nullptr;
+}
+
+void UBRRespawnSubsystem::RegisterSafePoint(ABRSafeRespawnPoint* SafePoint)
+{
+	if (UBRRespawnSubsystem* Respawn = Get(SafePoint))
+	{
+		Respawn->SafePoints.AddUnique(SafePoint);
+		Respawn->bIndexDirty = true;
+	}
+}
+
+void UBRRespawnSubsystem::UnregisterSafePoint(ABRSafeRespawnPoint* SafePoint)
+{
+	if (UBRRespawnSubsystem* Respawn = Get(SafePoint))
+	{
+		Respawn->SafePoints.RemoveSingleSwap(SafePoint, EAllowShrinking::No);
+		Respawn->bIndexDirty = true;
+	}
+}
+
+FIntPoint UBRRespawnSubsystem::ToCell(const FVector& Location, float CellSize)
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+// ========== 지점 색인 ==========
+
+void UBRRespawnSubsystem::HandleLevelChanged(ULevel* InLevel, UWorld* InWorld)
+{
+	if (InWorld == GetWorld())
+	{
+		bIndexDirty = true;
+	}
+}
+
+void UBRRespawnSubsystem::RebuildIndexIfDirty()
+{
+	if (!bIndexDirty) return;
+
+	const UBRActorRegistrySubsystem* Registry = UBRActorRegistrySubsystem::Get(this);
+	const int32 NumPlayerStarts = Registry ? Registry->GetPlayerStarts().Num() : 0;
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_RespawnRebuildIndex);
+
+	Points.Reset();
+	PointGrid.Reset();
+
+	auto AddPoint = [this](const AActor* Actor)
+		{
+			if (!IsValid(Actor)) return;
+
+			const int32 Index = Points.Num();
+			FRespawnPoint& Point = Points.AddDefaulted_GetRef();
+			Point.Transform = Actor->GetActorTransform();
+			Point.Transform.SetScale3D(FVector::OneVector);
+
+			const FIntPoint Cell = ToCell(Point.Transform.GetLocation(), IndexCellSize);
+			PointGrid.FindOrAdd(Cell).Add(Index);
+			MinCell = (Index == 0) ? Cell : FIntPoint(FMath::Min(MinCell.X, Cell.X), FMath::Min(MinCell.Y, Cell.Y));
+			MaxCell = (Index == 0) ? Cell : FIntPoint(FMath::Max(MaxCell.X, Cell.X), FMath::Max(MaxCell.Y, Cell.Y));
+		};
+
+	for (const ABRSafeRespawnPoint* SafePoint : SafePoints)
+	{
+		AddPoint(SafePoint);
+	}
+	if (Registry)
+	{
+		for (const APlayerStart* PlayerStart : Registry->GetPlayerStarts())
+		{
+			AddPoint(PlayerStart);
+		}
+	}
+
+	bIndexDirty = false;
+
+	UE_LOG(LogRespawn, Log, TEXT("리스폰 지점 색인: %d개 (안전 지점 %d / PlayerStart %d), 격자 %d칸"),
+		Points.Num(), SafePoints.Num(), NumPlayerStarts, PointGrid.Num());
+}
+
+// ========== 점유 격자 ==========
+
+void UBRRespawnSubsystem::RefreshOccupancy()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (OccupancyBuiltTime >= 0.0 && Now - OccupancyBuiltTime < OccupancyRefreshInterval) return;
+
+	// 칸 배열 메모리는 유지
+	for (TPair<FIntPoint, TArray<FOccupant>>& Elem : OccupancyGrid)
+	{
+		Elem.Value.Reset();
+	}
+
+	if (const UBRActorRegistrySubsystem* Registry = UBRActorRegistrySubsystem::Get(this))
+	{
+		// 상체는 하체에 붙어 있으므로 캐릭터(하체)만 보면 충분
+		for (const ABaseCharacter* Character : Registry->GetCharacters())
+		{
+			if (!IsValid(Character)) continue;
+
+			const FVector Location = Character->GetActorLocation();
+			OccupancyGrid.FindOrAdd(ToCell(Location, OccupancyRadius * 2.0f)).Add({ Location, Character });
+		}
+	}
+
+	OccupancyBuiltTime = Now;
+}
+
+bool UBRRespawnSubsystem::IsPointOccupied(const FVector& Location, const AActor* IgnoreActor) const
+{
+	// 칸 크기 = 반경 * 2 → 주변 3x3 칸만 보면 반경 안의 모든 캐릭터를 찾을 수 있음
+	const FIntPoint Center = ToCell(Location, OccupancyRadius * 2.0f);
+	const double RadiusSq = FMath::Square(OccupancyRadius);
+
+	for (int32 DY = -1; DY <= 1; ++DY)
+	{
+		for (int32 DX = -1; DX <= 1; ++DX)
+		{
+			const TArray<FOccupant>* Occupants = OccupancyGrid.Find(Center + FIntPoint(DX, DY));
+			if (!Occupants) continue;
+
+			for (const FOccupant& Occupant : *Occupants)
+			{
+				if (Occupant.Actor.Get() != IgnoreActor && FVector::DistSquared(Occupant.Location, Location) <= RadiusSq)
+				{
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+// ========== 조회 ==========
+
+bool UBRRespawnSubsystem::FindNearestFreePoint(const FVector& FromLocation, const AActor* IgnoreActor, FTransform& OutTransform)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_RespawnFindPoint);
+
+	RebuildIndexIfDirty();
+	if (Points.Num() == 0) return false;
+
+	RefreshOccupancy();
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const FIntPoint FromCell = ToCell(FromLocation, IndexCellSize);
+	const int32 MaxRing = FMath::Max(
+		FMath::Max(FMath::Abs(FromCell.X - MinCell.X), FMath::Abs(FromCell.X - MaxCell.X)),
+		FMath::Max(FMath::Abs(FromCell.Y - MinCell.Y), FMath::Abs(FromCell.Y - MaxCell.Y)));
+
+	int32 BestFree = INDEX_NONE;
+	int32 BestAny = INDEX_NONE;
+	double BestFreeDistSq = TNumericLimits<double>::Max();
+	double BestAnyDistSq = TNumericLimits<double>::Max();
+
+	// 가까운 칸부터 고리 모양으로 확장
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		for (int32 DY = -Ring; DY <= Ring; ++DY)
+		{
+			for (int32 DX = -Ring; DX <= Ring; ++DX)
+			{
+				// 고리 테두리만
+				if (FMath::Max(FMath::Abs(DX), FMath::Abs(DY)) != Ring) continue;
+
+				const TArray<int32>* CellPoints = PointGrid.Find(FromCell + FIntPoint(DX, DY));
+				if (!CellPoints) continue;
+
+				for (const int32 Index : *CellPoints)
+				{
+					const FVector Location = Points[Index].Transform.GetLocation();
+					const double DistSq = FVector::DistSquared(FromLocation, Location);
+					if (DistSq < BestAnyDistSq)
+					{
+						BestAnyDistSq = DistSq;
+						BestAny = Index;
+					}
+					if (DistSq < BestFreeDistSq && Points[Index].ReservedUntil <= Now && !IsPointOccupied(Location, IgnoreActor))
+					{
+						BestFreeDistSq = DistSq;
+						BestFree = Index;
+					}
+				}
+			}
+		}
+
+		// 다음 고리의 지점은 최소 Ring * 칸 크기만큼 떨어져 있으므로 더 가까운 빈 지점이 나올 수 없음
+		if (BestFree != INDEX_NONE && BestFreeDistSq <= FMath::Square(Ring * (double)IndexCellSize))
+		{
+			break;
+		}
+	}
+
+	const int32 Chosen = (BestFree != INDEX_NONE) ? BestFree : BestAny;
+	if (Chosen == INDEX_NONE) return false;
+
+	if (BestFree == INDEX_NONE)
+	{
+		UE_LOG(LogRespawn, Warning, TEXT("빈 리스폰 지점 없음 → 가장 가까운 점유 지점 사용"));
+	}
+
+	Points[Chosen].ReservedUntil = Now + ReservationSeconds;
+	OutTransform = Points[Chosen].Transform;
+	return true;
+}
+
+bool UBRRespawnSubsystem::ResetFallenActor(AActor* FallenActor)
+{
+	// 상체가 들어오면 붙어 있는 하체를 옮김 (상체는 부착으로 따라옴)
+	APawn* Body = Cast<APawn>(FallenActor);
+	if (AUpperBodyPawn* UpperBody = Cast<AUpperBodyPawn>(FallenActor))
+	{
+		if (UpperBody->ParentBodyCharacter)
+		{
+			Body = UpperBody->ParentBodyCharacter;
+		}
+	}
+	if (!Body) return false;
+
+	// 상체/하체가 같은 프레임에 각각 오버랩해도 한 번만 처리
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (const double* LastTime = LastResetTime.Find(Body))
+	{
+		if (Now - *LastTime < ResetCooldownSeconds) return false;
+	}
+
+	FTransform Target;
+	if (!FindNearestFreePoint(Body->GetActorLocation(), Body, Target))
+	{
+		UE_LOG(LogRespawn, Error, TEXT("월드에 리스폰 지점(PlayerStart / BRSafeRespawnPoint)이 없습니다! %s를 리셋할 수 없습니다."), *Body->GetName());
+		return false;
+	}
+
+	if (ACharacter* Character = Cast<ACharacter>(Body))
+	{
+		if (UCharacterMovementComponent* MoveComp = Character->GetCharacterMovement())
+		{
+			MoveComp->StopMovementImmediately();
+		}
+	}
+	Body->SetActorLocation(Target.GetLocation(), false, nullptr, ETeleportType::TeleportPhysics);
+
+	// 만료된 기록 정리 후 갱신
+	for (auto It = LastResetTime.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid() || Now - It.Value() >= ResetCooldownSeconds)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	LastResetTime.Add(Body, Now);
+
+	UE_LOG(LogRespawn, Log, TEXT("[%s] 낙하 리셋 → %s"), *Body->GetName(), *Target.GetLocation().ToCompactString());
+	return true;
+}
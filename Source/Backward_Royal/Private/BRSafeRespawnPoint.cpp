@@ -0,0 +1,17 @@
+// BRSafeRespawnPoint.cpp
+#include "BRSafeRespawnPoint.h"
+#include "BRRespawnSubsystem.h"
+
+void ABRSafeRespawnPoint::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UBRRespawnSubsystem::RegisterSafePoint(this);
+}
+
+void ABRSafeRespawnPoint::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UBRRespawnSubsystem::UnregisterSafePoint(this);
+
+	Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,169 @@
+// BRSignificanceSubsystem.cpp
+#include "BRSignificanceSubsystem.h"
+#include "BaseCharacter.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+DEFINE_LOG_CATEGORY(LogSignificance);
+
+bool UBRSignificanceSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// 전용 서버에는 시점이 없고, 서버 판정용 포즈는 항상 정확해야 함
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UBRSignificanceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.IsGameWorld())
+	{
+		InWorld.GetTimerManager().SetTimer(EvaluateTimerHandle, this, &UBRSignificanceSubsystem::Evaluate, EvaluateInterval, true);
+	}
+}
+
+void UBRSignificanceSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(EvaluateTimerHandle);
+	}
+	Tracked.Empty();
+
+	Super::Deinitialize();
+}
+
+UBRSignificanceSubsystem* UBRSignificanceSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UBRSignificanceSubsystem>() : nullptr;
+}
+
+void UBRSignificanceSubsystem::RegisterCharacter(ABaseCharacter* Character)
+{
+	UBRSignificanceSubsystem* Significance = Get(Character);
+	if (!Significance) return;
+
+	for (const FTrackedCharacter& Entry : Significance->Tracked)
+	{
+		if (Entry.Character.Get() == Character) return;
+	}
+
+	FTrackedCharacter& Entry = Significance->Tracked.AddDefaulted_GetRef();
+	Entry.Character = Character;
+}
+
+int32 UBRSignificanceSubsystem::GetNumInTier(EBRSignificance Tier) const
+{
+	int32 Count = 0;
+	for (const FTrackedCharacter& Entry : Tracked)
+	{
+		if (Entry.bApplied && Entry.Tier == Tier && Entry.Character.IsValid())
+		{
+			Count++;
+		}
+	}
+	return Count;
+}
+
+void UBRSignificanceSubsystem::GatherLocalViewers(TArray<FVector>& OutViewLocations, TArray<const AActor*>& OutViewTargets) const
+{
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || !PC->IsLocalController()) continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		OutViewLocations.Add(ViewLocation);
+
+		if (const AActor* ViewTarget = PC->GetViewTarget())
+		{
+			OutViewTargets.Add(ViewTarget);
+		}
+		if (const APawn* Pawn = PC->GetPawn())
+		{
+			OutViewTargets.AddUnique(Pawn);
+		}
+	}
+}
+
+EBRSignificance UBRSignificanceSubsystem::ScoreCharacter(const ABaseCharacter* Character, const TArray<FVector>& ViewLocations, const TArray<const AActor*>& ViewTargets) const
+{
+	// 1. 로컬 뷰 타깃: 내가 보는 몸이거나, 내가 보는 상체가 붙어 있는 하체(또는 그 반대)
+	for (const AActor* ViewTarget : ViewTargets)
+	{
+		if (ViewTarget == Character
+			|| ViewTarget->GetAttachParentActor() == Character
+			|| Character->GetAttachParentActor() == ViewTarget)
+		{
+			return EBRSignificance::Critical;
+		}
+	}
+
+	// 2. 화면 밖 (최근 렌더링되지 않음)
+	if (!Character->WasRecentlyRendered(EvaluateInterval))
+	{
+		return EBRSignificance::Low;
+	}
+
+	// 3. 가장 가까운 로컬 시점과의 거리
+	const FVector Location = Character->GetActorLocation();
+	double MinDistSq = TNumericLimits<double>::Max();
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(ViewLocation, Location));
+	}
+
+	if (MinDistSq <= FMath::Square(HighSignificanceDistance))
+	{
+		return EBRSignificance::High;
+	}
+	if (MinDistSq <= FMath::Square(MediumSignificanceDistance))
+	{
+		return EBRSignificance::Medium;
+	}
+	return EBRSignificance::Low;
+}
+
+void UBRSignificanceSubsystem::Evaluate()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BR_SignificanceEvaluate);
+
+	TArray<FVector> ViewLocations;
+	TArray<const AActor*> ViewTargets;
+	GatherLocalViewers(ViewLocations, ViewTargets);
+
+	// 로컬 플레이어가 아직 없으면(로딩 중 등) 판단 보류
+	if (ViewLocations.Num() == 0) return;
+
+	int32 NumChanged = 0;
+	for (int32 Index = Tracked.Num() - 1; Index >= 0; --Index)
+	{
+		FTrackedCharacter& Entry = Tracked[Index];
+		ABaseCharacter* Character = Entry.Character.Get();
+		if (!IsValid(Character))
+		{
+			Tracked.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		const EBRSignificance NewTier = ScoreCharacter(Character, ViewLocations, ViewTargets);
+		if (Entry.bApplied && Entry.Tier == NewTier) continue;
+
+		Entry.Tier = NewTier;
+		Entry.bApplied = true;
+		Character->ApplySignificance(NewTier);
+		NumChanged++;
+	}
+
+	if (NumChanged > 0)
+	{
+		UE_LOG(LogSignificance, Verbose, TEXT("Evaluate: %d명 단계 변경 (Critical %d / High %d / Medium %d / Low %d)"), NumChanged,
+			GetNumInTier(EBRSignificance::Critical), GetNumInTier(EBRSignificance::High),
+			GetNumInTier(EBRSignificance::Medium), GetNumInTier(EBRSignificance::Low));
+	}
+}
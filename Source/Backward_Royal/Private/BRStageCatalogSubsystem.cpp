@@ -0,0 +1,411 @@
+// BRStageCatalogSubsystem.cpp
+#include "BRStageCatalogSubsystem.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY(LogStageCatalog);
+
+namespace
+{
+	/** 최근성 가중치 상한 (시간 단위). 이보다 오래 안 한 맵은 같은 가중치 */
+	constexpr double RecencyCapHours = 3.0;
+
+	/** 크기 추정 적합도의 최저값 (인원과 맵 크기가 정반대여도 완전히 빼지는 않음) */
+	constexpr float MinSizeSuitability = 0.25f;
+}
+
+void UBRStageCatalogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LoadManifest();
+	LoadStageSizeFile();
+}
+
+UBRStageCatalogSubsystem* UBRStageCatalogSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UBRStageCatalogSubsystem>() : nullptr;
+}
+
+FString UBRStageCatalogSubsystem::GetManifestFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("StageCatalog.json");
+}
+
+FString UBRStageCatalogSubsystem::GetStageSizeFilePath()
+{
+	return FPaths::ProjectDir() / TEXT("Data") / TEXT("StageSizes.json");
+}
+
+TArray<FString> UBRStageCatalogSubsystem::CollectStagePackageNames(const FString& StageFolderPath, const TArray<FString>& ExplicitStagePaths)
+{
+	if (ExplicitStagePaths.Num() > 0)
+	{
+		return ExplicitStagePaths;
+	}
+
+	TArray<FString> PackageNames;
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (StageFolderPath.IsEmpty() || !AssetRegistry) return PackageNames;
+
+	TArray<FAssetData> AssetDataList;
+	AssetRegistry->GetAssetsByPath(FName(*StageFolderPath), AssetDataList, true, false);
+
+	const FTopLevelAssetPath WorldClassPath(TEXT("/Script/Engine"), TEXT("World"));
+	for (const FAssetData& AssetData : AssetDataList)
+	{
+		if (AssetData.AssetClassPath == WorldClassPath && !AssetData.PackageName.IsNone())
+		{
+			PackageNames.AddUnique(AssetData.PackageName.ToString());
+		}
+	}
+	return PackageNames;
+}
+
+void UBRStageCatalogSubsystem::EnsureBuilt(const FString& StageFolderPath, const TArray<FString>& ExplicitStagePaths, const TArray<FBRStagePlayerRange>& PlayerRanges)
+{
+	uint32 Key = GetTypeHash(StageFolderPath);
+	for (const FString& Path : ExplicitStagePaths)
+	{
+		Key = HashCombine(Key, GetTypeHash(Path));
+	}
+	for (const FBRStagePlayerRange& Range : PlayerRanges)
+	{
+		Key = HashCombine(Key, HashCombine(GetTypeHash(Range.StageName), HashCombine(GetTypeHash(Range.MinPlayers), GetTypeHash(Range.MaxPlayers))));
+	}
+	if (bBuilt && Key == BuildKey) return;
+
+	const double StartTime = FPlatformTime::Seconds();
+	Entries.Reset();
+	IndexByPackage.Reset();
+
+	// 1. 패키지 목록: 개별 목록이 있으면 그대로, 비어 있을 때만 Stage 폴더 스캔 (이 시점 1회)
+	const TArray<FString> PackageNames = CollectStagePackageNames(StageFolderPath, ExplicitStagePaths);
+
+	// 2. 항목 구성: 근사 메모리 크기, 적정 인원, 마지막 플레이 시각
+	for (const FString& PackageName : PackageNames)
+	{
+		if (PackageName.IsEmpty() || IndexByPackage.Contains(PackageName)) continue;
+
+		FBRStageCatalogEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.PackageName = PackageName;
+		// 크기표 우선. 에디터는 레지스트리에 패키지 크기·의존성이 있으므로 표에 없는 맵을 직접 계산
+		if (const int64* KnownBytes = StageSizeByPackage.Find(PackageName))
+		{
+			Entry.ApproxMemoryBytes = *KnownBytes;
+		}
+#if WITH_EDITOR
+		else
+		{
+			Entry.ApproxMemoryBytes = ComputeApproxMemoryBytes(FName(*PackageName));
+		}
+#endif
+
+		const FString ShortName = FPackageName::GetShortName(PackageName);
+		if (const FBRStagePlayerRange* Range = PlayerRanges.FindByPredicate([&ShortName](const FBRStagePlayerRange& R) { return R.StageName.Equals(ShortName, ESearchCase::IgnoreCase); }))
+		{
+			Entry.MinPlayers = Range->MinPlayers;
+			Entry.MaxPlayers = FMath::Max(Range->MinPlayers, Range->MaxPlayers);
+		}
+		if (const FDateTime* LastPlayed = LastPlayedByPackage.Find(PackageName))
+		{
+			Entry.LastPlayed = *LastPlayed;
+		}
+
+		IndexByPackage.Add(PackageName, Entries.Num() - 1);
+	}
+	AssignSizeRanks();
+
+	BuildKey = Key;
+	bBuilt = true;
+
+	UE_LOG(LogStageCatalog, Log, TEXT("[Stage 카탈로그] %d개 구성 (%s, %.1fms)"), Entries.Num(),
+		ExplicitStagePaths.Num() > 0 ? TEXT("맵 목록") : *FString::Printf(TEXT("폴더 스캔: %s"), *StageFolderPath),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+	for (const FBRStageCatalogEntry& Entry : Entries)
+	{
+		UE_LOG(LogStageCatalog, Log, TEXT("  %s | 약 %.1f MB (순위 %.2f) | 인원 %s | 마지막 %s"),
+			*Entry.PackageName, (double)Entry.ApproxMemoryBytes / (1024.0 * 1024.0), Entry.SizeRank,
+			Entry.MaxPlayers > 0 ? *FString::Printf(TEXT("%d~%d"), Entry.MinPlayers, Entry.MaxPlayers) : TEXT("크기로 추정"),
+			Entry.LastPlayed == FDateTime::MinValue() ? TEXT("없음") : *Entry.LastPlayed.ToString());
+	}
+}
+
+void UBRStageCatalogSubsystem::AssignSizeRanks()
+{
+	TArray<int32> SizedIndices;
+	for (int32 i = 0; i < Entries.Num(); i++)
+	{
+		Entries[i].SizeRank = -1.0f;
+		if (Entries[i].ApproxMemoryBytes > 0)
+		{
+			SizedIndices.Add(i);
+		}
+	}
+	if (SizedIndices.Num() < 2)
+	{
+		return;
+	}
+
+	// 크기 값 자체가 아니라 순서만 사용 (큰 맵 하나가 나머지를 0 근처로 몰지 않도록). 같은 크기는 같은 순위
+	SizedIndices.Sort([this](int32 A, int32 B) { return Entries[A].ApproxMemoryBytes < Entries[B].ApproxMemoryBytes; });
+	const float LastRank = (float)(SizedIndices.Num() - 1);
+	int32 Rank = 0;
+	for (int32 i = 0; i < SizedIndices.Num(); i++)
+	{
+		if (i > 0 && Entries[SizedIndices[i]].ApproxMemoryBytes != Entries[SizedIndices[i - 1]].ApproxMemoryBytes)
+		{
+			Rank = i;
+		}
+		Entries[SizedIndices[i]].SizeRank = (float)Rank / LastRank;
+	}
+}
+
+int64 UBRStageCatalogSubsystem::ComputeApproxMemoryBytes(const FName PackageName)
+{
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (!AssetRegistry) return 0;
+
+	// 하드 의존 패키지까지 따라가며 디스크 크기 합산 (스크립트/엔진 패키지는 크기 정보가 없어 자연히 빠짐)
+	int64 TotalBytes = 0;
+	TSet<FName> Visited;
+	TArray<FName> Stack;
+	Stack.Add(PackageName);
+	while (Stack.Num() > 0)
+	{
+		const FName Current = Stack.Pop(EAllowShrinking::No);
+		if (Visited.Contains(Current)) continue;
+		Visited.Add(Current);
+
+		const TOptional<FAssetPackageData> PackageData = AssetRegistry->GetAssetPackageDataCopy(Current);
+		if (PackageData.IsSet() && PackageData->DiskSize > 0)
+		{
+			TotalBytes += PackageData->DiskSize;
+		}
+
+		TArray<FName> Dependencies;
+		AssetRegistry->GetDependencies(Current, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+		for (const FName& Dependency : Dependencies)
+		{
+			if (!Visited.Contains(Dependency))
+			{
+				Stack.Add(Dependency);
+			}
+		}
+	}
+	return TotalBytes;
+}
+
+TArray<FString> UBRStageCatalogSubsystem::GetStagePackageNames() const
+{
+	TArray<FString> Result;
+	Result.Reserve(Entries.Num());
+	for (const FBRStageCatalogEntry& Entry : Entries)
+	{
+		Result.Add(Entry.PackageName);
+	}
+	return Result;
+}
+
+float UBRStageCatalogSubsystem::GetSuitabilityWeight(const FBRStageCatalogEntry& Entry, int32 PlayerCount, int32 MaxPlayers) const
+{
+	if (Entry.MaxPlayers > 0)
+	{
+		return (PlayerCount >= Entry.MinPlayers && PlayerCount <= Entry.MaxPlayers) ? 1.0f : 0.0f;
+	}
+
+	// 지정이 없으면 인원 비율과 맵 크기 순위(0=가장 작음)가 가까울수록 높게
+	if (Entry.SizeRank < 0.0f || MaxPlayers <= 0)
+	{
+		return 1.0f;
+	}
+	const float PlayerAlpha = FMath::Clamp((float)PlayerCount / (float)MaxPlayers, 0.0f, 1.0f);
+	return FMath::Max(MinSizeSuitability, 1.0f - FMath::Abs(Entry.SizeRank - PlayerAlpha));
+}
+
+FString UBRStageCatalogSubsystem::PickStage(int32 PlayerCount, int32 MaxPlayers) const
+{
+	if (Entries.Num() == 0) return FString();
+
+	// 직전 Stage 찾기
+	int32 MostRecentIndex = INDEX_NONE;
+	for (int32 i = 0; i < Entries.Num(); i++)
+	{
+		if (Entries[i].LastPlayed == FDateTime::MinValue()) continue;
+		if (MostRecentIndex == INDEX_NONE || Entries[i].LastPlayed > Entries[MostRecentIndex].LastPlayed)
+		{
+			MostRecentIndex = i;
+		}
+	}
+
+	const FDateTime Now = FDateTime::UtcNow();
+	TArray<float> Weights;
+	Weights.SetNumZeroed(Entries.Num());
+	float TotalWeight = 0.0f;
+	for (int32 i = 0; i < Entries.Num(); i++)
+	{
+		if (i == MostRecentIndex && Entries.Num() > 1) continue;
+
+		const FBRStageCatalogEntry& Entry = Entries[i];
+		const double HoursSince = Entry.LastPlayed == FDateTime::MinValue()
+			? RecencyCapHours
+			: FMath::Clamp((Now - Entry.LastPlayed).GetTotalHours(), 0.0, RecencyCapHours);
+		const float Recency = 1.0f + (float)HoursSince;
+		Weights[i] = GetSuitabilityWeight(Entry, PlayerCount, MaxPlayers) * Recency;
+		TotalWeight += Weights[i];
+	}
+
+	// 인원에 맞는 맵이 하나도 없으면 적합도 무시 (직전 Stage 회피만 유지)
+	if (TotalWeight <= 0.0f)
+	{
+		UE_LOG(LogStageCatalog, Warning, TEXT("[Stage 카탈로그] %d명에 맞는 Stage 없음 → 적정 인원 무시"), PlayerCount);
+		for (int32 i = 0; i < Entries.Num(); i++)
+		{
+			Weights[i] = (i == MostRecentIndex && Entries.Num() > 1) ? 0.0f : 1.0f;
+			TotalWeight += Weights[i];
+		}
+	}
+
+	float Roll = FMath::FRandRange(0.0f, TotalWeight);
+	int32 Picked = Entries.Num() - 1;
+	for (int32 i = 0; i < Entries.Num(); i++)
+	{
+		if (Weights[i] <= 0.0f) continue;
+		if (Roll < Weights[i])
+		{
+			Picked = i;
+			break;
+		}
+		Roll -= Weights[i];
+	}
+	// 부동소수 오차로 끝까지 간 경우 마지막 유효 후보
+	while (Picked > 0 && Weights[Picked] <= 0.0f)
+	{
+		Picked--;
+	}
+
+	UE_LOG(LogStageCatalog, Log, TEXT("[Stage 카탈로그] %d명 → %s (가중치 %.2f / 합 %.2f, 직전 %s 제외)"),
+		PlayerCount, *Entries[Picked].PackageName, Weights[Picked], TotalWeight,
+		MostRecentIndex != INDEX_NONE ? *FPackageName::GetShortName(Entries[MostRecentIndex].PackageName) : TEXT("없음"));
+	return Entries[Picked].PackageName;
+}
+
+void UBRStageCatalogSubsystem::MarkPlayed(const FString& PackageName)
+{
+	const FDateTime Now = FDateTime::UtcNow();
+	LastPlayedByPackage.Add(PackageName, Now);
+	if (const int32* Index = IndexByPackage.Find(PackageName))
+	{
+		Entries[*Index].LastPlayed = Now;
+	}
+	SaveManifest();
+}
+
+void UBRStageCatalogSubsystem::LoadManifest()
+{
+	FString JsonText;
+	if (!FFileHelper::LoadFileToString(JsonText, *GetManifestFilePath())) return;
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		UE_LOG(LogStageCatalog, Warning, TEXT("[Stage 카탈로그] 기록 파일 파싱 실패: %s"), *GetManifestFilePath());
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* LastPlayedObject = nullptr;
+	if (!Root->TryGetObjectField(TEXT("LastPlayed"), LastPlayedObject)) return;
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*LastPlayedObject)->Values)
+	{
+		FDateTime Parsed;
+		if (Pair.Value.IsValid() && FDateTime::ParseIso8601(*Pair.Value->AsString(), Parsed))
+		{
+			LastPlayedByPackage.Add(Pair.Key, Parsed);
+		}
+	}
+}
+
+void UBRStageCatalogSubsystem::LoadStageSizeFile()
+{
+	FString JsonText;
+	if (!FFileHelper::LoadFileToString(JsonText, *GetStageSizeFilePath()))
+	{
+#if !WITH_EDITOR
+		UE_LOG(LogStageCatalog, Warning, TEXT("[Stage 카탈로그] 크기표 없음 (%s) → 크기 기반 적합도 미사용. -run=BRStageSize로 생성하세요."), *GetStageSizeFilePath());
+#endif
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+	const TSharedPtr<FJsonObject>* SizesObject = nullptr;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetObjectField(TEXT("Stages"), SizesObject))
+	{
+		UE_LOG(LogStageCatalog, Warning, TEXT("[Stage 카탈로그] 크기표 파싱 실패: %s"), *GetStageSizeFilePath());
+		return;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*SizesObject)->Values)
+	{
+		double Bytes = 0.0;
+		if (Pair.Value.IsValid() && Pair.Value->TryGetNumber(Bytes) && Bytes > 0.0)
+		{
+			StageSizeByPackage.Add(Pair.Key, (int64)Bytes);
+		}
+	}
+}
+
+bool UBRStageCatalogSubsystem::WriteStageSizeFile(const FString& FilePath, const TMap<FString, int64>& SizeByPackage)
+{
+	TSharedRef<FJsonObject> SizesObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, int64>& Pair : SizeByPackage)
+	{
+		SizesObject->SetNumberField(Pair.Key, (double)Pair.Value);
+	}
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetObjectField(TEXT("Stages"), SizesObject);
+
+	FString JsonText;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonText);
+	FJsonSerializer::Serialize(Root, Writer);
+	if (!FFileHelper::SaveStringToFile(JsonText, *FilePath))
+	{
+		UE_LOG(LogStageCatalog, Error, TEXT("[Stage 카탈로그] 크기표 저장 실패: %s"), *FilePath);
+		return false;
+	}
+	UE_LOG(LogStageCatalog, Display, TEXT("[Stage 카탈로그] 크기표 저장: %s (%d개)"), *FilePath, SizeByPackage.Num());
+	return true;
+}
+
+void UBRStageCatalogSubsystem::SaveManifest() const
+{
+	TSharedRef<FJsonObject> LastPlayedObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, FDateTime>& Pair : LastPlayedByPackage)
+	{
+		LastPlayedObject->SetStringField(Pair.Key, Pair.Value.ToIso8601());
+	}
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetObjectField(TEXT("LastPlayed"), LastPlayedObject);
+
+	FString JsonText;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonText);
+	FJsonSerializer::Serialize(Root, Writer);
+	if (!FFileHelper::SaveStringToFile(JsonText, *GetManifestFilePath()))
+	{
+		UE_LOG(LogStageCatalog, Warning, TEXT("[Stage 카탈로그] 기록 저장 실패: %s"), *GetManifestFilePath());
+	}
+}
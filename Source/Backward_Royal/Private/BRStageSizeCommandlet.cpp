@@ -0,0 +1,59 @@
+// BRStageSizeCommandlet.cpp
+#include "BRStageSizeCommandlet.h"
+#include "BRGameMode.h"
+#include "BRStageCatalogSubsystem.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/PackageName.h"
+
+UBRStageSizeCommandlet::UBRStageSizeCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBRStageSizeCommandlet::Main(const FString& Params)
+{
+	// 1. Stage 설정을 가진 게임 모드 클래스 결정 (-GameMode= > GameMapsSettings > 네이티브 기본값)
+	FString GameModeClassPath;
+	if (!FParse::Value(*Params, TEXT("GameMode="), GameModeClassPath))
+	{
+		GConfig->GetString(TEXT("/Script/EngineSettings.GameMapsSettings"), TEXT("GlobalDefaultGameMode"), GameModeClassPath, GEngineIni);
+	}
+
+	UClass* GameModeClass = GameModeClassPath.IsEmpty() ? nullptr : LoadClass<ABRGameMode>(nullptr, *GameModeClassPath);
+	if (!GameModeClass)
+	{
+		GameModeClass = ABRGameMode::StaticClass();
+	}
+	const ABRGameMode* GameModeCDO = GameModeClass->GetDefaultObject<ABRGameMode>();
+
+	// 2. 커맨드렛에서는 백그라운드 스캔이 끝나지 않았을 수 있으므로 동기 스캔
+	IAssetRegistry::GetChecked().SearchAllAssets(true);
+
+	// 3. 런타임이 어느 쪽 목록을 쓰든 찾을 수 있도록 폴더 스캔 결과와 개별 목록을 모두 포함
+	TArray<FString> PackageNames = UBRStageCatalogSubsystem::CollectStagePackageNames(GameModeCDO->StageFolderPath, TArray<FString>());
+	for (const FString& PackageName : GameModeCDO->StageMapPathsFallback)
+	{
+		PackageNames.AddUnique(PackageName);
+	}
+
+	TMap<FString, int64> SizeByPackage;
+	for (const FString& PackageName : PackageNames)
+	{
+		if (PackageName.IsEmpty() || !FPackageName::DoesPackageExist(PackageName))
+		{
+			UE_LOG(LogStageCatalog, Warning, TEXT("[Stage 크기표] 패키지 없음 → 건너뜀: %s"), *PackageName);
+			continue;
+		}
+
+		const int64 Bytes = UBRStageCatalogSubsystem::ComputeApproxMemoryBytes(FName(*PackageName));
+		SizeByPackage.Add(PackageName, Bytes);
+		UE_LOG(LogStageCatalog, Display, TEXT("  %s | 약 %.1f MB"), *PackageName, (double)Bytes / (1024.0 * 1024.0));
+	}
+
+	// 4. 저장
+	return UBRStageCatalogSubsystem::WriteStageSizeFile(UBRStageCatalogSubsystem::GetStageSizeFilePath(), SizeByPackage) ? 0 : 1;
+}
@@ -1,6 +1,7 @@
 // BR_LobbyMenuWidget.cpp
 #include "BR_LobbyMenuWidget.h"
 #include "BR_LobbyTeamSlotDisplayInterface.h"
+#include "BR_SelectTeamWidget.h"
 #include "BRPlayerController.h"
 #include "BRGameState.h"
 #include "BRPlayerState.h"
@@ -22,49 +23,30 @@ void UBR_LobbyMenuWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
-	// PlayerController 캐시
+	// PlayerController / GameState 캐시
 	CachedPlayerController = GetBRPlayerController();
-
-	// GameState 캐시 및 이벤트 바인딩
 	CachedGameState = GetBRGameState();
-	if (CachedGameState)
-	{
-		CachedGameState->OnPlayerListChanged.AddDynamic(this, &UBR_LobbyMenuWidget::HandlePlayerListChanged);
-		CachedGameState->OnTeamChanged.AddDynamic(this, &UBR_LobbyMenuWidget::HandleTeamChanged);
-		
-		// 초기 게임 시작 가능 여부 확인
-		HandleCanStartGameChanged();
-	}
-
-	// 늦게 들어온 클라이언트 대응: 구독 시점에 이미 지나간 OnRep를 놓쳤을 수 있으므로
-	// 현재 GameState 기준으로 즉시 한 번 갱신
-	HandlePlayerListChanged();
 
-	// 복제가 0.45초 타이머보다 늦게 도착하는 경우를 위해, 짧은 지연 후 한 번 더 갱신
-	if (UWorld* World = GetWorld())
+	// GameState·PlayerState의 OnRep은 뷰모델에서 프레임 단위로 묶여 전달됨 (틱 폴링·지연 타이머 없음)
+	if (UBRLobbyViewModelSubsystem* LobbyViewModel = UBRLobbyViewModelSubsystem::Get(this))
 	{
-		World->GetTimerManager().SetTimer(LateJoinerRefreshTimerHandle, this, &UBR_LobbyMenuWidget::HandlePlayerListChanged, 0.6f, false);
+		LobbyViewUpdatedHandle = LobbyViewModel->OnLobbyViewUpdated.AddUObject(this, &UBR_LobbyMenuWidget::HandleLobbyViewUpdated);
 	}
 
-	// 초기 방 제목 표시 (HandlePlayerListChanged에서도 호출되지만, 위에서 이미 한 번 호출함)
-	FString RoomTitle = UBRWidgetFunctionLibrary::GetRoomTitleForDisplay(this);
-	OnRoomTitleRefreshed(RoomTitle);
+	// 늦게 들어온 클라이언트 대응: 구독 시점에 이미 지나간 OnRep를 놓쳤을 수 있으므로
+	// 현재 GameState 기준으로 즉시 한 번 갱신. 이후 도착하는 복제는 뷰모델 이벤트로 반영
+	HandleLobbyViewUpdated(EBRLobbyViewDirty::All);
 }
 
 void UBR_LobbyMenuWidget::NativeDestruct()
 {
-	// 지연 갱신 타이머 해제
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(LateJoinerRefreshTimerHandle);
-	}
-	// 이벤트 바인딩 해제
-	if (CachedGameState)
+	// 뷰모델 구독 해제
+	if (UBRLobbyViewModelSubsystem* LobbyViewModel = UBRLobbyViewModelSubsystem::Get(this))
 	{
-		CachedGameState->OnPlayerListChanged.RemoveDynamic(this, &UBR_LobbyMenuWidget::HandlePlayerListChanged);
-		CachedGameState->OnTeamChanged.RemoveDynamic(this, &UBR_LobbyMenuWidget::HandleTeamChanged);
-		CachedGameState = nullptr;
+		LobbyViewModel->OnLobbyViewUpdated.Remove(LobbyViewUpdatedHandle);
 	}
+	LobbyViewUpdatedHandle.Reset();
+	CachedGameState = nullptr;
 	CachedPlayerController = nullptr;
 
 	Super::NativeDestruct();
@@ -267,6 +249,33 @@ void UBR_LobbyMenuWidget::AssignMyPlayerToTeamSlot(int32 TeamID, int32 PlayerInd
 	}
 }
 
+void UBR_LobbyMenuWidget::HandleLobbyViewUpdated(EBRLobbyViewDirty DirtyFlags)
+{
+	if (EnumHasAnyFlags(DirtyFlags, EBRLobbyViewDirty::PlayerList))
+	{
+		HandlePlayerListChanged();
+	}
+	else if (EnumHasAnyFlags(DirtyFlags, EBRLobbyViewDirty::RoomTitle))
+	{
+		OnRoomTitleRefreshed(UBRWidgetFunctionLibrary::GetRoomTitleForDisplay(this));
+	}
+	if (EnumHasAnyFlags(DirtyFlags, EBRLobbyViewDirty::Teams))
+	{
+		HandleTeamChanged();
+	}
+	if (EnumHasAnyFlags(DirtyFlags, EBRLobbyViewDirty::CanStartGame))
+	{
+		HandleCanStartGameChanged();
+	}
+	if (EnumHasAnyFlags(DirtyFlags, EBRLobbyViewDirty::StagePreload))
+	{
+		if (ABRGameState* GS = GetBRGameState())
+		{
+			OnStagePreloadProgressChanged(GS->PendingStageMapPath, GS->GetStagePreloadProgress());
+		}
+	}
+}
+
 void UBR_LobbyMenuWidget::HandlePlayerListChanged()
 {
 	// 팀 슬롯(1P/2P) 자동 갱신: 인터페이스 구현체 찾아서 UpdateSlotDisplay 호출.
@@ -300,7 +309,9 @@ void UBR_LobbyMenuWidget::HandlePlayerListChanged()
 				if (UserWidget != this && !Visited.Contains(UserWidget))
 				{
 					Visited.Add(UserWidget);
-					if (UserWidget->GetClass()->ImplementsInterface(UBR_LobbyTeamSlotDisplayInterface::StaticClass()))
+					// UBR_SelectTeamWidget은 뷰모델을 직접 구독하므로 여기서 중복 갱신하지 않음
+					if (!UserWidget->IsA<UBR_SelectTeamWidget>()
+						&& UserWidget->GetClass()->ImplementsInterface(UBR_LobbyTeamSlotDisplayInterface::StaticClass()))
 					{
 						IBR_LobbyTeamSlotDisplayInterface::Execute_UpdateSlotDisplay(UserWidget);
 					}
@@ -330,26 +341,9 @@ void UBR_LobbyMenuWidget::HandleTeamChanged()
 
 void UBR_LobbyMenuWidget::HandleCanStartGameChanged()
 {
-	// GameState에서 게임 시작 가능 여부 가져오기
-	if (CachedGameState)
+	// GameState에서 게임 시작 가능 여부 가져오기 (OnRep_CanStartGame → 뷰모델 경유로 호출됨)
+	if (ABRGameState* GS = GetBRGameState())
 	{
-		OnCanStartGameChanged(CachedGameState->bCanStartGame);
-	}
-}
-
-// NativeTick를 사용하여 주기적으로 게임 시작 가능 여부 확인
-void UBR_LobbyMenuWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
-{
-	Super::NativeTick(MyGeometry, InDeltaTime);
-
-	// GameState의 bCanStartGame이 변경되었는지 확인
-	if (CachedGameState)
-	{
-		static bool bLastCanStartGame = false;
-		if (bLastCanStartGame != CachedGameState->bCanStartGame)
-		{
-			bLastCanStartGame = CachedGameState->bCanStartGame;
-			HandleCanStartGameChanged();
-		}
+		OnCanStartGameChanged(GS->bCanStartGame);
 	}
 }
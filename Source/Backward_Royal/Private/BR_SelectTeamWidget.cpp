@@ -10,27 +10,30 @@
 void UBR_SelectTeamWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
-	CachedGameState = GetWorld() ? GetWorld()->GetGameState<ABRGameState>() : nullptr;
-	if (CachedGameState)
+	// 버튼 클릭 후 결과는 OnRep_LobbySlots / PlayerState OnRep → 뷰모델 경유로 도착하므로 지연 타이머 불필요
+	if (UBRLobbyViewModelSubsystem* LobbyViewModel = UBRLobbyViewModelSubsystem::Get(this))
 	{
-		CachedGameState->OnPlayerListChanged.AddDynamic(this, &UBR_SelectTeamWidget::HandlePlayerListChanged);
+		LobbyViewUpdatedHandle = LobbyViewModel->OnLobbyViewUpdated.AddUObject(this, &UBR_SelectTeamWidget::HandleLobbyViewUpdated);
 	}
 	UpdateSlotDisplay();
 }
 
 void UBR_SelectTeamWidget::NativeDestruct()
 {
-	if (CachedGameState)
+	if (UBRLobbyViewModelSubsystem* LobbyViewModel = UBRLobbyViewModelSubsystem::Get(this))
 	{
-		CachedGameState->OnPlayerListChanged.RemoveDynamic(this, &UBR_SelectTeamWidget::HandlePlayerListChanged);
-		CachedGameState = nullptr;
+		LobbyViewModel->OnLobbyViewUpdated.Remove(LobbyViewUpdatedHandle);
 	}
+	LobbyViewUpdatedHandle.Reset();
 	Super::NativeDestruct();
 }
 
-void UBR_SelectTeamWidget::HandlePlayerListChanged()
+void UBR_SelectTeamWidget::HandleLobbyViewUpdated(EBRLobbyViewDirty DirtyFlags)
 {
-	UpdateSlotDisplay();
+	if (EnumHasAnyFlags(DirtyFlags, EBRLobbyViewDirty::PlayerList | EBRLobbyViewDirty::Teams))
+	{
+		UpdateSlotDisplay();
+	}
 }
 
 /** TeamIndex 1~4 → 0~3, 0~3은 그대로. 내부 API는 0~3만 사용 */
@@ -54,7 +57,6 @@ void UBR_SelectTeamWidget::RequestAssignToTeamSlotSpectator()
 		if (ABRPlayerController* BRPC = Cast<ABRPlayerController>(PC))
 		{
 			BRPC->RequestAssignToLobbyTeam(GetTeamIndex0Based(TeamIndex), 0);  // SlotIndex 0 = 관전
-			ScheduleSlotDisplayRefresh();
 		}
 	}
 }
@@ -66,7 +68,6 @@ void UBR_SelectTeamWidget::RequestAssignToTeamSlot1P()
 		if (ABRPlayerController* BRPC = Cast<ABRPlayerController>(PC))
 		{
 			BRPC->RequestAssignToLobbyTeam(GetTeamIndex0Based(TeamIndex), 1);  // SlotIndex 1 = 하체(1P)
-			ScheduleSlotDisplayRefresh();
 		}
 	}
 }
@@ -78,23 +79,10 @@ void UBR_SelectTeamWidget::RequestAssignToTeamSlot2P()
 		if (ABRPlayerController* BRPC = Cast<ABRPlayerController>(PC))
 		{
 			BRPC->RequestAssignToLobbyTeam(GetTeamIndex0Based(TeamIndex), 2);  // SlotIndex 2 = 상체(2P)
-			ScheduleSlotDisplayRefresh();
 		}
 	}
 }
 
-void UBR_SelectTeamWidget::ScheduleSlotDisplayRefresh()
-{
-	UWorld* World = GetWorld();
-	if (!World) return;
-	TWeakObjectPtr<UBR_SelectTeamWidget> WeakThis(this);
-	// 복제 도착 후 1P/2P 이름 갱신: 0.25초·0.6초 두 번 호출해 지연 복제에도 대응
-	auto Refresh = [WeakThis]() { if (UBR_SelectTeamWidget* W = WeakThis.Get()) W->UpdateSlotDisplay(); };
-	FTimerHandle H1, H2;
-	World->GetTimerManager().SetTimer(H1, [WeakThis, Refresh]() { Refresh(); }, 0.25f, false);
-	World->GetTimerManager().SetTimer(H2, [WeakThis, Refresh]() { Refresh(); }, 0.6f, false);
-}
-
 void UBR_SelectTeamWidget::UpdateSlotDisplay_Implementation()
 {
 	UWorld* World = GetWorld();
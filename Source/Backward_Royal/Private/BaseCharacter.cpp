@@ -10,6 +10,11 @@
 #include "PhysicsEngine/PhysicalAnimationComponent.h"
 #include "BRPlayerState.h"
 #include "BRGameMode.h"
+#include "BRSignificanceSubsystem.h"
+#include "BRActorRegistrySubsystem.h"
+#if !UE_BUILD_SHIPPING
+#include "BRCombatBenchmarkSubsystem.h"
+#endif
 #include "Kismet/GameplayStatics.h"
 #include "Animation/AnimMontage.h"
 #include "Animation/AnimInstance.h"
@@ -93,6 +98,69 @@ void ABaseCharacter::BeginPlay()
     }
 
     UpdateHPUI();
+
+    UBRSignificanceSubsystem::RegisterCharacter(this);
+    UBRActorRegistrySubsystem::RegisterCharacter(this);
+}
+
+void ABaseCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UBRActorRegistrySubsystem::UnregisterCharacter(this);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ABaseCharacter::ApplySignificance(EBRSignificance NewSignificance)
+{
+    USkeletalMeshComponent* BodyMesh = GetMesh();
+    if (!BodyMesh) return;
+
+    // 서버(데디케이티드·리슨 호스트)는 화면 밖 캐릭터의 본 위치로도 타격 판정을 하므로 스로틀링하지 않음
+    // (AlwaysTickPose는 화면 밖에서 본을 갱신하지 않아 판정이 이전 포즈를 읽게 됨)
+    if (HasAuthority())
+    {
+        BodyMesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+        BodyMesh->SetComponentTickInterval(0.0f);
+        for (USkeletalMeshComponent* Part : { HeadMesh, ChestMesh, HandMesh, LegMesh, FootMesh })
+        {
+            if (Part)
+            {
+                Part->SetComponentTickInterval(0.0f);
+            }
+        }
+        return;
+    }
+
+    float AnimTickInterval = 0.0f;
+    EVisibilityBasedAnimTickOption TickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+    switch (NewSignificance)
+    {
+    case EBRSignificance::Critical:
+        TickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+        break;
+    case EBRSignificance::High:
+        break;
+    case EBRSignificance::Medium:
+        AnimTickInterval = 1.0f / 30.0f;
+        break;
+    case EBRSignificance::Low:
+        // 멀리 있거나 화면 밖: 10Hz, 렌더링될 때만 포즈 갱신
+        AnimTickInterval = 1.0f / 10.0f;
+        TickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+        break;
+    }
+
+    BodyMesh->VisibilityBasedAnimTickOption = TickOption;
+    BodyMesh->SetComponentTickInterval(AnimTickInterval);
+
+    // 방어구 파츠는 리더 포즈를 따라가므로 같은 간격으로 맞춤
+    for (USkeletalMeshComponent* Part : { HeadMesh, ChestMesh, HandMesh, LegMesh, FootMesh })
+    {
+        if (Part)
+        {
+            Part->SetComponentTickInterval(AnimTickInterval);
+        }
+    }
 }
 
 void ABaseCharacter::EquipWeapon(ABaseWeapon* NewWeapon)
@@ -193,6 +261,9 @@ void ABaseCharacter::RequestAttack()
 
             // [핵심] 선택된 몽타주를 인자로 전달 (RequestingPawn은 없으므로 nullptr)
             MulticastPlayWeaponAttack(MontageToPlay, nullptr);
+#if !UE_BUILD_SHIPPING
+            UBRCombatBenchmarkSubsystem::CountAttackMulticast(this);
+#endif
         }
         return;
     }
@@ -207,6 +278,9 @@ void ABaseCharacter::RequestAttack()
     if (SelectedMontage)
     {
         MulticastPlayPunch(SelectedMontage);
+#if !UE_BUILD_SHIPPING
+        UBRCombatBenchmarkSubsystem::CountAttackMulticast(this);
+#endif
         bNextAttackIsLeft = !bNextAttackIsLeft;
     }
 }
@@ -265,7 +339,6 @@ void ABaseCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     DOREPLIFETIME(ABaseCharacter, CurrentHP);
     DOREPLIFETIME(ABaseCharacter, CurrentWeapon);
-    DOREPLIFETIME(ABaseCharacter, LastDeathInfo);
     DOREPLIFETIME(ABaseCharacter, bIsStunned);
 }
 
@@ -279,6 +352,16 @@ bool ABaseCharacter::IsDead() const
     return false;
 }
 
+bool FDeathDamageInfo::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    // FVector_NetQuantize10과 같은 방식 (0.1 단위, 성분당 최대 24비트)
+    bOutSuccess = SerializePackedVector<10, 24>(Impulse, Ar);
+    bOutSuccess &= SerializePackedVector<10, 24>(HitLocation, Ar);
+    bOutSuccess &= SerializePackedVector<10, 24>(ServerDieLocation, Ar);
+    ServerDieRotation.SerializeCompressedShort(Ar);
+    return true;
+}
+
 void ABaseCharacter::SetLastHitInfo(FVector Impulse, FVector HitLocation)
 {
     LastDeathInfo.Impulse = Impulse;
@@ -346,7 +429,7 @@ void ABaseCharacter::Die(FVector KillImpulse, FVector HitLocation)
     LastDeathInfo.ServerDieLocation = GetActorLocation();
     LastDeathInfo.ServerDieRotation = GetActorRotation();
 
-    MulticastPerformDeathVisuals(KillImpulse, HitLocation, LastDeathInfo.ServerDieLocation, LastDeathInfo.ServerDieRotation);
+    MulticastPerformDeathVisuals(LastDeathInfo);
 
     // 2. 게임모드 호출 직전 로그
     ABRGameMode* GM = GetWorld()->GetAuthGameMode<ABRGameMode>();
@@ -362,11 +445,21 @@ void ABaseCharacter::Die(FVector KillImpulse, FVector HitLocation)
 }
 
 // 기존 PerformDeathVisuals의 내부 구현부를 이 함수로 옮깁니다.
-void ABaseCharacter::MulticastPerformDeathVisuals_Implementation(FVector KillImpulse, FVector HitLoc, FVector ServerLoc, FRotator ServerRot)
+void ABaseCharacter::MulticastPerformDeathVisuals_Implementation(const FDeathDamageInfo& DeathInfo)
 {
     // 이미 물리 시뮬레이션 중이라면 중복 실행 방지
     if (GetMesh()->IsSimulatingPhysics()) return;
 
+    // 클라이언트도 블루프린트에서 LastDeathInfo를 읽을 수 있도록 보관 (별도 프로퍼티 복제 없음)
+    if (!HasAuthority())
+    {
+        LastDeathInfo = DeathInfo;
+    }
+    const FVector& KillImpulse = DeathInfo.Impulse;
+    const FVector& HitLoc = DeathInfo.HitLocation;
+    const FVector& ServerLoc = DeathInfo.ServerDieLocation;
+    const FRotator& ServerRot = DeathInfo.ServerDieRotation;
+
     CHAR_LOG(Warning, TEXT("Multicast PerformDeath Executed - Impulse: %s"), *KillImpulse.ToString());
 
     // 이동 동기화 해제
@@ -585,7 +678,7 @@ void ABaseCharacter::MulticastRecoverFromStun_Implementation()
     OnRecoverFromStun();
 }
 
-void ABaseCharacter::MulticastPlayPhysicalHitReaction_Implementation(FVector Impulse, FVector HitLocation, FName BoneName)
+void ABaseCharacter::PlayPhysicalHitReaction(const FVector& Impulse, const FVector& HitLocation, FName BoneName)
 {
     if (USkeletalMeshComponent* MyMesh = GetMesh())
     {
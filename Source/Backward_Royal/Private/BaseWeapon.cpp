@@ -1,9 +1,15 @@
 #include "BaseWeapon.h"
 #include "BaseCharacter.h"
 #include "BRGameInstance.h"
-#include "GeometryCollection/GeometryCollectionActor.h"
-#include "GeometryCollection/GeometryCollectionComponent.h"
+#include "BRFracturePoolSubsystem.h"
+#include "BRActorRegistrySubsystem.h"
+#include "BRBalanceSubsystem.h"
+#if !UE_BUILD_SHIPPING
+#include "BRCombatBenchmarkSubsystem.h"
+#endif
 #include "Kismet/GameplayStatics.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Net/UnrealNetwork.h"
 
 // α ũ
@@ -12,12 +18,6 @@ DEFINE_LOG_CATEGORY_STATIC(LogBaseWeapon, Display, All);
 #define LOG_WEAPON(Verbosity, Format, ...) \
     UE_LOG(LogBaseWeapon, Verbosity, TEXT("%s - %s"), *FString(__FUNCTION__), *FString::Printf(TEXT(Format), ##__VA_ARGS__))
 
-// static  ʱȭ (⺻ 1.0)
-float ABaseWeapon::GlobalDamageMultiplier = 1.0f;
-float ABaseWeapon::GlobalImpulseMultiplier = 1.0f;
-float ABaseWeapon::GlobalAttackSpeedMultiplier = 1.0f;
-float ABaseWeapon::GlobalDurabilityReduction = 10.0f;
-
 ABaseWeapon::ABaseWeapon()
 {
     PrimaryActorTick.bCanEverTick = false;
@@ -53,12 +53,32 @@ void ABaseWeapon::BeginPlay()
 {
     Super::BeginPlay();
     LoadWeaponData();
+
+    UBRActorRegistrySubsystem::RegisterWeapon(this);
+
+    if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+    {
+        Balance->OnBalanceChanged.AddUObject(this, &ABaseWeapon::HandleBalanceChanged);
+    }
 }
 
 void ABaseWeapon::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    UBRActorRegistrySubsystem::UnregisterWeapon(this);
+
+    if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+    {
+        Balance->OnBalanceChanged.RemoveAll(this);
+    }
+
     Super::EndPlay(EndPlayReason);
 
+    if (WeaponAssetHandle.IsValid())
+    {
+        WeaponAssetHandle->ReleaseHandle();
+        WeaponAssetHandle.Reset();
+    }
+
     if (WeaponMesh)
     {
         WeaponMesh->SetSimulatePhysics(false);
@@ -67,9 +87,18 @@ void ABaseWeapon::EndPlay(const EEndPlayReason::Type EndPlayReason)
     }
 }
 
+void ABaseWeapon::HandleBalanceChanged(const FBRBalanceSnapshot& Snapshot)
+{
+    if (Snapshot.Serial == CachedBalanceSerial) return;
+
+    CachedBalanceSerial = Snapshot.Serial;
+    DurabilityReduction = Snapshot.Data.Global_Durability_Reduction;
+}
+
 void ABaseWeapon::LoadWeaponData()
 {
-    DurabilityReduction = GlobalDurabilityReduction;
+    //  OnConstruction   νϽ  ⺻ 
+    HandleBalanceChanged(*UBRBalanceSubsystem::GetSnapshot(this));
 
     UBRGameInstance* GI = Cast<UBRGameInstance>(GetGameInstance());
     if (!GI) return;
@@ -96,6 +125,11 @@ void ABaseWeapon::LoadWeaponData()
     if (FoundData)
     {
         CurrentWeaponData = *FoundData;
+        // ٴڿ ޸  ⵵  ε ٲ ͸ Ŭ̾Ʈ ޵   
+        if (HasAuthority() && HasActorBegunPlay())
+        {
+            FlushNetDormancy();
+        }
         InitializeWeaponStats(CurrentWeaponData);
         LOG_WEAPON(Display, "Loaded Weapon Data for [%s] from GameInstance", *WeaponRowName.ToString());
     }
@@ -115,13 +149,56 @@ void ABaseWeapon::InitializeWeaponStats(const FWeaponData& NewStats)
         GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Cyan, DebugMsg);
     }
 
-    if (WeaponMesh && NewStats.WeaponMesh)
+    if (!WeaponMesh || NewStats.WeaponMesh.IsNull()) return;
+
+    // ޽  (ε Ϸ  ȣ)
+    const TSoftObjectPtr<UStaticMesh> MeshRef = NewStats.WeaponMesh;
+    const float MassKg = NewStats.MassKg;
+    auto ApplyMesh = [this, MeshRef, MassKg]()
     {
-        WeaponMesh->SetStaticMesh(NewStats.WeaponMesh);
-        if (NewStats.MassKg > 0.0f)
+        if (UStaticMesh* LoadedMesh = MeshRef.Get())
         {
-            WeaponMesh->SetMassOverrideInKg(NAME_None, NewStats.MassKg, true);
+            WeaponMesh->SetStaticMesh(LoadedMesh);
+            if (MassKg > 0.0f)
+            {
+                WeaponMesh->SetMassOverrideInKg(NAME_None, MassKg, true);
+            }
+            // 񵿱 ε尡   ٽ ޸  Ƿ Ǵ ޽ 浵    
+            if (HasAuthority() && HasActorBegunPlay())
+            {
+                FlushNetDormancy();
+            }
         }
+    };
+
+    // (OnConstruction) ̸  ε
+    UWorld* World = GetWorld();
+    if (!World || !World->IsGameWorld())
+    {
+        MeshRef.LoadSynchronous();
+        ApplyMesh();
+        return;
+    }
+
+    //  ޽ +  ޽ø Բ 񵿱 ε.  ޽ô ڵ Ƶξ BreakWeapon  ̹ 
+    TArray<FSoftObjectPath> AssetsToLoad;
+    AssetsToLoad.Add(NewStats.WeaponMesh.ToSoftObjectPath());
+    if (!NewStats.FracturedMesh.IsNull())
+    {
+        AssetsToLoad.Add(NewStats.FracturedMesh.ToSoftObjectPath());
+    }
+
+    if (WeaponAssetHandle.IsValid())
+    {
+        WeaponAssetHandle->CancelHandle();
+    }
+    WeaponAssetHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetsToLoad,
+        FStreamableDelegate::CreateWeakLambda(this, ApplyMesh));
+
+    // ̹ ޸𸮿 ־ٸ  û  Ϸ. ׷ ޽ð   ٷ 
+    if (MeshRef.Get() && WeaponMesh->GetStaticMesh() != MeshRef.Get())
+    {
+        ApplyMesh();
     }
 }
 
@@ -175,6 +252,8 @@ void ABaseWeapon::DecreaseDurability(float DamageAmount)
     if (CurrentWeaponData.Durability <= 0.0f) return;
 
     CurrentWeaponData.Durability = FMath::Clamp(CurrentWeaponData.Durability - DurabilityReduction, 0.0f, CurrentWeaponData.Durability);
+    //   : ޸ ̸   ( ̸ ̹ Awake  )
+    FlushNetDormancy();
     LOG_WEAPON(Display, "Durability: %.1f / %.1f", CurrentWeaponData.Durability, 100.f);
 
     if (CurrentWeaponData.Durability <= 0.0f)
@@ -200,6 +279,9 @@ void ABaseWeapon::BreakWeapon()
     if (OwnerCharacter)
     {
         OwnerCharacter->MulticastHandleWeaponBroken();
+#if !UE_BUILD_SHIPPING
+        UBRCombatBenchmarkSubsystem::CountWeaponBreakMulticast(this);
+#endif
     }
 
     // 3. Transform    
@@ -213,6 +295,9 @@ void ABaseWeapon::BreakWeapon()
     {
         //  CurrentWeaponData.FracturedMesh  ڷ Ѱ Ŭ̾Ʈ Null  
         Multicast_BreakWeaponVisual(SpawnTransform, CurrentWeaponData.FracturedMesh);
+#if !UE_BUILD_SHIPPING
+        UBRCombatBenchmarkSubsystem::CountWeaponBreakMulticast(this);
+#endif
 
         // ƼĳƮ RPC Ŭ̾Ʈ鿡  ð ֱ   ð  (0.2 -> 0.5)
         SetLifeSpan(0.5f);
@@ -220,69 +305,23 @@ void ABaseWeapon::BreakWeapon()
 }
 
 // [] Ű  Ѱ InFracturedMesh ϵ 
-void ABaseWeapon::Multicast_BreakWeaponVisual_Implementation(const FTransform& SpawnTransform, UGeometryCollection* InFracturedMesh)
+void ABaseWeapon::Multicast_BreakWeaponVisual_Implementation(const FTransform& SpawnTransform, const TSoftObjectPtr<UGeometryCollection>& InFracturedMeshRef)
 {
+    //   ε  ̸ ÷ιǷ  Get() . ̸  ε 
+    UGeometryCollection* InFracturedMesh = InFracturedMeshRef.Get();
+    if (!InFracturedMesh && !InFracturedMeshRef.IsNull())
+    {
+        InFracturedMesh = InFracturedMeshRef.LoadSynchronous();
+    }
+
     LOG_WEAPON(Display, "Multicast_BreakWeaponVisual Called. Mesh Valid: %s", InFracturedMesh ? TEXT("True") : TEXT("False"));
 
     if (InFracturedMesh)
     {
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-        AGeometryCollectionActor* FracturedActor = GetWorld()->SpawnActorDeferred<AGeometryCollectionActor>(
-            AGeometryCollectionActor::StaticClass(),
-            SpawnTransform
-        );
-
-        if (FracturedActor)
+        // Ź  ʰ º Ǯ   (  Ǯ Ƿ  )
+        if (UBRFracturePoolSubsystem* FracturePool = UBRFracturePoolSubsystem::Get(this))
         {
-            //  Ŭ̾Ʈ ÷  ̹Ƿ    ¸ øƮ   (Ʈũ  )
-            FracturedActor->SetReplicates(false);
-
-            UGeometryCollectionComponent* GCComp = FracturedActor->GetGeometryCollectionComponent();
-            if (GCComp)
-            {
-                // Ŭ̾Ʈ ȯ濡  Ѱ ͸   
-                GCComp->SetRestCollection(InFracturedMesh);
-
-                // 1. ı 100% Ǵ ⺻   
-                GCComp->SetCollisionProfileName(TEXT("PhysicsActor"));
-
-                // 2.   :  ÷̾  ų ƨܳ ʵ 
-                GCComp->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
-                GCComp->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
-
-                GCComp->SetSimulatePhysics(true);
-                GCComp->SetNotifyRigidBodyCollision(true);
-            }
-
-            // FinishSpawningActor ȣϿ  ʱȭ Ϸ
-            UGameplayStatics::FinishSpawningActor(FracturedActor, SpawnTransform);
-
-            if (GCComp)
-            {
-                //  Ϸ Ŀ  ¸ ϰ 
-                GCComp->RecreatePhysicsState();
-
-                // Ÿ Ϳ   ־ ڸ  и
-                FHitResult HitInfo;
-                HitInfo.ImpactPoint = SpawnTransform.GetLocation();
-
-                UGameplayStatics::ApplyPointDamage(
-                    FracturedActor,
-                    1000000.f,
-                    FVector::DownVector,
-                    HitInfo,
-                    nullptr,
-                    this,
-                    nullptr
-                );
-
-                //  ¦  ޽ ߰
-                FVector CrumbleImpulse = FMath::VRand() * 10.0f;
-                GCComp->AddImpulse(CrumbleImpulse, NAME_None, true);
-            }
-            FracturedActor->SetLifeSpan(10.0f);
+            FracturePool->PlayFracture(InFracturedMesh, SpawnTransform, this);
         }
     }
     else
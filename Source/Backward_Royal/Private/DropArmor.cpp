@@ -2,6 +2,9 @@
 #include "DropArmor.h"
 #include "PlayerCharacter.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StreamableManager.h"
 
 DEFINE_LOG_CATEGORY(LogDropArmor);
 
@@ -27,11 +30,19 @@ void ADropArmor::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Ϳ  ޽ð ִٸ 
-	if (ArmorData.ArmorMesh)
+	// Ϳ  ޽ð ִٸ 񵿱 ε   (Ʈ )
+	if (!ArmorData.ArmorMesh.IsNull())
 	{
-		ArmorMeshComp->SetSkeletalMesh(ArmorData.ArmorMesh);
-		ARMOR_LOG(Display, TEXT("Armor Mesh Set: %s"), *ArmorData.ArmorMesh->GetName());
+		const FSoftObjectPath MeshPath = ArmorData.ArmorMesh.ToSoftObjectPath();
+		UAssetManager::GetStreamableManager().RequestAsyncLoad(MeshPath,
+			FStreamableDelegate::CreateWeakLambda(this, [this, MeshPath]()
+				{
+					if (USkeletalMesh* LoadedMesh = Cast<USkeletalMesh>(MeshPath.ResolveObject()))
+					{
+						ArmorMeshComp->SetSkeletalMesh(LoadedMesh);
+						ARMOR_LOG(Display, TEXT("Armor Mesh Set: %s"), *LoadedMesh->GetName());
+					}
+				}));
 	}
 
 	// ()  ùķ̼ Ȱȭ
@@ -51,7 +62,7 @@ bool ADropArmor::OnPickup(ABaseCharacter* Character)
 	}
 
 	// 2.  ȿ ˻
-	if (!ArmorData.ArmorMesh)
+	if (ArmorData.ArmorMesh.IsNull())
 	{
 		ARMOR_LOG(Warning, TEXT("OnPickup Failed: ArmorMesh is NULL in ArmorData"));
 		return false;
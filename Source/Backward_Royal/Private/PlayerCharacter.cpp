@@ -10,8 +10,12 @@
 #include "BRPlayerController.h"
 #include "Net/UnrealNetwork.h"
 #include "BRGameInstance.h"
+#include "BRArmorCatalogSubsystem.h"
+#include "BRAssetStreamingSubsystem.h"
 #include "BRPlayerState.h"
 #include "BRGameState.h"
+#include "BRSignificanceSubsystem.h"
+#include "BRBalanceSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 
@@ -20,13 +24,11 @@ DEFINE_LOG_CATEGORY(LogPlayerChar);
 #define LOG_PLAYER(Verbosity, Format, ...) \
     UE_LOG(LogPlayerChar, Verbosity, TEXT("%s - %s"), *FString(__FUNCTION__), *FString::Printf(Format, ##__VA_ARGS__))
 
-// static 변수 초기화
-float APlayerCharacter::Global_RotationRateYaw = 300.0f;
-float APlayerCharacter::Global_BrakingFriction = 1.0f;
-float APlayerCharacter::Global_BrakingDecelerationWalking = 500.0f;
-
 APlayerCharacter::APlayerCharacter()
 {
+	// 이동 관성 기본값 (BeginPlay에서 밸런스 스냅샷 값으로 덮어씀)
+	const FGlobalBalanceData DefaultBalance;
+
 	// [기본 설정 유지 및 수정]
 	bUseControllerRotationPitch = false;
 
@@ -37,15 +39,15 @@ APlayerCharacter::APlayerCharacter()
 
 	// 회전 관성 적용
 	GetCharacterMovement()->bUseControllerDesiredRotation = true; // 컨트롤러 시점 방향으로 천천히 회전하게 만듭니다.
-	GetCharacterMovement()->RotationRate = FRotator(0.0f, Global_RotationRateYaw, 0.0f); // Yaw 수치가 낮을수록 회전이 더 묵직하고 느려집니다. (기존 500.0f)
+	GetCharacterMovement()->RotationRate = FRotator(0.0f, DefaultBalance.Global_Player_RotationRateYaw, 0.0f); // Yaw 수치가 낮을수록 회전이 더 묵직하고 느려집니다. (기존 500.0f)
 	GetCharacterMovement()->bOrientRotationToMovement = false;
 
 	// 2. WASD 이동 관성 (가속 및 감속)
 	// 캐릭터의 초기 가속을 느리게 하고, 키를 뗐을 때 즉시 멈추지 않고 미끄러지듯 감속하게 합니다.
 	GetCharacterMovement()->MaxAcceleration = 600.f; // 가속도: 수치가 낮을수록 최고 속도에 도달하기까지 오래 걸려 무겁게 느껴집니다.
 	GetCharacterMovement()->bUseSeparateBrakingFriction = true; // 감속 마찰력을 별도로 사용하도록 활성화합니다.
-	GetCharacterMovement()->BrakingFriction = Global_BrakingFriction; // 마찰력: 수치가 낮을수록 키를 뗐을 때 지면에서 더 많이 미끄러집니다.
-	GetCharacterMovement()->BrakingDecelerationWalking = Global_BrakingDecelerationWalking; // 감속도: 수치가 낮을수록 완전히 정지할 때까지의 거리가 길어집니다.
+	GetCharacterMovement()->BrakingFriction = DefaultBalance.Global_Player_BrakingFriction; // 마찰력: 수치가 낮을수록 키를 뗐을 때 지면에서 더 많이 미끄러집니다.
+	GetCharacterMovement()->BrakingDecelerationWalking = DefaultBalance.Global_Player_BrakingDecelerationWalking; // 감속도: 수치가 낮을수록 완전히 정지할 때까지의 거리가 길어집니다.
 
 	// GetMesh()->SetOwnerNoSee(true); // <- 몸 투명화
 	GetMesh()->bCastHiddenShadow = true;
@@ -126,6 +128,12 @@ void APlayerCharacter::BeginPlay()
 		UpperBodyAimRotation = GetActorRotation();
 	}
 
+	if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+	{
+		Balance->OnBalanceChanged.AddUObject(this, &APlayerCharacter::HandleBalanceChanged);
+	}
+	HandleBalanceChanged(*UBRBalanceSubsystem::GetSnapshot(this));
+
 	// [기존 코드] 입력 시스템 등록
 	if (APlayerController* PlayerController = Cast<APlayerController>(Controller))
 	{
@@ -611,15 +619,19 @@ void APlayerCharacter::ApplyMeshFromID(EArmorSlot Slot, int32 MeshID)
 		return;
 	}
 
-	// 2. GameInstance의 맵에서 'ArmorData' 테이블 찾기
-	UDataTable* ArmorDT = nullptr;
-	if (GI->ConfigDataMap.Contains(TEXT("ArmorData")))
+	// 2. 방어구 카탈로그(ID 인덱스) 가져오기
+	UBRArmorCatalogSubsystem* ArmorCatalog = GI->GetSubsystem<UBRArmorCatalogSubsystem>();
+	if (ArmorCatalog && !ArmorCatalog->GetArmorTable())
 	{
-		ArmorDT = GI->ConfigDataMap[TEXT("ArmorData")];
+		// 아직 인덱싱 전이면 GameInstance의 'ArmorData' 테이블로 1회 구성
+		if (UDataTable** ArmorDTPtr = GI->ConfigDataMap.Find(UBRArmorCatalogSubsystem::ArmorTableKey))
+		{
+			ArmorCatalog->RebuildIndex(*ArmorDTPtr);
+		}
 	}
 
 	// 테이블이 없으면 중단
-	if (!ArmorDT)
+	if (!ArmorCatalog || !ArmorCatalog->GetArmorTable())
 	{
 		LOG_PLAYER(Error, TEXT("ArmorDataTable Not Found in GameInstance ConfigMap!"));
 		return;
@@ -655,6 +667,9 @@ void APlayerCharacter::ApplyMeshFromID(EArmorSlot Slot, int32 MeshID)
 
 	if (!TargetMeshComp) return;
 
+	// 이 슬롯에 마지막으로 요청된 ID 기록 (늦게 끝난 비동기 로드가 최신 선택을 덮어쓰지 않도록)
+	RequestedArmorIDs[(int32)Slot] = MeshID;
+
 	// 4. ID가 0인 경우 (장비 해제) -> 기본(맨몸) 메시 적용
 	if (MeshID == 0)
 	{
@@ -663,36 +678,27 @@ void APlayerCharacter::ApplyMeshFromID(EArmorSlot Slot, int32 MeshID)
 		return;
 	}
 
-	// 5. 데이터 검색
-	FArmorData* FoundData = nullptr;
-
-	static const FString ContextString(TEXT("ApplyMeshFromID_Search"));
-	TArray<FArmorData*> AllRows;
-
-	// 테이블의 모든 행을 가져옵니다.
-	ArmorDT->GetAllRows<FArmorData>(ContextString, AllRows);
+	// 5. 데이터 검색 (슬롯별 평면 배열 인덱싱)
+	const FArmorData* FoundData = ArmorCatalog->FindArmor(MeshID);
+	UBRAssetStreamingSubsystem* Streaming = GI->GetSubsystem<UBRAssetStreamingSubsystem>();
 
-	// 반복문으로 하나씩 ID를 대조합니다.
-	for (FArmorData* Row : AllRows)
+	// ID는 있는데 데이터를 못 찾았다면 안전하게 기본 메시 적용
+	if (!FoundData || FoundData->ArmorMesh.IsNull() || !Streaming)
 	{
-		if (Row && Row->ID == MeshID)
-		{
-			FoundData = Row;
-			break;
-		}
-	}
-
-	// 6. 적용
-	if (FoundData && FoundData->ArmorMesh)
-	{
-		TargetMeshComp->SetSkeletalMesh(FoundData->ArmorMesh);
-		LOG_PLAYER(Display, TEXT("Applied Mesh ID %d via GameInstance"), MeshID);
-	}
-	else
-	{
-		// ID는 있는데 데이터를 못 찾았다면 안전하게 기본 메시 적용
 		TargetMeshComp->SetSkeletalMesh(MeshToApply);
+		return;
 	}
+
+	// 6. 적용 (이미 로드되어 있으면 즉시, 아니면 로드 완료 시점에 적용 → SetSkeletalMesh 히치 방지)
+	TWeakObjectPtr<USkeletalMeshComponent> WeakTarget = TargetMeshComp;
+	Streaming->RequestArmorMesh(MeshID, FOnArmorMeshLoaded::CreateWeakLambda(this, [this, WeakTarget, Slot, MeshID, MeshToApply](USkeletalMesh* LoadedMesh)
+		{
+			// 로드 중에 다른 ID가 선택되었으면 무시
+			if (RequestedArmorIDs[(int32)Slot] != MeshID || !WeakTarget.IsValid()) return;
+
+			WeakTarget->SetSkeletalMesh(LoadedMesh ? LoadedMesh : MeshToApply);
+			LOG_PLAYER(Display, TEXT("Applied Mesh ID %d via GameInstance"), MeshID);
+		}));
 }
 
 void APlayerCharacter::UpdatePreviewMesh(const FBRCustomizationData& NewData)
@@ -708,8 +714,26 @@ void APlayerCharacter::UpdatePreviewMesh(const FBRCustomizationData& NewData)
 	// LOG_PLAYER(Display, TEXT("Preview Updated: HeadID %d"), NewData.HeadID);
 }
 
+void APlayerCharacter::HandleBalanceChanged(const FBRBalanceSnapshot& Snapshot)
+{
+	if (Snapshot.Serial == CachedBalanceSerial) return;
+	CachedBalanceSerial = Snapshot.Serial;
+
+	if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
+	{
+		MovementComp->RotationRate = FRotator(0.0f, Snapshot.Data.Global_Player_RotationRateYaw, 0.0f);
+		MovementComp->BrakingFriction = Snapshot.Data.Global_Player_BrakingFriction;
+		MovementComp->BrakingDecelerationWalking = Snapshot.Data.Global_Player_BrakingDecelerationWalking;
+	}
+}
+
 void APlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+	{
+		Balance->OnBalanceChanged.RemoveAll(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 
 	// [크래시 방지] 레벨 이동 시 물리 엔진이 소멸된 컴포넌트를 참조하지 않도록 강제 종료
@@ -772,6 +796,23 @@ void APlayerCharacter::Tick(float DeltaTime)
 	ProcessFootstep(DeltaTime);
 }
 
+void APlayerCharacter::ApplySignificance(EBRSignificance NewSignificance)
+{
+	Super::ApplySignificance(NewSignificance);
+
+	// 액터 틱은 발소리 전용 → 멀리 있는 캐릭터는 낮은 빈도로 충분 (이동 컴포넌트는 별도 틱이라 영향 없음)
+	float ActorTickInterval = 0.0f;
+	if (NewSignificance == EBRSignificance::Medium)
+	{
+		ActorTickInterval = 1.0f / 20.0f;
+	}
+	else if (NewSignificance == EBRSignificance::Low)
+	{
+		ActorTickInterval = 1.0f / 5.0f;
+	}
+	SetActorTickInterval(ActorTickInterval);
+}
+
 
 // 발소리 처리 전용 함수 구현
 void APlayerCharacter::ProcessFootstep(float DeltaTime)
@@ -4,8 +4,7 @@
 #include "Components/BoxComponent.h"
 #include "Components/BillboardComponent.h"
 #include "GameFramework/Pawn.h"          // 플레이어(폰) 인식용
-#include "Kismet/GameplayStatics.h"      // 플레이어 스타트 찾기용
-#include "GameFramework/PlayerStart.h"   // 플레이어 스타트 클래스
+#include "BRRespawnSubsystem.h"         // 빈 리스폰 지점 찾기용
 // ---------------------------
 
 // 생성자
@@ -61,25 +60,14 @@ void APlayerResetZone::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActo
 
     if (PlayerPawn)
     {
-       // 3. 월드에 있는 모든 'PlayerStart' 액터를 찾습니다.
-       TArray<AActor*> FoundPlayerStarts;
-       UGameplayStatics::GetAllActorsOfClass(GetWorld(), APlayerStart::StaticClass(), FoundPlayerStarts);
-
-       // PlayerStart가 하나라도 있다면
-       if (FoundPlayerStarts.Num() > 0)
-       {
-          // 첫 번째로 발견된 PlayerStart의 위치를 가져옵니다.
-          FVector RestartLocation = FoundPlayerStarts[0]->GetActorLocation();
-
-          // 4. 플레이어를 해당 위치로 순간이동 시킵니다.
-          PlayerPawn->SetActorLocation(RestartLocation);
-
-          // 로그 출력 (테스트용)
-          UE_LOG(LogTemp, Warning, TEXT("[%s]가 낙하 구역에 진입하여 리셋되었습니다!"), *PlayerPawn->GetName());
-       }
-       else
+       // 3. 리스폰 서비스가 가장 가까운 빈 안전 지점으로 이동 (서버에서만, 상체면 붙어 있는 하체를 이동)
+       if (UBRRespawnSubsystem* Respawn = UBRRespawnSubsystem::Get(this))
        {
-          UE_LOG(LogTemp, Error, TEXT("월드에 PlayerStart가 없습니다! 리셋할 수 없습니다."));
+          if (Respawn->ResetFallenActor(PlayerPawn))
+          {
+             // 로그 출력 (테스트용)
+             UE_LOG(LogTemp, Warning, TEXT("[%s]가 낙하 구역에 진입하여 리셋되었습니다!"), *PlayerPawn->GetName());
+          }
        }
     }
-}
\ No newline at end of file
+}
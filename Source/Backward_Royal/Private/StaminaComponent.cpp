@@ -3,11 +3,8 @@
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Actor.h"
-
-// [ű]   ʱȭ (⺻ )
-float UStaminaComponent::Global_SprintDrainRate = 20.0f;
-float UStaminaComponent::Global_JumpCost = 15.0f;
-float UStaminaComponent::Global_RegenRate = 10.0f;
+#include "GameFramework/GameStateBase.h"
+#include "BRBalanceSubsystem.h"
 
 UStaminaComponent::UStaminaComponent()
 {
@@ -16,27 +13,77 @@ UStaminaComponent::UStaminaComponent()
 
     MaxStamina = 100.0f;
     CurrentStamina = MaxStamina;
+    StaminaState.Value = MaxStamina;
 }
 
 void UStaminaComponent::BeginPlay()
 {
     Super::BeginPlay();
 
-    StaminaDrainRate = Global_SprintDrainRate;
-    JumpCost = Global_JumpCost;
-    StaminaRegenRate = Global_RegenRate;
+    if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+    {
+        Balance->OnBalanceChanged.AddUObject(this, &UStaminaComponent::HandleBalanceChanged);
+    }
+    HandleBalanceChanged(*UBRBalanceSubsystem::GetSnapshot(this));
 
     if (GetOwner() && GetOwner()->HasAuthority())
     {
         CurrentStamina = MaxStamina;
+        CommitStaminaState(0.0f);
+    }
+    else
+    {
+        // Ŭ̾Ʈ ȭ   ܻ ƽ (BeginPlay   µ ⼭ ݿ)
+        CurrentStamina = ExtrapolateStamina();
+        SetComponentTickEnabled(StaminaState.RatePerSecond != 0.0f);
+    }
+    BroadcastStaminaChanged();
+}
+
+void UStaminaComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UBRBalanceSubsystem* Balance = UBRBalanceSubsystem::Get(this))
+    {
+        Balance->OnBalanceChanged.RemoveAll(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UStaminaComponent::HandleBalanceChanged(const FBRBalanceSnapshot& Snapshot)
+{
+    if (Snapshot.Serial == CachedBalanceSerial) return;
+
+    CachedBalanceSerial = Snapshot.Serial;
+    const float OldDrainRate = StaminaDrainRate;
+    const float OldRegenRate = StaminaRegenRate;
+    StaminaDrainRate = Snapshot.Data.Global_Stamina_SprintDrainRate;
+    JumpCost = Snapshot.Data.Global_Stamina_JumpCost;
+    StaminaRegenRate = Snapshot.Data.Global_Stamina_RegenRate;
+
+    // [] Ҹ/ȸ ߿ ġ ٲ   ȭ ٷ  (Ŭ̾Ʈ ܻ  ȭ ߳ ʵ)
+    if (GetOwner() && GetOwner()->HasAuthority() && HasBegunPlay())
+    {
+        float NewRate = StaminaState.RatePerSecond;
+        if (NewRate < 0.0f && NewRate == -OldDrainRate)
+        {
+            NewRate = -StaminaDrainRate;
+        }
+        else if (NewRate > 0.0f && NewRate == OldRegenRate)
+        {
+            NewRate = StaminaRegenRate;
+        }
+        if (NewRate != StaminaState.RatePerSecond)
+        {
+            CommitStaminaState(NewRate);
+        }
     }
-    OnRep_CurrentStamina();
 }
 
 void UStaminaComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(UStaminaComponent, CurrentStamina);
+    DOREPLIFETIME(UStaminaComponent, StaminaState);
     DOREPLIFETIME(UStaminaComponent, bIsSprinting);
 }
 
@@ -60,7 +107,10 @@ void UStaminaComponent::ConsumeJumpStamina()
         if (CurrentStamina >= JumpCost)
         {
             CurrentStamina = FMath::Clamp(CurrentStamina - JumpCost, 0.0f, MaxStamina);
-            OnRep_CurrentStamina();
+
+            //  ҿ ٲǷ ȭ Ƶ  
+            CommitStaminaState(StaminaState.RatePerSecond);
+            BroadcastStaminaChanged();
         }
     }
 }
@@ -77,55 +127,118 @@ void UStaminaComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 
     if (GetOwner() && GetOwner()->HasAuthority())
     {
-        float OldStamina = CurrentStamina;
-        bool bActuallyMoving = GetOwner()->GetVelocity().SizeSquared() > 10.0f;
+        TickAuthority(DeltaTime);
+    }
+    else
+    {
+        TickExtrapolate();
+    }
+}
 
-        //   Ȯ
-        bool bIsFalling = false;
-        if (ACharacter* OwnerChar = Cast<ACharacter>(GetOwner()))
+void UStaminaComponent::TickAuthority(float DeltaTime)
+{
+    float OldStamina = CurrentStamina;
+    bool bActuallyMoving = GetOwner()->GetVelocity().SizeSquared() > 10.0f;
+
+    //   Ȯ
+    bool bIsFalling = false;
+    if (ACharacter* OwnerChar = Cast<ACharacter>(GetOwner()))
+    {
+        if (UCharacterMovementComponent* MoveComp = OwnerChar->GetCharacterMovement())
         {
-            if (UCharacterMovementComponent* MoveComp = OwnerChar->GetCharacterMovement())
-            {
-                bIsFalling = MoveComp->IsFalling();
-            }
+            bIsFalling = MoveComp->IsFalling();
         }
+    }
 
-        // [] ߿ bIsSprinting false ϴ  .
-        //  Ʒ ǹ (!bIsFalling) üũϿ ߿ ¹̳  ʰԸ óմϴ.
+    // [] ߿ bIsSprinting false ϴ  .
+    //  Ʒ ǹ (!bIsFalling) üũϿ ߿ ¹̳  ʰԸ óմϴ.
 
-        // ޸ ̰ +  ̰  + ٴڿ   Ҹ
-        if (bIsSprinting && bActuallyMoving && !bIsFalling)
-        {
-            CurrentStamina -= StaminaDrainRate * DeltaTime;
-            if (CurrentStamina <= 0.0f)
-            {
-                CurrentStamina = 0.0f;
-                if (bIsSprinting)
-                {
-                    bIsSprinting = false;
-                    OnRep_IsSprinting();
-                }
-            }
-        }
-        else
-        {
-            // ¹̳ ȸ
-            // (̰ų, ְų, ȴ ̸ ȸ)
-            if (CurrentStamina < MaxStamina)
-            {
-                CurrentStamina += StaminaRegenRate * DeltaTime;
-                if (CurrentStamina > MaxStamina) CurrentStamina = MaxStamina;
-            }
-        }
+    // ޸ ̰ +  ̰  + ٴڿ   Ҹ
+    // (̰ų, ְų, ȴ ̸ ȸ)
+    float NewRate = 0.0f;
+    if (bIsSprinting && bActuallyMoving && !bIsFalling)
+    {
+        NewRate = -StaminaDrainRate;
+    }
+    else if (CurrentStamina < MaxStamina)
+    {
+        NewRate = StaminaRegenRate;
+    }
 
-        if (!FMath::IsNearlyEqual(OldStamina, CurrentStamina))
-        {
-            OnRep_CurrentStamina();
-        }
+    CurrentStamina = FMath::Clamp(CurrentStamina + NewRate * DeltaTime, 0.0f, MaxStamina);
+
+    if (CurrentStamina <= 0.0f && bIsSprinting)
+    {
+        bIsSprinting = false;
+        OnRep_IsSprinting();
+    }
+
+    // /   ȭ 0
+    if ((NewRate < 0.0f && CurrentStamina <= 0.0f) || (NewRate > 0.0f && CurrentStamina >= MaxStamina))
+    {
+        NewRate = 0.0f;
+    }
+
+    // ȭ ٲ     ( ƽ   )
+    if (NewRate != StaminaState.RatePerSecond)
+    {
+        CommitStaminaState(NewRate);
+    }
+
+    if (!FMath::IsNearlyEqual(OldStamina, CurrentStamina))
+    {
+        BroadcastStaminaChanged();
+    }
+}
+
+void UStaminaComponent::TickExtrapolate()
+{
+    const float OldStamina = CurrentStamina;
+    CurrentStamina = ExtrapolateStamina();
+
+    if (!FMath::IsNearlyEqual(OldStamina, CurrentStamina))
+    {
+        BroadcastStaminaChanged();
+    }
+
+    // ȭ      ¸   ƽ  (  ¿ ޸    ܻ)
+    const float Rate = StaminaState.RatePerSecond;
+    if ((Rate < 0.0f && CurrentStamina <= 0.0f) || (Rate > 0.0f && CurrentStamina >= MaxStamina))
+    {
+        SetComponentTickEnabled(false);
     }
 }
 
-void UStaminaComponent::OnRep_CurrentStamina()
+void UStaminaComponent::CommitStaminaState(float NewRate)
+{
+    StaminaState.Value = CurrentStamina;
+    StaminaState.RatePerSecond = NewRate;
+    StaminaState.ServerTimeSeconds = GetServerTimeSeconds();
+}
+
+float UStaminaComponent::ExtrapolateStamina() const
+{
+    const float Elapsed = FMath::Max(GetServerTimeSeconds() - StaminaState.ServerTimeSeconds, 0.0f);
+    return FMath::Clamp(StaminaState.Value + StaminaState.RatePerSecond * Elapsed, 0.0f, MaxStamina);
+}
+
+float UStaminaComponent::GetServerTimeSeconds() const
+{
+    const UWorld* World = GetWorld();
+    if (!World) return 0.0f;
+
+    const AGameStateBase* GS = World->GetGameState();
+    return GS ? (float)GS->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+void UStaminaComponent::OnRep_StaminaState()
+{
+    CurrentStamina = ExtrapolateStamina();
+    SetComponentTickEnabled(StaminaState.RatePerSecond != 0.0f);
+    BroadcastStaminaChanged();
+}
+
+void UStaminaComponent::BroadcastStaminaChanged()
 {
     OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
 }
@@ -11,6 +11,7 @@
 #include "EnhancedInputSubsystems.h"
 #include "BRAttackComponent.h"
 #include "BRPlayerController.h"
+#include "BRActorRegistrySubsystem.h"
 #include "Engine/OverlapResult.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Kismet/KismetMathLibrary.h"
@@ -61,6 +62,8 @@ void AUpperBodyPawn::BeginPlay()
 {
 	Super::BeginPlay();
 
+	UBRActorRegistrySubsystem::RegisterUpperBody(this);
+
 	if (FrontCameraBoom)
 	{
 		FrontCameraBoom->AddTickPrerequisiteActor(this);
@@ -103,6 +106,8 @@ void AUpperBodyPawn::BeginPlay()
 
 void AUpperBodyPawn::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	UBRActorRegistrySubsystem::UnregisterUpperBody(this);
+
 	Super::EndPlay(EndPlayReason);
 
 	// [크래시 방지] 물리/충돌 컴포넌트 정리
@@ -126,6 +131,7 @@ void AUpperBodyPawn::Tick(float DeltaTime)
 	if (!ParentBodyCharacter)
 	{
 		ParentBodyCharacter = Cast<APlayerCharacter>(GetAttachParentActor());
+		UBRActorRegistrySubsystem::NotifyUpperBodyAttached(this);
 
 		if (ParentBodyCharacter && Controller)
 		{
@@ -138,6 +144,12 @@ void AUpperBodyPawn::Tick(float DeltaTime)
 			Controller->SetControlRotation(NewRotation);
 			LastBodyYaw = CurrentBodyYaw;
 		}
+
+		// 부모를 찾았는데 조종자가 없으면(다른 클라이언트의 상체) 더 이상 할 일이 없음
+		if (ParentBodyCharacter && !Controller)
+		{
+			UpdateTickEnabled();
+		}
 	}
 
 	if (!ParentBodyCharacter || !Controller) return;
@@ -202,6 +214,29 @@ void AUpperBodyPawn::Tick(float DeltaTime)
 	}
 }
 
+void AUpperBodyPawn::PossessedBy(AController* NewController)
+{
+	Super::PossessedBy(NewController);
+	UpdateTickEnabled();
+}
+
+void AUpperBodyPawn::UnPossessed()
+{
+	Super::UnPossessed();
+	UpdateTickEnabled();
+}
+
+void AUpperBodyPawn::OnRep_Controller()
+{
+	Super::OnRep_Controller();
+	UpdateTickEnabled();
+}
+
+void AUpperBodyPawn::UpdateTickEnabled()
+{
+	SetActorTickEnabled(ParentBodyCharacter == nullptr || Controller != nullptr);
+}
+
 void AUpperBodyPawn::OnRep_PlayerState()
 {
 	Super::OnRep_PlayerState();
@@ -302,6 +337,7 @@ void AUpperBodyPawn::Interact(const FInputActionValue& Value)
 	{
 		ParentBodyCharacter = Cast<APlayerCharacter>(GetAttachParentActor());
 		if (!ParentBodyCharacter) return;
+		UBRActorRegistrySubsystem::NotifyUpperBodyAttached(this);
 	}
 
 	// 1. 탐색 시작점 설정 (카메라 위치 혹은 캐릭터 위치)
@@ -408,6 +444,7 @@ void AUpperBodyPawn::ServerUpdateAimRotation_Implementation(FRotator NewRotation
 		ParentBodyCharacter = Cast<APlayerCharacter>(GetAttachParentActor());
 		if (ParentBodyCharacter)
 		{
+			UBRActorRegistrySubsystem::NotifyUpperBodyAttached(this);
 			ParentBodyCharacter->SetUpperBodyRotation(NewRotation);
 			GEngine->AddOnScreenDebugMessage(503, 1.f, FColor::Cyan, TEXT("[Server] Recovered & Updated!"));
 		}
@@ -28,8 +28,9 @@ struct FArmorData : public FTableRowBase
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FName DisplayName;
 
+    // 적용할 메쉬. 소프트 참조이므로 테이블 로드만으로는 메모리에 올라오지 않음 (BRAssetStreamingSubsystem에서 비동기 로드)
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    USkeletalMesh* ArmorMesh; // 적용할 메쉬
+    TSoftObjectPtr<USkeletalMesh> ArmorMesh;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     EArmorSlot EquipSlot;
@@ -38,7 +39,7 @@ struct FArmorData : public FTableRowBase
     UTexture2D* Icon;
 
     FArmorData()
-        : ID(0), DisplayName(NAME_None), ArmorMesh(nullptr), EquipSlot(EArmorSlot::None), Icon(nullptr)
+        : ID(0), DisplayName(NAME_None), EquipSlot(EArmorSlot::None), Icon(nullptr)
     {
     }
 
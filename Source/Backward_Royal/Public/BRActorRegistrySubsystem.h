@@ -0,0 +1,86 @@
+// BRActorRegistrySubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BRActorRegistrySubsystem.generated.h"
+
+class ABaseCharacter;
+class APlayerCharacter;
+class AUpperBodyPawn;
+class ABaseWeapon;
+class APlayerStart;
+class ABRGameSession;
+class ULevel;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogActorRegistry, Log, All);
+
+/**
+ * 월드 액터 레지스트리
+ * 게임에서 자주 찾는 액터(캐릭터, 상체, 무기, 플레이어 스타트, 게임 세션)를
+ * BeginPlay/EndPlay 시점에 등록/해제해 두고, 레벨 전체를 훑는 TActorIterator / GetAllActorsOfClass 대신 사용합니다.
+ * - 목록 순회는 const 참조를 반환하므로 할당이 없습니다 (순회 중 등록/해제 금지).
+ * - 하체 → 상체 조회는 맵으로 O(1)입니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRActorRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/** 월드에서 레지스트리 가져오기 */
+	static UBRActorRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	// --- 등록/해제 (각 액터의 BeginPlay/EndPlay에서 호출) ---
+	static void RegisterCharacter(ABaseCharacter* Character);
+	static void UnregisterCharacter(ABaseCharacter* Character);
+	static void RegisterUpperBody(AUpperBodyPawn* UpperBody);
+	static void UnregisterUpperBody(AUpperBodyPawn* UpperBody);
+	static void RegisterWeapon(ABaseWeapon* Weapon);
+	static void UnregisterWeapon(ABaseWeapon* Weapon);
+	static void RegisterGameSession(ABRGameSession* GameSession);
+	static void UnregisterGameSession(ABRGameSession* GameSession);
+
+	/** 상체가 하체에 붙었을 때 호출 (ParentBodyCharacter 설정 직후) */
+	static void NotifyUpperBodyAttached(AUpperBodyPawn* UpperBody);
+
+	// --- 조회 ---
+	const TArray<TObjectPtr<ABaseCharacter>>& GetCharacters() const { return Characters; }
+	const TArray<TObjectPtr<AUpperBodyPawn>>& GetUpperBodies() const { return UpperBodies; }
+	const TArray<TObjectPtr<ABaseWeapon>>& GetWeapons() const { return Weapons; }
+	const TArray<TObjectPtr<APlayerStart>>& GetPlayerStarts() const { return PlayerStarts; }
+	ABRGameSession* GetGameSession() const { return GameSession; }
+
+	/** 하체에 붙어 있는 상체 (없으면 nullptr) */
+	AUpperBodyPawn* FindUpperBodyByParent(const APlayerCharacter* ParentBody) const;
+
+private:
+	void HandleLevelAddedToWorld(ULevel* InLevel, UWorld* InWorld);
+	void HandleLevelRemovedFromWorld(ULevel* InLevel, UWorld* InWorld);
+	void RegisterPlayerStartsInLevel(ULevel* InLevel);
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABaseCharacter>> Characters;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AUpperBodyPawn>> UpperBodies;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABaseWeapon>> Weapons;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<APlayerStart>> PlayerStarts;
+
+	UPROPERTY(Transient)
+	TObjectPtr<ABRGameSession> GameSession;
+
+	/** 하체 → 상체 */
+	TMap<const APlayerCharacter*, TObjectPtr<AUpperBodyPawn>> UpperBodyByParent;
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+};
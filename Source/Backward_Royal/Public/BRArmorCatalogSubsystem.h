@@ -0,0 +1,54 @@
+// BRArmorCatalogSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ArmorTypes.h"
+#include "BRArmorCatalogSubsystem.generated.h"
+
+class UDataTable;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogArmorCatalog, Log, All);
+
+/**
+ * 방어구 ID → FArmorData* 조회용 인덱스
+ * ID 규칙 (Slot + 1) * 100 + Index 를 그대로 이용해 슬롯별 평면 배열로 보관합니다.
+ * DataTable이 로드/갱신될 때마다 1회 재구성되며, 조회는 배열 인덱싱 한 번으로 끝납니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRArmorCatalogSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** GameInstance의 ConfigDataMap에서 사용하는 방어구 테이블 키 */
+	static const FString ArmorTableKey;
+
+	/** 테이블 전체를 다시 훑어 인덱스를 재구성 (UBRConfigService가 방어구 테이블 행을 반영할 때 호출) */
+	void RebuildIndex(UDataTable* InArmorTable);
+
+	/** ID에 해당하는 방어구 데이터. 없으면 nullptr (ID 0 = 장비 해제도 nullptr) */
+	const FArmorData* FindArmor(int32 ArmorID) const;
+
+	/** 현재 인덱싱된 방어구 테이블 */
+	UDataTable* GetArmorTable() const { return ArmorTable.Get(); }
+
+	/** 인덱싱된 모든 방어구 순회 (할당 없음) */
+	void ForEachArmor(TFunctionRef<void(const FArmorData&)> Visitor) const;
+
+	/** 인덱스에 등록된 방어구 개수 */
+	int32 GetNumIndexedArmors() const { return NumIndexed; }
+
+private:
+	/** 슬롯(Head~Feet)별 평면 배열. [Slot][ID % 100] */
+	TArray<const FArmorData*> SlotIndex[(int32)EArmorSlot::None];
+
+	TWeakObjectPtr<UDataTable> ArmorTable;
+
+	int32 NumIndexed = 0;
+
+	void ClearIndex();
+};
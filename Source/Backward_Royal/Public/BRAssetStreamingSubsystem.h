@@ -0,0 +1,84 @@
+// BRAssetStreamingSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "CustomizationInfo.h"
+#include "BRAssetStreamingSubsystem.generated.h"
+
+class AGameStateBase;
+class APlayerState;
+class USkeletalMesh;
+class UWorld;
+struct FStreamableHandle;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAssetStreaming, Log, All);
+
+/** 방어구 메시 비동기 로드 완료 콜백 (실패 시 nullptr) */
+DECLARE_DELEGATE_OneParam(FOnArmorMeshLoaded, USkeletalMesh*);
+
+/**
+ * 방어구 메시 스트리밍 관리자
+ * FArmorData::ArmorMesh(소프트 참조)를 필요할 때만 비동기로 올립니다.
+ * 로비에서는 모든 PlayerState의 복제된 커스터마이징 ID만 미리 로드(prefetch)하고,
+ * 나머지 방어구 메시는 메모리에 올리지 않습니다.
+ * 또 로비에서 시작 조건이 충족되면 고른 Stage 맵 패키지(+의존 에셋)를 미리 올려 두고,
+ * 진행률을 서버에 보고합니다. 게임 맵 Travel은 이미 메모리에 있는 패키지를 그대로 사용합니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRAssetStreamingSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * GameState의 모든 PlayerState 커스터마이징 ID를 모아 정확히 그 집합만 prefetch (집합에서 빠진 ID는 핸들 해제)
+	 * @param LeavingPlayer 나가는 중이라 아직 PlayerArray에 남아 있어도 집합에서 뺄 플레이어
+	 */
+	void PrefetchForPlayers(const AGameStateBase* GameState, const APlayerState* LeavingPlayer = nullptr);
+
+	/** 방어구 메시 요청. 이미 로드되어 있으면 즉시, 아니면 로드 완료 시 콜백 */
+	void RequestArmorMesh(int32 ArmorID, FOnArmorMeshLoaded OnLoaded);
+
+	/** 현재 로드되지 않은 방어구 메시들의 디스크 크기 합 (MB, 에셋 레지스트리 기준 근사치) */
+	float GetAvoidedArmorMeshMB(int32* OutNumAvoided = nullptr) const;
+
+	/** prefetch 상태 및 로드 회피량 로그 출력 */
+	void LogStreamingReport() const;
+
+	/** Stage 맵 선행 로드. 같은 맵이면 유지, 다른 맵이면 이전 핸들을 놓고 새로 요청 (PIE는 스킵) */
+	void PreloadStage(const FString& StagePackageName);
+
+	/** 선행 로드 핸들 해제 (Travel로 맵이 로드되면 월드가 패키지를 참조하므로 자동 해제) */
+	void ReleaseStagePreload();
+
+	/** 선행 로드 중이거나 완료된 Stage 패키지 이름 (없으면 빈 문자열) */
+	const FString& GetPreloadedStage() const { return PreloadedStagePackage; }
+
+	/** 0~1 진행률. 선행 로드 중이 아니면 0 */
+	float GetStagePreloadProgress() const;
+
+private:
+	/** ArmorID → prefetch 핸들 (로비 동안 유지) */
+	TMap<int32, TSharedPtr<FStreamableHandle>> PrefetchHandles;
+
+	void CollectArmorIDs(const FBRCustomizationData& Data, TSet<int32>& OutIDs) const;
+
+	void HandleStagePreloaded();
+	void HandlePostLoadMap(UWorld* LoadedWorld);
+	bool TickStagePreload(float DeltaTime);
+
+	/** 로컬 컨트롤러로 진행률 보고 (10% 단위 + 완료 시) */
+	void ReportStagePreloadProgress(bool bForce);
+
+	TSharedPtr<FStreamableHandle> StagePreloadHandle;
+	FString PreloadedStagePackage;
+	double StagePreloadStartTime = 0.0;
+	int32 LastReportedStagePercent = -1;
+	FTSTicker::FDelegateHandle StagePreloadTickerHandle;
+	FDelegateHandle PostLoadMapHandle;
+};
@@ -2,10 +2,59 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
 #include "BRAttackComponent.generated.h"
 
+struct FBRBalanceSnapshot;
+
 DECLARE_LOG_CATEGORY_EXTERN(LogAttackComp, Log, All);
 
+/**    */
+UENUM(BlueprintType)
+enum class EBRHitDetectionMode : uint8
+{
+	PhysicsContact	UMETA(DisplayName = "Physics Contact"),	// / 浹ü OnComponentHit ( )
+	SweptTrace		UMETA(DisplayName = "Swept Trace")		//   Ʈ ̸  
+};
+
+/**
+ *   ֵθ(  )  ̹ Ÿ  
+ * ζ ؽ ̶ 8  Ҵ  O(1) ȸ. ߺ  ź Ƚ Բ 
+ */
+struct FBRSwingHitSet
+{
+	/** ̹  ͸ ߺ ź īƮ ø true */
+	bool RejectDuplicate(const AActor* Actor)
+	{
+		if (Actors.Contains(FObjectKey(Actor)))
+		{
+			++NumDuplicatesRejected;
+			return true;
+		}
+		return false;
+	}
+
+	bool Contains(const AActor* Actor) const { return Actors.Contains(FObjectKey(Actor)); }
+	void Add(const AActor* Actor) { Actors.Add(FObjectKey(Actor)); }
+
+	/**   ȿ ̹ ó      */
+	void NoteDuplicate() { ++NumDuplicatesRejected; }
+
+	/**  ֵθ. ζ Ҵ  */
+	void Reset()
+	{
+		Actors.Reset();
+		NumDuplicatesRejected = 0;
+	}
+
+	int32 Num() const { return Actors.Num(); }
+	int32 GetNumDuplicatesRejected() const { return NumDuplicatesRejected; }
+
+private:
+	TSet<FObjectKey, DefaultKeyFuncs<FObjectKey>, TInlineSetAllocator<8>> Actors;
+	int32 NumDuplicatesRejected = 0;
+};
+
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class BACKWARD_ROYAL_API UBRAttackComponent : public UActorComponent
 {
@@ -14,10 +63,10 @@ class BACKWARD_ROYAL_API UBRAttackComponent : public UActorComponent
 public:
 	UBRAttackComponent();
 
-	static float Global_BasePunchDamage;
-
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	// Ʈ ο  浹 ó Լ
 	UFUNCTION()
@@ -41,27 +90,95 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	float GetCalculatedAttackSpeed() const;
 
+	/**  ֵθ⿡ źε ߺ   (̹  Ϳ  ݹ/ ) */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Stats")
+	int32 GetDuplicateContactsRejected() const { return HitActors.GetNumDuplicatesRejected(); }
+
+	/**   ֵθ⿡ źε ߺ   */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Stats")
+	int32 GetLastSwingDuplicateContactsRejected() const { return LastSwingDuplicatesRejected; }
+
+	/**  ߺ  ź  / ֵθ  */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Stats")
+	int32 GetTotalDuplicateContactsRejected() const { return TotalDuplicatesRejected; }
+
+	UFUNCTION(BlueprintCallable, Category = "Combat|Stats")
+	int32 GetTotalSwings() const { return TotalSwings; }
+
+	/**  Ÿ ó  ( ˡ ) */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Stats")
+	int32 GetTotalHits() const { return TotalHits; }
+
 	/**  ӵ   (C#    ʴ  ġ) */
 	UPROPERTY(EditAnywhere, Category = "Combat|Settings")
 	float StandardMass = 10.0f;
 
+	/**  . SweptTrace 浹  ٲ ʰ      ƽ   */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Detection")
+	EBRHitDetectionMode HitDetectionMode = EBRHitDetectionMode::PhysicsContact;
+
+	/** [SweptTrace] Ǽ     */
+	UPROPERTY(EditAnywhere, Category = "Combat|Detection")
+	TArray<FName> PunchSweepBones;
+
+	/** [SweptTrace] Ǽ    */
+	UPROPERTY(EditAnywhere, Category = "Combat|Detection", meta = (ClampMin = "1.0"))
+	float PunchSweepRadius = 12.0f;
+
+	/** [SweptTrace]  ƽ ̵  ִ 꽺  ( 꽺   ) */
+	UPROPERTY(EditAnywhere, Category = "Combat|Detection", meta = (ClampMin = "1", ClampMax = "16"))
+	int32 MaxSweepSubsteps = 4;
+
+	/** [SweptTrace] ݷ   (kg). ݷ =  ӵ *  . StandardMass( ӵ )  */
+	UPROPERTY(EditAnywhere, Category = "Combat|Detection", meta = (ClampMin = "0.0"))
+	float SweepImpactMass = 10.0f;
+
+	/** ݷ .   ֹ ݷ, SweptTrace  ӵ * SweepImpactMass   */
+	UPROPERTY(EditAnywhere, Category = "Combat|Detection")
+	float MaxImpactForce = 5000.0f;
+
 	// Ʈ ž()  Լ
 	void ApplyHitStop(float Duration);
 
-	//   Ŭ̾Ʈ Ʈ ž  
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastApplyHitStop(float Duration);
-	
-	// [ű] Ƽ÷̾ Ÿ  Լ
-	UFUNCTION(NetMulticast, Unreliable)
-	void MulticastPlayHitSound(USoundBase* SoundToPlay, FVector Location, float Volume);
+	/**    Ʈ ž  (). Ÿ ̺Ʈ   ӽſ  */
+	UPROPERTY(EditAnywhere, Category = "Combat|Settings")
+	float HitStopDuration = 0.1f;
 
 
 private:
 	bool bIsDetectionActive = false;
 
-	UPROPERTY()
-	TArray<AActor*> HitActors;
+	/** [SweptTrace]   ( ޽ Ǵ  )  Ʈ */
+	struct FSweepSource
+	{
+		FName BoneName;				// NAME_None =  ޽
+		FTransform PrevTransform;
+	};
+	TArray<FSweepSource, TInlineAllocator<2>> SweepSources;
+
+	/** [SweptTrace]       (  Ⱑ ٲ  缳) */
+	bool bSweepWithWeapon = false;
+
+	void BeginSweepWindow();
+	void EndSweepWindow();
+	void RunSweeps(float DeltaTime);
+	bool GetSweepSourceTransform(const FSweepSource& Source, FTransform& OutTransform) const;
+
+	/** ݷ/  Ÿ 1 ó ( ˡ ) */
+	void ApplyHit(AActor* OtherActor, UPrimitiveComponent* OtherComp, float ImpactForce, const FVector& ImpulseDir, const FHitResult& Hit);
+
+	/** ̹ ֵθ⿡ ̹ Ÿ  (FObjectKey ̶ GC  ʿ) */
+	FBRSwingHitSet HitActors;
+
+	int32 LastSwingDuplicatesRejected = 0;
+	int32 TotalDuplicatesRejected = 0;
+	int32 TotalSwings = 0;
+	int32 TotalHits = 0;
+
+	/** ֵθ /.   ߺ ź 踦    ʱȭ */
+	void BeginSwing();
+	void EndSwing();
+	bool bSwingOpen = false;
 
 	// Ʈ ž Ÿ̸ ڵ
 	FTimerHandle HitStopTimerHandle;
@@ -69,5 +186,13 @@ private:
 	// Ʈ ž   ִϸ̼  Լ
 	void ResetHitStop();
 
+	/** 뷱    ( Serial ٲ  ) */
+	void HandleBalanceChanged(const FBRBalanceSnapshot& Snapshot);
+	uint32 CachedBalanceSerial = MAX_uint32;
+	float CachedDamageMultiplier = 1.0f;
+	float CachedImpulseMultiplier = 1.0f;
+	float CachedAttackSpeedMultiplier = 1.0f;
+	float CachedBasePunchDamage = 10.0f;
+
 #define ATK_LOG(Verbosity, Format, ...) UE_LOG(LogAttackComp, Verbosity, TEXT("%s: ") Format, *GetOwner()->GetName(), ##__VA_ARGS__)
 };
\ No newline at end of file
@@ -0,0 +1,24 @@
+// BRBalanceSnapshotCommandlet.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BRBalanceSnapshotCommandlet.generated.h"
+
+/**
+ * Data/*.json → Data/BalanceSnapshot.bin 컴파일
+ * 게임 인스턴스의 ConfigDataMap 테이블에 JSON을 적용한 결과를 바이너리 스냅샷으로 저장합니다.
+ * 스냅샷에는 JSON 파일별 해시, 행 구조 해시, JSON 적용 전 에셋 내용 해시가 들어가므로, 런타임은 하나라도 다르면 JSON을 읽습니다.
+ *
+ * 사용: UnrealEditor-Cmd Backward_Royal.uproject -run=BRBalanceSnapshot [-GameInstance=/Game/.../BP_GI.BP_GI_C]
+ */
+UCLASS()
+class UBRBalanceSnapshotCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBRBalanceSnapshotCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
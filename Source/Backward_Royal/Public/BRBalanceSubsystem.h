@@ -0,0 +1,71 @@
+// BRBalanceSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GlobalBalanceData.h"
+#include "BRBalanceSubsystem.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogBalance, Log, All);
+
+/** 불변 밸런스 스냅샷. 서버가 발행할 때마다 Version이 1씩 증가하고 GameState로 한 번 복제됨 */
+USTRUCT()
+struct FBRBalanceSnapshot
+{
+	GENERATED_BODY()
+
+	/** 서버 발행 버전 */
+	UPROPERTY()
+	int32 Version = 0;
+
+	/** 이 머신에서 스냅샷이 교체될 때마다 증가 (컴포넌트 캐시 키). 클라이언트 로컬 발행과 서버 버전이 겹쳐도 구분됨 */
+	UPROPERTY(NotReplicated)
+	uint32 Serial = 0;
+
+	UPROPERTY()
+	FGlobalBalanceData Data;
+};
+
+using FBRBalanceSnapshotRef = TSharedRef<const FBRBalanceSnapshot, ESPMode::ThreadSafe>;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBalanceChanged, const FBRBalanceSnapshot& /*Snapshot*/);
+
+/**
+ * 전역 밸런스 값 (GlobalSettings 테이블 "Default" 행) 보관소
+ * - 발행된 스냅샷은 수정하지 않고, 새 스냅샷으로 포인터만 교체합니다 (읽는 쪽은 참조를 잡고 있으면 안전).
+ * - 서버(또는 스탠드얼론)만 발행하고, 클라이언트는 ABRGameState로 복제된 서버 스냅샷을 그대로 채택합니다.
+ * - 값을 쓰는 컴포넌트는 OnBalanceChanged에서 Version이 바뀐 경우에만 파생 값을 다시 계산합니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRBalanceSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** 게임 인스턴스에서 가져오기 (월드/GI가 없으면 nullptr) */
+	static UBRBalanceSubsystem* Get(const UObject* WorldContextObject);
+
+	/** 현재 스냅샷 (서브시스템이 없으면 기본값 스냅샷, Version 0) */
+	static FBRBalanceSnapshotRef GetSnapshot(const UObject* WorldContextObject);
+	FBRBalanceSnapshotRef GetSnapshot() const;
+
+	/** [서버/스탠드얼론] 테이블 값으로 새 버전 발행 */
+	void Publish(const FGlobalBalanceData& Data);
+
+	/** [클라이언트] 복제받은 서버 스냅샷 채택 (버전 그대로) */
+	void AdoptReplicated(const FBRBalanceSnapshot& Snapshot);
+
+	/** 스냅샷이 바뀐 뒤 게임 스레드에서 호출 */
+	FOnBalanceChanged OnBalanceChanged;
+
+private:
+	/** 새 스냅샷에 Serial을 부여하고 포인터 교체 후 브로드캐스트 (발행 이후에는 수정하지 않음) */
+	void Swap(TSharedRef<FBRBalanceSnapshot, ESPMode::ThreadSafe> NewSnapshot);
+
+	uint32 NextSerial = 1;
+
+	mutable FRWLock SnapshotLock;
+	TSharedPtr<const FBRBalanceSnapshot, ESPMode::ThreadSafe> Current;
+};
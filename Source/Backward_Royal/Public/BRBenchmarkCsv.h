@@ -0,0 +1,17 @@
+// BRBenchmarkCsv.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 벤치마크/부하 테스트 결과 기록용 공용 헬퍼
+ * UBRCombatBenchmarkSubsystem, UBRLoadTestBotSubsystem이 같은 통계·CSV 형식을 쓰도록 한 곳에 둡니다.
+ */
+namespace BRBenchmarkCsv
+{
+	/** 정렬된 샘플의 백분위 (최근접 순위 방식). 샘플이 없으면 0 */
+	BACKWARD_ROYAL_API float Percentile(const TArray<float>& Sorted, float Fraction);
+
+	/** CSV에 한 줄 추가. 파일이 없으면 Header 줄을 먼저 씀. 실패 시 false */
+	BACKWARD_ROYAL_API bool AppendRow(const FString& FilePath, const TCHAR* Header, const FString& Row);
+}
@@ -52,5 +52,13 @@ public:
 	/** [부하 테스트] 서버 상태 요약 출력 (연결 인원, 맵, stat 명령 안내). 서버/호스트 콘솔에서 StatServer */
 	UFUNCTION(Exec, Category = "Session")
 	void StatServer();
+
+	/** [메모리] 방어구 메시 prefetch 개수와 로드 회피량(MB) 출력. 콘솔: StatArmorStreaming */
+	UFUNCTION(Exec, Category = "Memory")
+	void StatArmorStreaming();
+
+	/** [성능] 전투 처리량 벤치마크 (스탠드얼론/호스트). 결과는 Saved/Benchmarks/CombatBench.csv. 콘솔: BenchCombat 8 30 */
+	UFUNCTION(Exec, Category = "Performance")
+	void BenchCombat(int32 NumPairs = 8, float Seconds = 30.0f);
 };
 
@@ -0,0 +1,152 @@
+// BRCombatBenchmarkSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BRCombatBenchmarkSubsystem.generated.h"
+
+class ABaseCharacter;
+class ABaseWeapon;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogCombatBench, Log, All);
+
+/** 전투 벤치마크 실행 설정 */
+struct FBRCombatBenchmarkSettings
+{
+	/** 마주 보고 교대로 공격하는 캐릭터 쌍 수 */
+	int32 NumPairs = 8;
+
+	/** 측정 시간 (초, 워밍업 제외) */
+	float DurationSeconds = 30.0f;
+
+	/** 스폰 직후 히치를 빼기 위해 측정 전 대기하는 시간 (초) */
+	float WarmupSeconds = 2.0f;
+
+	/** 공격 명령 주기 (초). 쌍마다 매 주기 공격자가 번갈아 바뀜 */
+	float AttackInterval = 0.5f;
+
+	/** 쌍 사이 간격 / 쌍 내부 두 캐릭터 거리 (cm) */
+	float PairSpacing = 600.0f;
+	float FacingDistance = 120.0f;
+
+	/** 비어 있으면 게임 모드의 DefaultPawnClass (ABaseCharacter 계열일 때), 그것도 아니면 ABaseCharacter */
+	TSubclassOf<ABaseCharacter> CharacterClass;
+
+	/** 비어 있으면 ABaseWeapon (메시/스탯은 WeaponData 행에서 로드) */
+	TSubclassOf<ABaseWeapon> WeaponClass;
+
+	/** 결과 기록 후 프로세스 종료 (CI / -nullrhi 실행용) */
+	bool bQuitWhenDone = false;
+};
+
+/**
+ * 헤드리스 전투 처리량 벤치마크
+ * ABaseCharacter 쌍을 스폰해 WeaponData 테이블의 무기를 행 순서대로 쥐여 주고,
+ * ASoloTesterCharacter::ForceAttack처럼 RequestAttack을 번갈아 호출합니다.
+ * 측정 구간의 타격 수(초당), 프레임 시간 백분위, 서버가 보낸 공격/무기 파손 멀티캐스트 수, 타격당 송신 바이트, 파편 스폰 수를
+ * Saved/Benchmarks/CombatBench.csv에 한 줄씩 누적 기록합니다.
+ *
+ * 명령줄: -BRCombatBench=<쌍 수> [-BRCombatBenchSeconds=30] [-BRCombatBenchClass=/Game/...BP_X.BP_X_C] [-BRCombatBenchQuit]
+ * 콘솔: BenchCombat <쌍 수> <초> (UBRCheatManager)
+ * 서버 프레임 측정이 목적이므로 전용 서버(-server -nullrhi)로 실행하는 것을 권장합니다.
+ * (전용 서버에는 파편 풀이 없으므로 Fractures* 열은 비워 두고, 파손 연출은 WeaponBreakMulticasts 송신 수로 봅니다)
+ * (스탠드얼론에서는 중요도 관리자가 화면 밖 캐릭터의 포즈 갱신을 줄여 수치가 달라질 수 있음)
+ * 캐릭터가 죽지 않도록 매 공격 주기마다 HP를 채우고, 무기가 부서지면 같은 행의 무기를 다시 쥐여 줍니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRCombatBenchmarkSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	static UBRCombatBenchmarkSubsystem* Get(const UObject* WorldContextObject);
+
+	/** 벤치마크 시작 (서버/스탠드얼론 전용). 이미 실행 중이거나 캐릭터 스폰에 실패하면 false */
+	bool StartBenchmark(const FBRCombatBenchmarkSettings& InSettings);
+
+	/** 진행 중인 벤치마크를 즉시 끝내고 지금까지의 결과를 기록 */
+	void StopBenchmark();
+
+	bool IsRunning() const { return bRunning; }
+
+	/** 결과 CSV 경로 (실행마다 한 줄 추가) */
+	static FString GetResultFilePath();
+
+	/**
+	 * [서버] 송신 지점에서 호출: 공격 연출 멀티캐스트 (MulticastPlayWeaponAttack / MulticastPlayPunch)
+	 * 호출부는 #if !UE_BUILD_SHIPPING으로 감싸 Shipping 빌드의 게임플레이 코드에는 남지 않게 합니다.
+	 */
+	static void CountAttackMulticast(const UObject* WorldContextObject);
+
+	/** [서버] 송신 지점에서 호출: 무기 파손 멀티캐스트 (MulticastHandleWeaponBroken / Multicast_BreakWeaponVisual) */
+	static void CountWeaponBreakMulticast(const UObject* WorldContextObject);
+
+private:
+	/** 측정 구간 시작 시점의 누적 카운터 (종료 시 차이로 계산) */
+	struct FCounterSnapshot
+	{
+		double Time = 0.0;
+		int64 Hits = 0;
+		int64 Swings = 0;
+		int64 CombatEvents = 0;
+		int64 CombatEventFlushes = 0;
+		int64 AttackMulticasts = 0;
+		int64 WeaponBreakMulticasts = 0;
+		int64 NetOutBytes = 0;
+		int64 NetOutPackets = 0;
+		int64 FracturesSpawned = 0;
+		int64 FracturesReused = 0;
+		int64 FracturesRecycled = 0;
+		bool bHasFracturePool = false;
+	};
+
+	struct FBenchPair
+	{
+		TWeakObjectPtr<ABaseCharacter> A;
+		TWeakObjectPtr<ABaseCharacter> B;
+		FName WeaponRow;
+	};
+
+	bool SpawnPairs();
+	ABaseCharacter* SpawnCombatant(UClass* Class, const FVector& Location, const FRotator& Rotation) const;
+	void ArmCombatant(ABaseCharacter* Character, FName WeaponRow);
+
+	void DriveAttacks();
+	void BeginMeasure();
+	void FinishBenchmark();
+
+	void HandlePostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	FCounterSnapshot CaptureCounters() const;
+	void WriteResult(const FCounterSnapshot& Begin, const FCounterSnapshot& End) const;
+	void CleanupActors();
+
+	FBRCombatBenchmarkSettings Settings;
+
+	TArray<FBenchPair> Pairs;
+
+	/** 벤치마크가 스폰한 무기 (부서진 무기는 이미 파괴되어 있을 수 있음) */
+	TArray<TWeakObjectPtr<ABaseWeapon>> SpawnedWeapons;
+
+	/** 측정 구간 프레임별 샘플 (ms) */
+	TArray<float> FrameTimesMs;
+	TArray<float> GameThreadTimesMs;
+
+	FCounterSnapshot MeasureBegin;
+
+	/** 이 월드에서 서버가 보낸 멀티캐스트 누적 수 (벤치마크 실행 여부와 무관하게 셈) */
+	int64 NumAttackMulticasts = 0;
+	int64 NumWeaponBreakMulticasts = 0;
+
+	int32 AttackTick = 0;
+	bool bRunning = false;
+	bool bMeasuring = false;
+
+	FTimerHandle AttackTimerHandle;
+	FTimerHandle PhaseTimerHandle;
+	FDelegateHandle PostActorTickHandle;
+};
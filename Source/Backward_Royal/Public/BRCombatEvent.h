@@ -0,0 +1,56 @@
+// BRCombatEvent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "BRCombatEvent.generated.h"
+
+class USoundBase;
+
+/**
+ * 타격 1건의 연출 정보 (타격음 + 히트 스탑 + 피격 리액션)
+ * 서버에서 큐에 쌓았다가 프레임당 1회 Unreliable 멀티캐스트로 묶어 전송합니다.
+ * 위치/충격량은 정수 양자화, 본은 인덱스, 히트 스탑은 10ms 단위로 줄여 보냅니다.
+ */
+USTRUCT()
+struct BACKWARD_ROYAL_API FBRCombatEvent
+{
+	GENERATED_BODY()
+
+	/** 공격자 (히트 스탑 대상) */
+	UPROPERTY()
+	TObjectPtr<AActor> Attacker = nullptr;
+
+	/** 피격자 (ABaseCharacter면 피지컬 리액션 적용) */
+	UPROPERTY()
+	TObjectPtr<AActor> Victim = nullptr;
+
+	UPROPERTY()
+	FVector_NetQuantize HitLocation = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantize Impulse = FVector::ZeroVector;
+
+	/** 피격자 메시의 본 인덱스. INDEX_NONE이면 클라이언트에서 HitLocation 기준 가장 가까운 본 사용 */
+	UPROPERTY()
+	int16 BoneIndex = INDEX_NONE;
+
+	/** 재생할 타격음 (없으면 무음). 복제 시 NetGUID로 전송 */
+	UPROPERTY()
+	TObjectPtr<USoundBase> Sound = nullptr;
+
+	/** 히트 스탑 길이 (10ms 단위, 0 = 없음) */
+	UPROPERTY()
+	uint8 HitStopCentiseconds = 0;
+
+	void SetHitStopDuration(float Seconds) { HitStopCentiseconds = (uint8)FMath::Clamp(FMath::RoundToInt(Seconds * 100.0f), 0, 255); }
+	float GetHitStopDuration() const { return HitStopCentiseconds * 0.01f; }
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FBRCombatEvent> : public TStructOpsTypeTraitsBase2<FBRCombatEvent>
+{
+	enum { WithNetSerializer = true };
+};
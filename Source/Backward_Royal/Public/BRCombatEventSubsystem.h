@@ -0,0 +1,49 @@
+// BRCombatEventSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BRCombatEvent.h"
+#include "BRCombatEventSubsystem.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogCombatEvent, Log, All);
+
+/**
+ * 타격 연출 이벤트 큐
+ * [서버] QueueEvent로 쌓은 이벤트를 액터 틱이 끝난 뒤(같은 프레임의 네트워크 전송 직전) 한 번에
+ *        ABRGameState::MulticastCombatEvents로 보냅니다. 타격마다 멀티캐스트 3개를 쏘던 방식을 대체합니다.
+ * [모든 머신] PlayEvent로 타격음 / 히트 스탑 / 피지컬 리액션을 재생합니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRCombatEventSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** [서버 전용] 이벤트 추가. 이번 프레임 끝에 묶어서 전송 */
+	void QueueEvent(const FBRCombatEvent& Event);
+
+	/** 이벤트 1건 연출 재생 (멀티캐스트 수신 측) */
+	static void PlayEvent(const UObject* WorldContextObject, const FBRCombatEvent& Event);
+
+	/** 한 번의 멀티캐스트에 담을 최대 이벤트 수 (초과분은 다음 프레임) */
+	static constexpr int32 MaxEventsPerFlush = 32;
+
+	/** 누적 통계 (서버) */
+	int32 GetNumEventsSent() const { return NumEventsSent; }
+	int32 GetNumFlushes() const { return NumFlushes; }
+
+private:
+	void HandlePostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+	void Flush();
+
+	TArray<FBRCombatEvent> PendingEvents;
+
+	FDelegateHandle PostActorTickHandle;
+
+	int32 NumEventsSent = 0;
+	int32 NumFlushes = 0;
+};
@@ -0,0 +1,139 @@
+// BRConfigService.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "BRConfigService.generated.h"
+
+class UDataTable;
+struct FBRConfigParseJob;
+struct FBRConfigParseResult;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogConfigService, Log, All);
+
+/** 비동기 재로드 결과가 DataTable에 반영된 뒤 호출 (실제로 행이 바뀐 ConfigDataMap 키 목록) */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnConfigCommitted, const TArray<FString>& /*ChangedKeys*/);
+
+/** JSON 파일별 마지막 반영 상태 */
+struct FBRConfigFileState
+{
+	/** 감시용 파일 수정 시각 */
+	FDateTime Timestamp;
+
+	/** 마지막으로 반영한 파일 내용 해시 (같으면 파싱 생략) */
+	uint64 ContentHash = 0;
+
+	/** 행별로 마지막에 반영한 하드 오브젝트 참조 문자열 (게임 스레드에서만 해석 가능하므로 별도 비교) */
+	TMap<FName, FString> ObjectTexts;
+};
+
+/** 스냅샷에 넣을 테이블 1개 (커맨드렛에서 구성) */
+struct FBRSnapshotTableSource
+{
+	/** JSON을 적용한 테이블 */
+	UDataTable* Table = nullptr;
+
+	/** JSON 적용 전 에셋 행 해시. 런타임 에셋이 이와 다르면(스냅샷 이후 에셋 수정) 스냅샷 무효 */
+	uint64 AssetHash = 0;
+
+	/** JSON이 지정한 행별 하드 오브젝트 참조 문자열 (재로드 시 변경 비교 기준) */
+	TMap<FName, FString> ObjectTexts;
+};
+
+/**
+ * Data/*.json → DataTable 설정 파이프라인
+ * - 파일 읽기, JSON 파싱, 행 구조체 변환은 워커 스레드에서 수행해 행 단위로 스테이징합니다.
+ * - 기존 행과 비교해 실제로 바뀐 행만 게임 스레드에서 한 번에 복사(커밋)합니다.
+ * - Data 폴더의 파일 수정 시각을 주기적으로 확인해 바뀐 파일만 자동 재로드합니다.
+ * 하드 오브젝트 참조 필드(사운드, 아이콘 등)는 로드가 필요하므로 문자열로 보관했다가 커밋 시점에 해석합니다.
+ * 부팅 시에는 UBRBalanceSnapshotCommandlet이 만든 바이너리 스냅샷(Data/BalanceSnapshot.bin)을 먼저 시도하고,
+ * JSON 파일 해시나 테이블 에셋 내용 해시가 스냅샷과 다를 때만 JSON을 파싱합니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRConfigService : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** 설정 JSON 폴더 (프로젝트/Data/). 초기화 시 1회 계산 */
+	const FString& GetConfigDirectory() const { return ConfigDirectory; }
+	static FString GetDefaultConfigDirectory();
+
+	/** 마지막 LoadAllBlocking이 사용한 경로 ("snapshot" / "json") */
+	const FString& GetLastLoadSource() const { return LastLoadSource; }
+
+	/** ConfigDataMap 전체를 현재 스레드에서 즉시 로드 (부팅용). 행이 바뀐 키 목록 반환 */
+	TArray<FString> LoadAllBlocking();
+
+	/** 테이블 하나를 즉시 로드 */
+	void LoadTableBlocking(const FString& Key, UDataTable* Table);
+
+	/** 워커 스레드 재로드 요청. bForce면 파일 해시가 같아도 다시 파싱 */
+	void RequestReload(bool bForce);
+
+	/** 재로드 진행 중 여부 */
+	bool IsReloadInFlight() const { return bReloadInFlight; }
+
+	/** 비동기 커밋 완료 이벤트 */
+	FOnConfigCommitted OnConfigCommitted;
+
+	/** 파일 수정 시각 확인 주기 (초) */
+	static constexpr float WatchIntervalSeconds = 1.0f;
+
+	// --- 바이너리 스냅샷 ---
+	static constexpr const TCHAR* SnapshotFileName = TEXT("BalanceSnapshot.bin");
+	static constexpr uint32 SnapshotMagic = 0x53425242; // "BRBS"
+	static constexpr int32 SnapshotVersion = 2;
+
+	/** JSON 파일 내용 해시 (스냅샷 검증과 재로드 생략 판단에 공통 사용). 파일이 없으면 0 */
+	static uint64 HashConfigBytes(TConstArrayView<uint8> Bytes);
+	static uint64 HashConfigFile(const FString& FilePath);
+
+	/** 행 구조체 레이아웃 해시 (필드가 바뀌면 스냅샷 무효) */
+	static uint64 HashRowStruct(const UScriptStruct* RowStruct);
+
+	/** 테이블 행 내용 해시 (행 이름 + 직렬화된 행. 메시·사운드 등 JSON에 없는 필드 포함) */
+	static uint64 HashTableRows(const UDataTable* Table);
+
+	/** JSON 파일을 현재 스레드에서 테이블에 바로 반영 (상태 기록 없음, 커맨드렛용). OutObjectTexts: 행별 오브젝트 참조 문자열 */
+	static bool ApplyJsonFileToTable(const FString& FilePath, UDataTable* Table, TMap<FName, FString>* OutObjectTexts = nullptr);
+
+	/** 테이블들을 스냅샷 파일로 저장 (JSON 파일 해시, 행 구조 해시, 에셋 내용 해시 포함) */
+	static bool WriteSnapshot(const FString& SnapshotPath, const FString& InConfigDirectory, const TMap<FString, FBRSnapshotTableSource>& Tables);
+
+private:
+	/** 게임 스레드: ConfigDataMap 항목으로 파싱 작업 생성 (현재 행 복사본 포함) */
+	bool BuildJob(const FString& Key, UDataTable* Table, bool bForce, FBRConfigParseJob& OutJob) const;
+
+	/** 게임 스레드: 스테이징된 행을 DataTable에 반영. 행이 바뀐 키 목록 반환 */
+	TArray<FString> CommitResults(TArray<FBRConfigParseResult>& Results);
+
+	void LaunchReload(const TArray<FString>& Keys, bool bForce);
+
+	/** 스냅샷이 모든 테이블에 대해 유효하면 적재하고 true (OutLoadedKeys: 행이 실제로 바뀐 키). 하나라도 다르면 아무것도 건드리지 않고 false */
+	bool TryLoadSnapshot(const TMap<FString, UDataTable*>& ConfigDataMap, TArray<FString>& OutLoadedKeys);
+
+	bool HandleWatchTick(float DeltaTime);
+
+	FString GetConfigFilePath(const FString& Key) const;
+
+	TMap<FString, UDataTable*> GetConfigDataMap() const;
+
+	FString ConfigDirectory;
+
+	FString LastLoadSource;
+
+	TMap<FString, FBRConfigFileState> FileStates;
+
+	FTSTicker::FDelegateHandle WatchTickerHandle;
+
+	bool bReloadInFlight = false;
+
+	/** 진행 중에 들어온 요청 (완료 후 1회 재실행) */
+	bool bReloadQueued = false;
+	bool bQueuedForce = false;
+};
@@ -0,0 +1,108 @@
+// BRFracturePoolSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BRFracturePoolSubsystem.generated.h"
+
+class AGeometryCollectionActor;
+class UGeometryCollection;
+struct FStreamableHandle;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogFracturePool, Log, All);
+
+/** 파편 에셋 하나에 대한 대기 액터 목록 */
+USTRUCT()
+struct FBRFracturePoolBucket
+{
+	GENERATED_BODY()
+
+	/** 숨겨진 채 재사용을 기다리는 액터 */
+	UPROPERTY()
+	TArray<TObjectPtr<AGeometryCollectionActor>> Free;
+};
+
+/** 현재 시뮬레이션 중인 파편 1건 (오래된 순) */
+USTRUCT()
+struct FBRActiveFracture
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<AGeometryCollectionActor> Actor = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UGeometryCollection> Asset = nullptr;
+
+	double StartTime = 0.0;
+};
+
+/**
+ * 무기 파괴 파편(GeometryCollection) 액터 풀
+ * 무기가 부서질 때마다 AGeometryCollectionActor를 새로 스폰하지 않고, 에셋별로 미리 만들어 둔 액터를
+ * 상태만 초기화해서 재사용합니다. 동시에 시뮬레이션되는 파편 수는 MaxActiveFractures로 제한하며,
+ * 넘치면 가장 오래된 파편부터 회수합니다.
+ * 맵 시작 시 WeaponData 테이블의 FracturedMesh마다 PrewarmPerAsset개씩 미리 생성합니다.
+ * 연출 전용이므로 전용 서버에는 생성되지 않습니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRFracturePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** 월드에서 풀 가져오기 (전용 서버 등 없으면 nullptr) */
+	static UBRFracturePoolSubsystem* Get(const UObject* WorldContextObject);
+
+	/** 파편 재생. 풀에서 액터를 꺼내(없으면 스폰) 위치를 옮기고 즉시 부숴 흩뿌림 */
+	void PlayFracture(UGeometryCollection* Asset, const FTransform& SpawnTransform, AActor* DamageCauser);
+
+	/** 에셋별 미리 생성할 액터 수 */
+	static constexpr int32 PrewarmPerAsset = 2;
+
+	/** 동시에 시뮬레이션할 최대 파편 수 (초과 시 오래된 것부터 회수) */
+	static constexpr int32 MaxActiveFractures = 12;
+
+	/** 파편 유지 시간 (초) */
+	static constexpr float FractureLifetime = 10.0f;
+
+	/** 누적 통계 */
+	int32 GetNumSpawned() const { return NumSpawned; }
+	int32 GetNumReused() const { return NumReused; }
+	int32 GetNumRecycled() const { return NumRecycled; }
+	int32 GetNumActive() const { return ActiveFractures.Num(); }
+
+private:
+	/** WeaponData 테이블의 파편 에셋을 비동기 로드한 뒤 액터 미리 생성 */
+	void PrewarmFromWeaponTable();
+	void HandlePrewarmAssetsLoaded(TArray<FSoftObjectPath> AssetPaths);
+
+	/** 새 액터 생성 (숨김/비활성 상태) */
+	AGeometryCollectionActor* SpawnPooledActor(UGeometryCollection* Asset);
+
+	/** 시뮬레이션 중단 후 숨기고 대기 목록으로 반환 */
+	void ReleaseToPool(AGeometryCollectionActor* Actor, UGeometryCollection* Asset);
+
+	/** 수명이 다한 파편 회수 후 다음 만료 시점으로 타이머 재설정 */
+	void ExpireFractures();
+	void ScheduleNextExpiry();
+
+	UPROPERTY()
+	TMap<TObjectPtr<UGeometryCollection>, FBRFracturePoolBucket> Pool;
+
+	UPROPERTY()
+	TArray<FBRActiveFracture> ActiveFractures;
+
+	/** 파편 에셋 상주용 핸들 (월드가 살아있는 동안 유지) */
+	TSharedPtr<FStreamableHandle> PrewarmHandle;
+
+	FTimerHandle ExpiryTimerHandle;
+
+	int32 NumSpawned = 0;
+	int32 NumReused = 0;
+	int32 NumRecycled = 0;
+};
@@ -12,18 +12,24 @@
 
 class ABRPlayerState;
 
-/** Seamless Travel 시 PlayerState에 복원할 전체 UserInfo (저장/복원용) */
+/**
+ * 게임 맵 Travel 매니페스트의 한 항목 (UserUID 키).
+ * 파트너는 PlayerArray 인덱스가 아니라 UID로 저장해 Travel 후 접속 순서가 바뀌어도 그대로 연결됩니다.
+ */
 struct FTravelUserInfoSave
 {
 	FString UserUID;
+	/** UserUID가 아직 없는 PlayerState(비 Seamless 재접속) 매칭용 */
+	FString UniqueNetId;
 	FString PlayerName;
 	FBRCustomizationData CustomizationData;
 	bool bIsHost = false;
-	bool bIsReady = false;
 	int32 TeamNumber = 0;
 	bool bIsSpectatorSlot = false;
 	bool bIsLowerBody = true;
-	int32 ConnectedPlayerIndex = -1;
+	FString PartnerUID;
+	/** 이미 이 PlayerState에 적용했으면 다시 적용하지 않음 (입장 시 1회 + Travel 후 정리 1회) */
+	TWeakObjectPtr<ABRPlayerState> AppliedTo;
 };
 
 DECLARE_LOG_CATEGORY_EXTERN(LogBRGameInstance, Log, All);
@@ -77,10 +83,11 @@ public:
 	TMap<FString, class UDataTable*> ConfigDataMap;
 
 	// --- [핵심] JSON 로드 및 밸런싱 적용 ---
+	/** 전체 설정 재로드 요청. 파싱은 워커 스레드에서 하고 바뀐 행만 게임 스레드에서 반영 */
 	UFUNCTION(Exec, Category = "Data")
 	void ReloadAllConfigs();
 
-	/** JSON 파일을 읽어 데이터 테이블 업데이트 */
+	/** JSON 파일을 읽어 데이터 테이블 즉시 업데이트 */
 	UFUNCTION(BlueprintCallable, Category = "Data")
 	void UpdateDataTableFromJson(UDataTable* TargetTable, FString FileName);
 
@@ -179,24 +186,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Session|Match")
 	void ClearPendingApplyRandomTeamRoles() { bPendingApplyRandomTeamRoles = false; }
 
-	/** Seamless Travel 전에 호출: 현재 GameState의 팀/역할을 저장 (Travel 후 PlayerState가 초기화되므로 복원용) */
-	void SavePendingRolesForTravel(class ABRGameState* GameState);
+	/** Travel 직전 호출: 현재 GameState의 팀/역할/파트너/커스터마이징을 UserUID 키 매니페스트로 저장 */
+	void SaveTravelManifest(class ABRGameState* GameState);
 
-	/** 게임 맵 로드 후 ApplyRoleChangesForRandomTeams 내부에서 호출: 저장된 팀/역할을 PlayerState에 복원 */
-	void RestorePendingRolesFromTravel(class ABRGameState* GameState);
+	/** UserUID(없으면 UniqueNetId)로 매니페스트 항목 조회. O(1) */
+	const FTravelUserInfoSave* FindTravelManifestEntry(const ABRPlayerState* BRPS) const;
 
-	/** 역할 복원용 저장 데이터 비우기 (적용 성공/포기 시 GameMode에서만 호출) */
-	void ClearPendingRoleRestoreData();
+	/** 입장 시점(PostLogin / Seamless Travel 플레이어 초기화)에 호출: 해당 플레이어 항목을 PlayerState에 적용. 항목이 있으면 true.
+	 *  파트너 연결은 전원 입장 후 ReconcileTravelManifest에서 */
+	bool ApplyTravelManifestEntry(ABRPlayerState* BRPS);
 
-	/** Travel 복원 대기 중인지 (게임 맵 PostLogin 직후 UpdatePlayerList에서 새 플레이어→대기열 초기화 스킵용) */
-	bool HasPendingRoleRestore() const;
-	/** 저장된 역할 복원 데이터 개수 (ApplyRoleChangesForRandomTeams 대기 조건용) */
-	int32 GetPendingRoleRestoreCount() const;
+	/** Travel 후 한 번 호출: 아직 적용되지 않은 플레이어 적용 + 파트너 UID로 연결. 적용된 인원 수 반환 */
+	int32 ReconcileTravelManifest(class ABRGameState* GameState);
+
+	/** 매니페스트 비우기 (적용 성공/포기 시 GameMode에서만 호출) */
+	void ClearTravelManifest();
 
-	/** PostLogin에서 호출: Travel 복원 시 해당 인덱스의 UserInfo가 있으면 true */
-	bool HasPendingUserInfoForIndex(int32 Index) const;
-	/** PostLogin에서 호출: 저장된 UserInfo를 PlayerState에 즉시 복원 (UID, Name, Customization, Host, Ready) */
-	void RestoreUserInfoToPlayerStateForPostLogin(class ABRPlayerState* BRPS, int32 Index);
+	/** Travel 복원 대기 중인지 (게임 맵 PostLogin 직후 UpdatePlayerList에서 새 플레이어→대기열 초기화 스킵용) */
+	bool HasTravelManifest() const { return TravelManifest.Num() > 0; }
+	/** 매니페스트 인원 수 (역할 적용 배리어의 기대 인원 계산용) */
+	int32 GetTravelManifestCount() const { return TravelManifest.Num(); }
 
 	// 전역 변수 설정을 위한 함수
 	void ApplyGlobalMultipliers();
@@ -212,10 +221,17 @@ public:
 	FBRCustomizationData GetLocalCustomization() const { return LocalCustomizationData; }
 		
 protected:
-	// 실제 JSON 파싱 로직
-	void LoadConfigFromJson(const FString& FileName, class UDataTable* TargetTable);
+	/** 부팅 시 설정 JSON 동기 로드 + 전역 배율 적용 (Init에서 1회) */
+	void LoadInitialConfigs();
+
+	/** UBRConfigService 비동기 재로드 반영 후: 바뀐 테이블에 맞춰 전역 배율/무기 데이터 재적용 */
+	void HandleConfigCommitted(const TArray<FString>& ChangedKeys);
+
+	/** 에디터(게임 미실행)에서 바뀐 테이블만 .uasset으로 저장 */
+	void SaveChangedConfigAssets(const TArray<FString>& ChangedKeys);
 
-	FString GetConfigDirectory();
+	/** 설정 JSON 폴더 (UBRConfigService가 1회 계산한 경로) */
+	FString GetConfigDirectory() const;
 
 	/** Session/타이머/네비 등 정리 (Shutdown PIE 블록과 OnWorldCleanup 콜백에서 호출) */
 	void DoPIEExitCleanup(UWorld* World);
@@ -235,10 +251,10 @@ protected:
 	/** 로비에서 랜덤 팀 배정 후, 게임 맵에서 ApplyRoleChangesForRandomTeams 호출 대기 */
 	bool bPendingApplyRandomTeamRoles = false;
 
-	/** Seamless Travel 후 역할 복원용 (TeamNumber, bIsLowerBody, ConnectedPlayerIndex) */
-	TMap<FString, TTuple<int32, bool, int32>> PendingRoleRestoreByName;
-	/** 인덱스 폴백용 */
-	TArray<TTuple<int32, bool, int32>> PendingRoleRestoreByIndex;
+	/** Travel 매니페스트 (UserUID → 저장 정보). 서버 GameInstance는 Seamless Travel 동안 유지됨 */
+	TMap<FString, FTravelUserInfoSave> TravelManifest;
+	/** UniqueNetId → UserUID 보조 키 */
+	TMap<FString, FString> TravelManifestUIDByNetId;
 
 	/** PIE 종료 시 월드 GC 방해 방지: OnStart에서 설정한 타이머 핸들 (Shutdown에서 명시적으로 클리어) */
 	FTimerHandle ListenServerTimerHandle;
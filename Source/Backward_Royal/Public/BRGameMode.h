@@ -4,9 +4,61 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
 #include "TimerManager.h"
+#include "BRStageCatalogSubsystem.h"
 #include "BRGameMode.generated.h"
 
 class ABRPlayerState;
+class AUpperBodyPawn;
+
+/**
+ * 랜덤 팀 역할 적용 배리어에서 추적하는 플레이어별 준비 상태.
+ * 경로마다 이벤트 순서가 다르므로(PostLogin은 HandleStartingNewPlayer 안에서 빙의가 먼저 옴) 단계별 플래그로 기록합니다.
+ */
+struct FBRRoleApplyReadiness
+{
+	/** PostLogin / Seamless Travel 플레이어 초기화 (GenericPlayerInitialization) */
+	bool bJoined = false;
+	/** Travel 매니페스트 항목을 PlayerState에 적용 (항목이 없으면 적용할 것이 없으므로 true) */
+	bool bStateRestored = false;
+	/** 복원 결과 대기열(관전)이면 하체 빙의/확인을 기다리지 않음 */
+	bool bNeedsBody = true;
+	/** 하체(APlayerCharacter) 빙의 */
+	bool bLowerPossessed = false;
+	/** 클라이언트 AcknowledgePossession → ServerReportSpawnReady (로컬 컨트롤러는 빙의 시점) */
+	bool bClientAcked = false;
+	/** 마지막 단계가 도착한 시간 (배리어 해제 로그용) */
+	double LastEventTime = 0.0;
+
+	bool IsReady() const
+	{
+		return bJoined && bStateRestored && (!bNeedsBody || (bLowerPossessed && bClientAcked));
+	}
+};
+
+/** 팀별 상체 스폰 작업 상태 */
+enum class EBRUpperBodySpawnState : uint8
+{
+	Pending,		// 스폰 대기 (첫 시도 또는 재시도 예약)
+	AwaitingAck,	// 스폰·빙의 완료, 클라이언트 AcknowledgePossession 대기
+	Acked,			// 완료
+	Failed			// 재시도 한도 초과 또는 역할 불일치
+};
+
+/** 팀 하나의 상체 스폰·빙의·확인 추적 (시간은 스케줄러 시작 기준 로그용) */
+struct FBRUpperBodySpawnTask
+{
+	int32 TeamNumber = 0;
+	TWeakObjectPtr<ABRPlayerState> LowerPS;
+	TWeakObjectPtr<ABRPlayerState> UpperPS;
+	TWeakObjectPtr<AUpperBodyPawn> UpperPawn;
+	EBRUpperBodySpawnState State = EBRUpperBodySpawnState::Pending;
+	int32 Attempts = 0;
+	/** Pending: 이 시간 이후 스폰 시도 / AwaitingAck: 이 시간까지 확인 없으면 재시도 */
+	double DeadlineTime = 0.0;
+	double FirstIssueTime = -1.0;
+	double PossessTime = -1.0;
+	double AckTime = -1.0;
+};
 
 UCLASS()
 class BACKWARD_ROYAL_API ABRGameMode : public AGameModeBase
@@ -24,6 +76,14 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Room Settings")
 	int32 MaxPlayers = 8;
 
+	/** 로비 대기열(Entry) 슬롯 수 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Room Settings", meta = (ClampMin = "1", ClampMax = "64"))
+	int32 LobbyEntrySlotCount = 8;
+
+	/** 로비 SelectTeam 팀 수 (팀당 관전/하체/상체 3슬롯) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Room Settings", meta = (ClampMin = "1", ClampMax = "21"))
+	int32 LobbyTeamCount = 4;
+
 	// 방 생성 후 이동할 로비 맵 경로. 비어 있으면 현재 맵 유지.
 	// 예: /Game/Main/Level/Main_Scene 또는 /Game/Main/Level/Stage/Stage01_Temple
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Settings", meta = (DisplayName = "로비 맵 경로"))
@@ -52,6 +112,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Settings")
 	bool bUseRandomMap = true;
 
+	/** Stage별 적정 인원. 범위 밖 인원이면 랜덤 선택에서 제외. 지정하지 않은 Stage는 인원이 적을수록 작은 맵이 잘 나오도록 크기로 추정 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Settings")
+	TArray<FBRStagePlayerRange> StagePlayerRanges;
+
 	/** PIE 종료 시 GameMode→GameSession→World 참조 사슬 차단 (DoPIEExitCleanup에서 호출) */
 	void ClearGameSessionForPIEExit();
 
@@ -72,12 +136,32 @@ public:
 	// 플레이어 로그아웃 처리
 	virtual void Logout(AController* Exiting) override;
 
-	// 랜덤 팀 배정 후 상체/하체 Pawn 재배치 (상체 스폰 및 빙의)
+	// 랜덤 팀 배정 후 상체/하체 Pawn 재배치 (역할 적용 배리어를 열고, 전원 준비되면 상체 스폰 및 빙의)
 	void ApplyRoleChangesForRandomTeams();
 
-	// 팀별 상체 스폰 간격(초). 이전 팀 상체 스폰/빙의/복제가 완료된 뒤에만 다음 팀 진행 (1팀 하체→상체 완료 후 2팀 진행)
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Settings", meta = (ClampMin = "0.5", ClampMax = "3.0"))
-	float SpawnDelayBetweenTeams = 1.2f;
+	/** 역할 적용 배리어 안전장치(초). 기대 인원이 전부 준비되면 즉시 진행하고, 연결 끊김 등으로 오지 않는 인원이 있을 때만 이 시간 뒤 현재 인원으로 진행 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Settings", meta = (ClampMin = "3.0", ClampMax = "60.0"))
+	float RoleApplyBarrierTimeout = 20.0f;
+
+	/** [서버] BRPlayerController::OnPossess에서 호출: 하체 빙의 기록 (로컬 컨트롤러는 확인까지). 게임 맵 BeginPlay가 늦으면 여기서 배리어를 엶 */
+	void NotifyRoleApplyPawnPossessed(APlayerController* PC, APawn* Pawn);
+
+	/** [서버] ServerReportSpawnReady 수신 시 호출: 배리어 대기 중이면 하체 빙의 확인, 상체 스폰 중이면 해당 팀 상체 빙의 확인 */
+	void NotifyRoleApplyClientAck(APlayerController* PC);
+
+	bool IsRoleApplyBarrierOpen() const { return bRoleApplyBarrierOpen; }
+
+	/** 한 프레임에 스폰·빙의할 최대 팀 수. 4팀 이하면 전 팀이 같은 프레임에 상체 스폰, 그 이상은 다음 프레임으로 나눔 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Settings", meta = (ClampMin = "1", ClampMax = "16"))
+	int32 MaxUpperBodySpawnsPerFrame = 4;
+
+	/** 상체 빙의 후 클라이언트 확인(AcknowledgePossession)을 기다리는 시간(초). 넘으면 해당 팀만 재시도 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Settings", meta = (ClampMin = "0.5", ClampMax = "10.0"))
+	float UpperBodyAckTimeout = 3.0f;
+
+	/** 팀별 상체 스폰 최대 시도 횟수 (첫 시도 포함). 초과한 팀만 실패 처리하고 나머지 팀은 그대로 진행 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Settings", meta = (ClampMin = "1", ClampMax = "10"))
+	int32 MaxUpperBodySpawnAttempts = 3;
 
 	/** 팀에 배정된 인원(TeamNumber>0, 대기열 관전 제외)만으로 고정 스폰 수: N명 시 하체 N/2, 상체 N/2. 4명→하체2 상체2, 6명→하체3 상체3 */
 	static int32 GetExpectedLowerBodyCount(int32 NumPlayersInTeamsOnly) { return NumPlayersInTeamsOnly / 2; }
@@ -125,39 +209,53 @@ public:
 	// 로비 맵으로 심리스 이동 (ServerTravel)
 	void ReturnToLobby();
 
+	/** 로비에서 시작 조건 충족 시 호출: 다음 Stage를 미리 골라 GameState에 복제 → 서버·클라이언트 선행 로드. 이미 골랐으면 유지 */
+	void PrepareStageForStart();
+
 protected:
+	virtual void InitGameState() override;
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-	/** Stage 폴더에서 맵 목록을 수집하거나, 실패 시 StageMapPathsFallback 반환 */
+	/** PostLogin·Seamless Travel 공통 초기화 지점: 역할 적용 배리어에 입장/복원 기록 */
+	virtual void GenericPlayerInitialization(AController* C) override;
+
+	/** Stage 카탈로그의 맵 목록 (StageMapPathsFallback, 비어 있으면 Stage 폴더 스캔 결과. 서버 시작 후 1회만 구성) */
 	TArray<FString> GetAvailableStageMapPaths() const;
 
+	/** 다음 게임 맵 선택 (bUseRandomMap이면 Stage 카탈로그에서 인원·최근성 가중 랜덤, 아니면 GameMapPath) */
+	FString SelectStageMapPath() const;
+
+	/** 현재 월드가 로비 맵(LobbyMapPath)인지 */
+	bool IsLobbyMap() const;
+
 	// 에디터(BP_BRGameMode)에서 BP_UpperBodyPawn을 할당할 변수
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Classes")
 	TSubclassOf<class AUpperBodyPawn> UpperBodyClass;
 
-	// 순차 스폰용: 한 팀씩 상체 스폰 후 다음 팀 예약
-	void ApplyRoleChangesForRandomTeams_ApplyOneTeam();
-
-	// 순차 스폰 스테이징 (팀 인덱스만 저장, SortedByTeam는 매번 GameState에서 재구성하지 않고 캐시)
-	TArray<ABRPlayerState*> StagedSortedByTeam;
-	int32 StagedNumTeams = 0;
-	int32 StagedCurrentTeamIndex = 0;
-	/** 순차 상체 스폰에서 실제로 스폰된 상체 수 (완료 시 로그/경고용) */
-	int32 StagedUpperBodiesSpawnedCount = 0;
-	/** 전체 하체 Pawn 준비 대기 재시도 횟수 (로딩 빠른 맵에서 전원 하체 스폰 완료 후 상체 적용) */
-	int32 StagedAllLowerReadyRetries = 0;
-	FTimerHandle StagedAllLowerReadyHandle;
-	/** 하체 Pawn 대기 재진입 시 팀 목록 고정용. 재진입 시 PlayerArray 기준 재구성하면 일부가 TeamNumber 0으로 바뀌어 3명만 남는 현상 방지 */
-	TArray<ABRPlayerState*> PendingSortedByTeamSnapshot;
-	/** 팀별 상체 스폰 시 하체 Pawn 없을 때 같은 팀 재시도 횟수 (Stage02_Bushes 등 느린 맵 대응) */
-	int32 StagedPawnWaitRetriesForTeam = 0;
-	static constexpr int32 MaxStagedPawnWaitRetriesPerTeam = 8;
-	/** 팀별 Controller 없을 때 같은 팀 재시도. 1팀 하체→상체 완료 후 다음 팀 진행하듯, 해당 팀 Controller가 서버에 올 때까지 대기 */
-	int32 StagedControllerWaitRetriesForTeam = 0;
-	static constexpr int32 MaxStagedControllerWaitRetriesForTeam = 40;  // 0.5초×40 = 20초 (하체 Pawn 대기와 동일하게 생성될 때까지 대기)
-	FTimerHandle StagedApplyTimerHandle;
-	FTimerHandle InitialRoleApplyTimerHandle;
+	// --- 상체 스폰 스케줄러 ---
+	// 배리어 해제 후 전 팀 상체를 같은 프레임(팀이 많으면 MaxUpperBodySpawnsPerFrame 단위로 몇 프레임)에 스폰·빙의하고,
+	// 팀별로 클라이언트 확인을 추적해 실패한 팀만 재시도
+
+	/** 정렬된 팀 목록(팀 순서, 팀 내 하체 먼저)으로 작업 생성 후 첫 스폰 발행 */
+	void BeginUpperBodySpawns(const TArray<ABRPlayerState*>& SortedByTeam, int32 NumTeams);
+	/** 시도할 때가 된 작업 발행 / 확인 시간 초과 작업 재시도 / 전원 끝나면 완료 처리 */
+	void TickUpperBodySpawns();
+	/** 작업 하나의 상체 스폰 + 빙의. 컨트롤러/하체가 없으면 재시도 예약 */
+	void IssueUpperBodySpawn(FBRUpperBodySpawnTask& Task, double Now);
+	/** 다음 마감(재시도/확인 시간 초과)에 맞춰 TickUpperBodySpawns 예약 */
+	void ScheduleUpperBodySpawnTick(double Now);
+	/** 재시도 또는 실패 처리 */
+	void HandleUpperBodySpawnFailure(FBRUpperBodySpawnTask& Task, double Now, const TCHAR* Reason);
+	/** 전 팀 끝 → GI 정리, bBodyAssignmentComplete, 팀별 타이밍 로그, 확인된 컨트롤러 스폰 완료 집계 */
+	void FinishUpperBodySpawns();
+
+	TArray<FBRUpperBodySpawnTask> UpperBodySpawnTasks;
+	double UpperBodySpawnStartTime = 0.0;
+	/** 프레임당 발행 수 제한용 (GFrameCounter 기준) */
+	uint64 UpperBodySpawnFrame = 0;
+	int32 UpperBodySpawnsThisFrame = 0;
+	FTimerHandle UpperBodySpawnTimerHandle;
 	/** 테스트 맵 직접 실행(로비 없음) 시 2초 후 역할 적용 폴백용 */
 	FTimerHandle DirectStartRoleApplyTimerHandle;
 	/** 사망 후 2초 뒤 관전 전환용 (인덱스 콜백 사용) */
@@ -168,21 +266,30 @@ protected:
 	/** 테스트 맵을 로비 없이 바로 실행했을 때: 저장된 역할이 없고 전원 하체면 랜덤 팀 배정 후 상체/하체 적용 */
 	void TryApplyDirectStartRolesFallback();
 
-	/** 플레이어 대기 재시도 횟수. 최대 초과 시 현재 인원으로 진행해 상체 스폰 시도 (하체만 4명 방지) */
-	int32 InitialPlayerWaitRetries = 0;
-	static constexpr int32 MaxInitialPlayerWaitRetries = 24;  // 0.5초×24 = 12초
-	/** 2명 미만일 때 재시도 횟수. Seamless Travel 직후 클라이언트 재접속 전에 타이머가 돌면 하체만 스폰되므로, 2명 될 때까지 0.5초 간격 재시도 */
-	int32 MinPlayerWaitRetries = 0;
-	static constexpr int32 MaxMinPlayerWaitRetries = 24;  // 0.5초×24 = 12초
-	/** ExpectedCount==0일 때 2명에서 바로 진행하면 나중에 들어온 3·4번째가 전부 하체로 남음. 2명일 때만 추가로 잠시 대기(0.5초×6=3초) */
-	int32 ExpectedZeroWaitRetries = 0;
-	static constexpr int32 MaxExpectedZeroWaitRetries = 6;
-
-	/** 1.5초 폴백 타이머가 이미 예약되었으면 true (OnPossess 중복 예약 방지) */
-	bool bHasScheduledInitialRoleApply = false;
-public:
-	bool HasScheduledInitialRoleApply() const { return bHasScheduledInitialRoleApply; }
-	/** 1.5초 후 ApplyRoleChangesForRandomTeams 예약 (BeginPlay/OnPossess에서 한 번만 호출되도록 외부에서 HasScheduledInitialRoleApply 확인 후 호출) */
-	void ScheduleInitialRoleApplyIfNeeded();
+	// --- 역할 적용 배리어 ---
+	// 기대 인원 각각이 입장 → PlayerState 복원 → 하체 빙의 → 클라이언트 확인을 마치는 순간(마지막 이벤트) 바로 상체 적용.
+	// 고정 간격 재시도 대신 이벤트마다 평가하고, 타이머는 RoleApplyBarrierTimeout 안전장치 하나만 사용
+
+	/** 배리어 열기: 기대 인원 확정 후 즉시 평가 (열기 전에 기록된 이벤트도 그대로 반영) */
+	void OpenRoleApplyBarrier();
+	/** 전원 준비됐으면 해제 */
+	void EvaluateRoleApplyBarrier();
+	void OnRoleApplyBarrierTimeout();
+	/** 배리어 해제 → 역할 복원/검증 후 순차 상체 스폰 시작 */
+	void ReleaseRoleApplyBarrier(bool bTimedOut);
+
+	FBRRoleApplyReadiness& FindOrAddRoleApplyReadiness(APlayerController* PC);
+	/** 배리어가 기록한 컨트롤러 중 해당 PlayerState를 가진 컨트롤러 (Seamless Travel 직후 GetOwningController 불일치 대비) */
+	APlayerController* FindRoleApplyController(const ABRPlayerState* PS) const;
+	/** 이 맵으로 오고 있는 인원: 로컬 플레이어 + 서버 연결 수 (Seamless Travel 중에도 연결은 유지됨) */
+	int32 CountConnectedPlayers() const;
+
+	/** 배리어가 기다리는 플레이어별 상태. 배리어를 열기 전에 도착한 이벤트도 기록해 둠 */
+	TMap<TWeakObjectPtr<APlayerController>, FBRRoleApplyReadiness> RoleApplyReadiness;
+	int32 RoleApplyExpectedPlayers = 0;
+	double RoleApplyBarrierOpenTime = 0.0;
+	bool bRoleApplyBarrierOpen = false;
+	/** 해제 후에는 이벤트 기록 중단 (상체 빙의 등은 배리어와 무관) */
+	bool bRoleApplyBarrierReleased = false;
+	FTimerHandle RoleApplyBarrierTimeoutHandle;
 };
-
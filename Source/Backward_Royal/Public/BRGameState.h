@@ -5,8 +5,15 @@
 #include "GameFramework/GameStateBase.h"
 #include "TimerManager.h"
 #include "BRUserInfo.h"
+#include "BRCombatEvent.h"
+#include "BRBalanceSubsystem.h"
+#include "BRLobbySlotModel.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "BRGameState.generated.h"
 
+class ABRGameState;
+struct FBRUserInfoList;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPlayerListChanged);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnTeamChanged);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGameEndedWithWinner, int32, WinningTeamNumber);
@@ -19,6 +26,70 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnBodyAssignmentComplete);
 /** 모든 클라이언트가 스폰 완료 신호를 보낸 뒤 서버가 브로드캐스트. UI 전환·입력 해제 시점 */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAllClientsSpawnReady);
 
+/** 플레이어 목록 항목. PlayerState 단위로 키잉되어 값이 바뀐 항목만 복제됨 */
+USTRUCT()
+struct FBRUserInfoListEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** 항목 키 (이 정보의 주인) */
+	UPROPERTY()
+	TObjectPtr<APlayerState> PlayerState = nullptr;
+
+	UPROPERTY()
+	FBRUserInfo Info;
+
+	// 클라이언트 측 항목별 수신 콜백 → GameState의 OnPlayerListChanged로 모아서 전달
+	void PreReplicatedRemove(const FBRUserInfoList& InArraySerializer);
+	void PostReplicatedAdd(const FBRUserInfoList& InArraySerializer);
+	void PostReplicatedChange(const FBRUserInfoList& InArraySerializer);
+};
+
+/** 로비 표시용 플레이어 목록 (FastArray). 한 명이 바뀌면 그 항목만 전송 */
+USTRUCT()
+struct FBRUserInfoList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FBRUserInfoListEntry> Items;
+
+	/** 콜백을 전달할 GameState (복제 안 함) */
+	UPROPERTY(NotReplicated)
+	TObjectPtr<ABRGameState> OwnerGameState = nullptr;
+
+	/** [서버 전용] 플레이어 항목 추가 또는 갱신. 값이 같으면 dirty 표시 안 함. 변경되었으면 true */
+	bool AddOrUpdate(APlayerState* PlayerState, const FBRUserInfo& Info);
+
+	/** [서버 전용] PlayerArray에 더 이상 없는 플레이어 항목 제거. 제거했으면 true */
+	bool RemoveMissing(const TArray<TObjectPtr<APlayerState>>& PlayerArray);
+
+	/** FBRUserInfo::PlayerIndex(PlayerArray 인덱스)로 조회. 없으면 nullptr */
+	const FBRUserInfo* FindByPlayerIndex(int32 PlayerIndex) const;
+
+	int32 Num() const { return Items.Num(); }
+
+	/** 항목 콜백에서 호출. 이번 수신에 변경이 있었음을 기록 */
+	void MarkReceivedChange(const FBRUserInfoListEntry& Entry, const TCHAR* ChangeType) const;
+
+	/** 한 번의 수신(여러 항목 변경)이 끝난 뒤 1회만 OnPlayerListChanged 브로드캐스트 */
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FBRUserInfoListEntry, FBRUserInfoList>(Items, DeltaParms, *this);
+	}
+
+private:
+	mutable bool bReceivedChange = false;
+};
+
+template<>
+struct TStructOpsTypeTraits<FBRUserInfoList> : public TStructOpsTypeTraitsBase2<FBRUserInfoList>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
 UCLASS()
 class BACKWARD_ROYAL_API ABRGameState : public AGameStateBase
 {
@@ -39,15 +110,24 @@ public:
 	UPROPERTY(ReplicatedUsing = OnRep_PlayerCount, BlueprintReadOnly, Category = "Room")
 	int32 PlayerCount;
 
-	/** 서버가 채운 플레이어 목록(이름 등). 복제되어 클라이언트도 동일 목록으로 UI 표시 */
-	UPROPERTY(ReplicatedUsing = OnRep_PlayerListForDisplay, BlueprintReadOnly, Category = "Room")
-	TArray<FBRUserInfo> PlayerListForDisplay;
+	/** 서버가 채운 플레이어 목록(이름 등). 플레이어별 FastArray로 복제되어 클라이언트도 동일 목록으로 UI 표시.
+	 *  블루프린트/UI는 GetAllPlayerUserInfo / GetLobbyEntryDisplayList 사용 */
+	UPROPERTY(Replicated)
+	FBRUserInfoList PlayerListForDisplay;
+
+	/** 로비 Entry 슬롯 수 (GameMode의 LobbyEntrySlotCount). 서버가 InitGameState에서 설정, 복제됨 */
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Lobby")
+	int32 NumLobbyEntrySlots = 8;
 
-	/** 로비 Entry 슬롯(0~7). 각 요소 = PlayerArray 인덱스 또는 -1(빈 슬롯). 서버에서만 수정, 복제됨 */
+	/** 로비 SelectTeam 팀 수 (GameMode의 LobbyTeamCount). 팀당 슬롯은 관전/하체/상체 3칸 고정 */
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Lobby")
+	int32 NumLobbyTeams = 4;
+
+	/** 로비 Entry 슬롯(0~NumLobbyEntrySlots-1). 각 요소 = PlayerArray 인덱스 또는 -1(빈 슬롯). 서버 슬롯 모델에서 바뀐 칸만 다시 씀, 복제됨 */
 	UPROPERTY(ReplicatedUsing = OnRep_LobbySlots, BlueprintReadOnly, Category = "Lobby")
 	TArray<int32> LobbyEntrySlots;
 
-	/** 로비 SelectTeam 슬롯 [팀1~4][관전/하체/상체]. 인덱스 = TeamIndex*3 + SlotIndex(0=관전,1=하체,2=상체). 값 = PlayerArray 인덱스 또는 -1 */
+	/** 로비 SelectTeam 슬롯 [팀][관전/하체/상체]. 인덱스 = TeamIndex*3 + SlotIndex(0=관전,1=하체,2=상체). 값 = PlayerArray 인덱스 또는 -1 */
 	UPROPERTY(ReplicatedUsing = OnRep_LobbySlots, BlueprintReadOnly, Category = "Lobby")
 	TArray<int32> LobbyTeamSlots;
 
@@ -55,6 +135,10 @@ public:
 	UPROPERTY(ReplicatedUsing = OnRep_CanStartGame, BlueprintReadOnly, Category = "Room")
 	bool bCanStartGame;
 
+	/** 시작 조건 충족 시 서버가 미리 고른 다음 Stage 맵 패키지. 수신 즉시 각자 선행 로드 시작 (비어 있으면 아직 미정) */
+	UPROPERTY(ReplicatedUsing = OnRep_PendingStageMapPath, BlueprintReadOnly, Category = "Room")
+	FString PendingStageMapPath;
+
 	/** 승리한 팀 번호 (0=진행중, 1 이상=해당 팀 승리). 게임 종료 시 서버에서 설정, 복제됨 */
 	UPROPERTY(ReplicatedUsing = OnRep_WinningTeamNumber, BlueprintReadOnly, Category = "Game")
 	int32 WinningTeamNumber = 0;
@@ -134,6 +218,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Lobby")
 	FBRUserInfo GetLobbyTeamSlotInfoByTeamIDAndPlayerIndex(int32 TeamID, int32 PlayerIndex) const;
 
+	/** [서버 전용] 로비 슬롯 수 설정 (플레이어 입장 전 GameMode::InitGameState에서 호출). 바뀌면 슬롯 전체 초기화 */
+	void ConfigureLobbySlots(int32 InNumEntrySlots, int32 InNumTeams);
+
 	/** [서버 전용] 해당 플레이어를 Entry에서 제거하고 SelectTeam 슬롯에 배치. 성공 시 true */
 	bool AssignPlayerToLobbyTeam(int32 PlayerIndex, int32 TeamIndex, int32 SlotIndex);
 	/** [서버 전용] SelectTeam 슬롯의 플레이어를 Entry 첫 빈 자리로 이동. 성공 시 true */
@@ -174,8 +261,7 @@ public:
 	UFUNCTION()
 	void OnRep_PlayerCount();
 
-	// 복제된 플레이어 목록 수신 시 호출 (클라이언트 UI 갱신용)
-	UFUNCTION()
+	// 복제된 플레이어 목록 수신 시 호출 (클라이언트 UI 갱신용). FBRUserInfoList::PostReplicatedReceive에서 수신 1회당 1번 호출
 	void OnRep_PlayerListForDisplay();
 
 	// 로비 Entry/SelectTeam 슬롯 복제 수신 시 호출
@@ -190,6 +276,17 @@ public:
 	UFUNCTION()
 	void OnRep_RoomTitle();
 
+	/** 다음 Stage 수신 시 선행 로드 시작, 비워지면 선행 로드 해제 */
+	UFUNCTION()
+	void OnRep_PendingStageMapPath();
+
+	/** [서버 전용] 다음 Stage 지정. 모든 플레이어 진행률을 0으로 초기화하고 서버도 선행 로드 시작 (빈 문자열이면 선행 로드 취소) */
+	void SetPendingStageMapPath(const FString& NewStageMapPath);
+
+	/** 전원 중 가장 느린 플레이어의 선행 로드 진행률 (0~1). Stage 미정이면 0 */
+	UFUNCTION(BlueprintCallable, Category = "Room")
+	float GetStagePreloadProgress() const;
+
 	/** 승리 팀 번호 복제 수신 시 호출 (UI 갱신용) */
 	UFUNCTION()
 	void OnRep_WinningTeamNumber();
@@ -211,14 +308,19 @@ public:
 	/** [서버 전용] 승리 팀 설정 후 게임 종료 처리. WinningTeamNumber 설정 및 OnGameEndedWithWinner 브로드캐스트 */
 	void EndGameWithWinner(int32 WinnerTeamNumber);
 
-	/** 대기열 슬롯 압축: 빈 칸(-1) 제거 후 뒤 플레이어를 앞으로 당김. AssignPlayerToLobbyTeam / MovePlayerToLobbyEntry 후 호출 */
+	/** [서버 전용] 대기열 슬롯 압축: 빈 칸 제거 후 뒤 플레이어를 앞으로 당김 (이미 압축돼 있으면 아무것도 하지 않음) */
 	void CompactLobbyEntrySlots();
 
 	void MulticastMatchEnded_Implementation(FVector WinnerLocation, const FString& UpperName, const FString& LowerName);
 
+	/** [서버→전체] 한 프레임 동안 쌓인 타격 연출 이벤트 일괄 전달 (UBRCombatEventSubsystem이 프레임당 1회 호출) */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastCombatEvents(const TArray<FBRCombatEvent>& Events);
+
 protected:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** [서버 전용] 스폰 완료 신호를 기대하는 컨트롤러 수 (플레이어/팀 수). 복제 안 함 */
 	int32 ExpectedSpawnReadyCount = 0;
@@ -227,5 +329,31 @@ protected:
 	/** [서버 전용] 전원 신호 대기 타임아웃. 만료 시 강제로 bAllClientsSpawnReady 처리 */
 	FTimerHandle SpawnReadyTimeoutHandle;
 	void OnSpawnReadyTimeout();
+
+	/** [서버 전용] PendingStageMapPath를 정한 시점의 PlayerArray 인원. 인원이 바뀌면 Stage를 다시 고름 */
+	int32 PendingStagePlayerCount = INDEX_NONE;
+
+	/** [서버 발행 → 복제] 전역 밸런스 스냅샷. 발행(재로드)될 때만 전송되고 클라이언트는 UBRBalanceSubsystem에 그대로 채택 */
+	UPROPERTY(ReplicatedUsing = OnRep_BalanceSnapshot)
+	FBRBalanceSnapshot BalanceSnapshot;
+
+	UFUNCTION()
+	void OnRep_BalanceSnapshot();
+
+	/** [서버 전용] 서버에서 새 스냅샷이 발행되면 복제용 사본 갱신 */
+	void HandleBalancePublished(const FBRBalanceSnapshot& Snapshot);
+
+	/** [서버 전용] 로비 슬롯 점유 모델 (PlayerState 단위, 역인덱스 + 빈 슬롯 비트마스크) */
+	FBRLobbySlotModel LobbySlotModel;
+
+	/** [서버 전용] 슬롯 모델이 아직 구성되지 않았으면 현재 슬롯 수로 구성 */
+	void EnsureLobbySlotModel();
+
+	/** [서버 전용] PlayerState → 현재 PlayerArray 인덱스 (슬롯 동기화 1회당 1번 구성) */
+	void BuildPlayerIndexMap(TMap<const APlayerState*, int32>& OutIndexByPlayer) const;
+
+	/** [서버 전용] 슬롯 모델 → 복제 배열 (LobbyEntrySlots / LobbyTeamSlots). 값이 바뀐 칸만 씀. 하나라도 바뀌었으면 true */
+	bool SyncLobbySlotArrays(const TMap<const APlayerState*, int32>& IndexByPlayer);
+	bool SyncLobbySlotArrays();
 };
 
@@ -0,0 +1,148 @@
+// BRLoadTestBotSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "BRLoadTestBotSubsystem.generated.h"
+
+class ABRGameSession;
+class ABRPlayerController;
+class APlayerCharacter;
+class AUpperBodyPawn;
+class UEnhancedInputLocalPlayerSubsystem;
+class UNetConnection;
+class FOnlineSessionSearchResult;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogLoadTestBot, Log, All);
+
+/** 봇 진행 단계 */
+enum class EBRBotPhase : uint8
+{
+	Boot,
+	CreatingRoom,	// 호스트: 세션 생성 → ?listen 이동 대기
+	SearchingRoom,	// 참가자: 주기적으로 방 찾기
+	Joining,		// 참가자: 세션 참가 → 서버 접속 대기
+	Lobby,			// 준비 / 랜덤 팀 / 시작 조건 대기
+	Starting,		// 호스트: 게임 시작 요청 후 전원 스폰 완료 대기
+	InMatch,		// 역할(하체/상체)에 맞게 입력 주입
+	Finished
+};
+
+/**
+ * 헤드리스 부하 테스트 봇 (-BRBot)
+ * 한 장비에서 여러 -nullrhi 인스턴스를 띄워 사람 없이 로비 → 매치 흐름 전체를 돌립니다.
+ * 모든 조작은 ABRPlayerController의 로비 함수와 Enhanced Input 주입으로 수행해 실제 플레이어와 같은 경로(RPC 포함)를 탑니다.
+ * - 호스트(-BRBotHost): 방 생성, 인원(-BRBotPlayers) 전원 준비 시 랜덤 팀 → 게임 시작
+ * - 참가자: Null OSS(LAN)로 방 찾기 → 첫 방 참가, 이름 설정, 준비
+ * - 매치: 하체는 이동/달리기/점프, 상체는 조준/공격/상호작용
+ * 호스트는 매치 시작 후 -BRBotMatchSeconds 동안 서버 프레임 시간, 클라이언트별 송수신 바이트/초,
+ * 신뢰성 버퍼(미확인 reliable 번치) 최고 수위, 매치 시작 지연을 측정해 Saved/Benchmarks/LoadTest.csv에 기록합니다.
+ *
+ * 예) 호스트: -nullrhi -BRBot -BRBotHost -BRBotPlayers=8 -BRBotName=Host -BRBotQuit
+ *     참가자: -nullrhi -BRBot -BRBotName=Bot2 -BRBotQuit  (x7)
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRLoadTestBotSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	EBRBotPhase GetPhase() const { return Phase; }
+
+	/** 결과 CSV 경로 (실행마다 한 줄 추가) */
+	static FString GetResultFilePath();
+
+	/** 방 찾기 재시도 간격 / 준비 토글 재시도 간격 / 랜덤 팀 재요청 간격 (초) */
+	static constexpr double SearchInterval = 3.0;
+	static constexpr double ReadyRetryInterval = 2.0;
+	static constexpr double TeamsRetryInterval = 3.0;
+
+	/** 단계별 대기 한도 (초). 넘으면 이전 단계부터 재시도 */
+	static constexpr double CreateRoomTimeout = 30.0;
+	static constexpr double JoinTimeout = 15.0;
+	static constexpr double StartRetryInterval = 15.0;
+
+private:
+	/** 클라이언트(서버 연결)별 측정값 */
+	struct FConnectionStats
+	{
+		FString Name;
+		double FirstSeenTime = 0.0;
+		double LastSeenTime = 0.0;
+		int64 StartOutBytes = 0;
+		int64 StartInBytes = 0;
+		int64 LastOutBytes = 0;
+		int64 LastInBytes = 0;
+		int32 ReliableHighWater = 0;
+	};
+
+	bool HandleTick(float DeltaTime);
+
+	void TickBoot(ABRPlayerController* PC, UWorld* World, double Now);
+	void TickLobby(ABRPlayerController* PC, UWorld* World, double Now);
+	void TickStarting(ABRPlayerController* PC, UWorld* World, double Now);
+	void TickMatch(ABRPlayerController* PC, UWorld* World, double Now);
+
+	void HandleFindSessionsComplete(const TArray<FOnlineSessionSearchResult>& Results);
+
+	/** 역할별 입력 주입 (실제 입력 바인딩 → 서버 RPC 경로 그대로) */
+	void DriveLowerBody(APlayerCharacter* Lower, UEnhancedInputLocalPlayerSubsystem* Input, double Now);
+	void DriveUpperBody(AUpperBodyPawn* Upper, UEnhancedInputLocalPlayerSubsystem* Input, double Now);
+
+	/** [호스트] 매 프레임 서버 부하 샘플링 */
+	void SampleServer(UWorld* World, double Now);
+	void WriteReport(UWorld* World, double Now) const;
+
+	void SetPhase(EBRBotPhase NewPhase, double Now);
+	/** InMatch 진입 시 측정 구간 시작 (샘플 초기화, 매치 시작 지연 기록) */
+	void BeginMeasure(double Now);
+	void Finish(const TCHAR* Reason);
+
+	// --- 설정 (명령줄) ---
+	bool bIsHost = false;
+	bool bQuitWhenDone = false;
+	FString BotName;
+	FString RoomName;
+	int32 ExpectedPlayers = 8;
+	double MatchSeconds = 120.0;
+	double TimeoutSeconds = 900.0;
+
+	EBRBotPhase Phase = EBRBotPhase::Boot;
+	double BootTime = 0.0;
+	double PhaseStartTime = 0.0;
+
+	FRandomStream Random;
+
+	// --- 로비 ---
+	double NextSearchTime = 0.0;
+	double NextReadyTime = 0.0;
+	double NextTeamsTime = 0.0;
+	double LobbyFilledTime = 0.0;
+	double StartRequestTime = 0.0;
+	FDelegateHandle FindSessionsHandle;
+	TWeakObjectPtr<ABRGameSession> BoundGameSession;
+
+	// --- 매치 입력 ---
+	FVector2D WanderInput = FVector2D::ZeroVector;
+	FVector2D AimInput = FVector2D::ZeroVector;
+	bool bSprinting = false;
+	double NextWanderTime = 0.0;
+	double NextJumpTime = 0.0;
+	double NextAimTime = 0.0;
+	double NextAttackTime = 0.0;
+	double NextInteractTime = 0.0;
+
+	// --- 서버 측정 (호스트) ---
+	double MatchStartLatency = -1.0;
+	double MeasureStartTime = 0.0;
+	TArray<float> FrameTimesMs;
+	TArray<float> GameThreadTimesMs;
+	TMap<TWeakObjectPtr<UNetConnection>, FConnectionStats> ConnectionStats;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,73 @@
+// BRLobbySlotModel.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+class APlayerState;
+
+/**
+ * [서버 전용] 로비 슬롯 점유 모델
+ * 대기열(Entry) 슬롯과 SelectTeam 슬롯(팀당 관전/하체/상체)을 하나의 슬롯 공간으로 관리합니다.
+ *   슬롯 번호 [0, NumEntrySlots) = 대기열, [NumEntrySlots, NumEntrySlots + NumTeams * SlotsPerTeam) = 팀 슬롯(Flat 순서)
+ * - 점유자는 PlayerState로 보관하므로 누가 나가 PlayerArray 인덱스가 당겨져도 자리가 유지됩니다.
+ * - 플레이어 → 슬롯 역인덱스, 빈 슬롯 비트마스크로 배치/이동/빈 자리 찾기가 모두 O(1)입니다.
+ * 복제용 ABRGameState::LobbyEntrySlots / LobbyTeamSlots (PlayerArray 인덱스)는 이 모델에서 바뀐 칸만 다시 씁니다.
+ */
+struct BACKWARD_ROYAL_API FBRLobbySlotModel
+{
+	/** 팀당 슬롯 수 (0=관전, 1=하체, 2=상체) */
+	static constexpr int32 SlotsPerTeam = 3;
+
+	/** 비트마스크 폭 = 대기열/팀 슬롯 각각의 최대 수 */
+	static constexpr int32 MaxSlotsPerMask = 64;
+
+	/** 슬롯 수 설정. 바뀌면 전체 초기화. 실제 적용된 값으로 클램프됨 */
+	void Configure(int32 InNumEntrySlots, int32 InNumTeams);
+
+	/** 모든 슬롯 비우기 */
+	void Reset();
+
+	int32 GetNumEntrySlots() const { return NumEntrySlots; }
+	int32 GetNumTeams() const { return NumTeams; }
+	int32 GetNumTeamSlots() const { return NumTeams * SlotsPerTeam; }
+	int32 GetNumSlots() const { return Occupants.Num(); }
+
+	bool IsEntrySlot(int32 Slot) const { return Slot >= 0 && Slot < NumEntrySlots; }
+	int32 TeamSlot(int32 TeamIndex, int32 SlotIndex) const { return NumEntrySlots + TeamIndex * SlotsPerTeam + SlotIndex; }
+	int32 TeamFlatOf(int32 Slot) const { return Slot - NumEntrySlots; }
+
+	/** 플레이어가 있는 슬롯. 없으면 INDEX_NONE */
+	int32 FindSlot(const APlayerState* Player) const;
+
+	/** 슬롯 점유자. 빈 슬롯이면 nullptr */
+	APlayerState* GetOccupant(int32 Slot) const;
+
+	/** 대기열 첫 빈 자리. 가득 찼으면 INDEX_NONE */
+	int32 FindFreeEntrySlot() const;
+
+	/** 플레이어를 슬롯에 배치 (이전 자리는 비움). 슬롯에 다른 사람이 있으면 실패 */
+	bool Place(APlayerState* Player, int32 Slot);
+
+	/** 플레이어를 빼고 있던 슬롯 반환 (없었으면 INDEX_NONE) */
+	int32 Remove(const APlayerState* Player);
+
+	/** 조건에 맞는 점유자와 이미 파괴된 점유자 제거 (나간 플레이어 정리). 제거한 수 반환 */
+	int32 RemoveIf(TFunctionRef<bool(const APlayerState*)> ShouldRemove);
+
+	/** 대기열을 앞으로 당김 (순서 유지). 이미 앞에서부터 채워져 있으면 아무것도 하지 않음. 움직였으면 true */
+	bool CompactEntries();
+
+private:
+	void SetOccupant(int32 Slot, APlayerState* Player);
+	void ClearSlot(int32 Slot);
+
+	int32 NumEntrySlots = 0;
+	int32 NumTeams = 0;
+
+	TArray<TWeakObjectPtr<APlayerState>> Occupants;
+	TMap<TWeakObjectPtr<const APlayerState>, int32> SlotByPlayer;
+
+	/** 1 = 빈 슬롯 */
+	uint64 FreeEntryMask = 0;
+	uint64 FreeTeamMask = 0;
+};
@@ -0,0 +1,69 @@
+// BRLobbyViewModelSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BRLobbyViewModelSubsystem.generated.h"
+
+class ABRGameState;
+class ABRPlayerState;
+
+/** 로비 UI에서 다시 그려야 하는 영역 (비트 플래그) */
+enum class EBRLobbyViewDirty : uint8
+{
+	None			= 0,
+	PlayerList		= 1 << 0,	// 이름·준비·역할·슬롯 배치
+	Teams			= 1 << 1,	// 팀 변경 이벤트
+	CanStartGame	= 1 << 2,	// 게임 시작 가능 여부
+	RoomTitle		= 1 << 3,	// 방 제목
+	StagePreload	= 1 << 4,	// 다음 Stage 선행 로드 진행률
+	All				= PlayerList | Teams | CanStartGame | RoomTitle | StagePreload
+};
+ENUM_CLASS_FLAGS(EBRLobbyViewDirty);
+
+/** 한 프레임 동안 모인 변경을 1회로 묶어 전달 */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLobbyViewUpdated, EBRLobbyViewDirty /*DirtyFlags*/);
+
+/**
+ * 로비 UI 뷰모델
+ * ABRGameState / ABRPlayerState의 OnRep_* 에서 변경을 통보받아 플래그만 쌓고,
+ * 다음 틱에 한 번만 OnLobbyViewUpdated를 브로드캐스트합니다.
+ * 위젯은 NativeTick 폴링이나 복제 지연 대비 타이머 없이 이 이벤트만 구독하면 됩니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRLobbyViewModelSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	/** 월드에서 뷰모델 가져오기 (전용 서버 등 없으면 nullptr) */
+	static UBRLobbyViewModelSubsystem* Get(const UObject* WorldContextObject);
+
+	/** 변경 통보 헬퍼. 뷰모델이 없는 월드에서도 안전하게 호출 가능 */
+	static void Notify(const UObject* WorldContextObject, EBRLobbyViewDirty Flags);
+
+	/** GameState의 목록/팀 이벤트 구독 (ABRGameState::BeginPlay에서 호출) */
+	void BindGameState(ABRGameState* InGameState);
+
+	/** 변경 표시. 같은 프레임의 여러 호출은 다음 틱 1회 갱신으로 합쳐짐 */
+	void MarkDirty(EBRLobbyViewDirty Flags);
+
+	/** 묶음 갱신 이벤트 (C++ 위젯에서 AddUObject로 구독) */
+	FOnLobbyViewUpdated OnLobbyViewUpdated;
+
+private:
+	UFUNCTION()
+	void HandlePlayerListChanged();
+
+	UFUNCTION()
+	void HandleTeamChanged();
+
+	void Flush();
+
+	TWeakObjectPtr<ABRGameState> BoundGameState;
+
+	EBRLobbyViewDirty PendingFlags = EBRLobbyViewDirty::None;
+};
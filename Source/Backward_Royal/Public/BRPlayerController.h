@@ -271,6 +271,10 @@ protected:
 	UFUNCTION(Server, Reliable)
 	void ServerReportSpawnReady();
 
+	/** 다음 Stage 선행 로드 진행률 보고 (클라이언트→서버, 10% 단위). 다른 Stage에 대한 늦은 보고는 무시 */
+	UFUNCTION(Server, Reliable)
+	void ServerReportStagePreloadProgress(const FString& StagePackageName, uint8 Percent);
+
 private:
 	/** RPC 레이트 리밋: 민감한 서버 RPC 호출 간 최소 간격(초). */
 	static constexpr float MinSensitiveRPCIntervalSec = 0.5f;
@@ -160,9 +160,20 @@ public:
 	UFUNCTION()
 	void OnRep_CustomizationData();
 
+	/** 다음 Stage 선행 로드 진행률 (0~100). 로비에서 Stage가 정해질 때 0으로 초기화 */
+	UPROPERTY(ReplicatedUsing = OnRep_StagePreloadPercent, BlueprintReadOnly, Category = "Room")
+	uint8 StagePreloadPercent = 0;
+
+	/** [서버 전용] 선행 로드 진행률 설정 */
+	void SetStagePreloadPercent(uint8 NewPercent);
+
+	UFUNCTION()
+	void OnRep_StagePreloadPercent();
+
 protected:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	virtual void CopyProperties(APlayerState* PlayerState) override;
 };
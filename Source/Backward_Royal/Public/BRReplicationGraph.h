@@ -0,0 +1,149 @@
+// BRReplicationGraph.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "BRReplicationGraph.generated.h"
+
+class UReplicationGraphNode_GridSpatialization2D;
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_AlwaysRelevant_ForConnection;
+class UBRReplicationGraphNode_TeamPartners;
+class UBRReplicationGraphNode_PickupDormancy;
+
+/**
+ * Backward Royal 리플리케이션 그래프 (DefaultEngine.ini의 IpNetDriver ReplicationDriverClassName으로 지정)
+ * 기본 액터별 관련성 검사(모든 연결 x 모든 액터) 대신, 노드가 연결마다 보낼 액터 목록을 모아 줍니다.
+ * - 항상 관련: GameState(ABRGameState)·PlayerState 등 bAlwaysRelevant 액터
+ * - 연결 전용: PlayerController 등 bOnlyRelevantToOwner 액터는 소유 연결에만
+ * - 공간 그리드: 캐릭터(하체/상체)는 동적, 무기·드롭 아이템은 휴면 여부에 따라 정적/동적 셀
+ * - 팀 파트너: 같은 팀 하체·상체 Pawn은 거리·셀과 무관하게 서로에게 매 프레임 후보로 포함
+ * - 픽업 휴면: 바닥에 가만히 놓인 픽업은 Dormant로 전환해 복제 검사에서 빠지고, 움직이거나 집히면 즉시 깨움
+ */
+UCLASS(Transient, config = Engine)
+class BACKWARD_ROYAL_API UBRReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual int32 ServerReplicateActors(float DeltaSeconds) override;
+
+	/** 공간 그리드 셀 크기 (cm) */
+	UPROPERTY(config)
+	float GridCellSize = 10000.f;
+
+	/** 공간 그리드 원점 보정 (맵 최소 좌표). 셀 인덱스가 음수가 되지 않도록 */
+	UPROPERTY(config)
+	FVector2D GridSpatialBias = FVector2D(-UE_OLD_WORLD_MAX, -UE_OLD_WORLD_MAX);
+
+	/** 픽업이 이 시간(초) 동안 위치·부착 상태가 변하지 않으면 Dormant로 전환 */
+	UPROPERTY(config)
+	float PickupRestSecondsBeforeDormant = 2.f;
+
+protected:
+	/** 라우팅 분류 */
+	enum class EBRRepRoute : uint8
+	{
+		AlwaysRelevant,
+		OwnerOnly,
+		SpatializeDynamic,
+		SpatializeDormancy,
+	};
+
+	EBRRepRoute GetRoute(const AActor* Actor) const;
+
+	/** 캐릭터·상체 Pawn */
+	static bool IsCharacterClass(const UClass* Class);
+
+	/** 무기·드롭 아이템 (휴면 대상) */
+	static bool IsPickupClass(const UClass* Class);
+
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* GetAlwaysRelevantNodeForConnection(UNetConnection* Connection);
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	UPROPERTY()
+	TObjectPtr<UBRReplicationGraphNode_TeamPartners> TeamPartnersNode;
+
+	UPROPERTY()
+	TObjectPtr<UBRReplicationGraphNode_PickupDormancy> PickupDormancyNode;
+
+	/** 아직 소유 연결이 정해지지 않은 bOnlyRelevantToOwner 액터 (연결이 생기면 해당 연결 노드로 이동) */
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> ActorsWithoutNetConnection;
+};
+
+/**
+ * 팀 파트너 노드
+ * 매 프레임 GameState PlayerArray에서 팀별 Pawn 목록(하체 + 상체)을 만들고,
+ * 각 연결에는 자기 팀 목록을 그대로 넘깁니다. 그리드 셀·컬 거리와 관계없이 파트너끼리 항상 서로 보입니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRReplicationGraphNode_TeamPartners : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	UBRReplicationGraphNode_TeamPartners();
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override {}
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override { return false; }
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+private:
+	/** TeamNumber → 팀 Pawn 목록. 목록은 프레임마다 비우고 다시 채우되 메모리는 재사용 */
+	TMap<int32, FActorRepListRefView> TeamPawnLists;
+};
+
+/**
+ * 픽업 휴면 노드 (복제 목록을 내놓지 않고, 등록된 픽업의 Dormancy만 관리)
+ * 그리드에는 AddActor_Dormancy로 들어가 있으므로, Dormant가 되면 정적 셀로 옮겨져 매 프레임 위치 갱신·복제 검사에서 빠집니다.
+ * 서버에서 위치나 부착 부모가 바뀌면(주움, 던짐, 밀림) 같은 프레임 복제 전에 깨웁니다.
+ *
+ * 계약: 이 노드는 IsPickupClass 액터의 NetDormancy를 직접 바꿉니다(휴면 ↔ Awake).
+ * 위치·부착 외의 복제 프로퍼티는 감지하지 못하므로, 픽업 클래스에서 움직이지 않고 복제 값을 바꾸는 서버 코드는
+ * 반드시 값을 바꾼 직후 FlushNetDormancy()를 호출해야 합니다 (예: ABaseWeapon::LoadWeaponData, 메시 적용, DecreaseDurability).
+ * 픽업 클래스에서 NetDormancy를 직접 설정하지 마세요. 다음 PrepareForReplication에서 이 노드가 덮어씁니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRReplicationGraphNode_PickupDormancy : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	UBRReplicationGraphNode_PickupDormancy();
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override {}
+
+	/** 정지 후 휴면까지 대기 시간 (초) */
+	float RestSecondsBeforeDormant = 2.f;
+
+private:
+	struct FPickupRestState
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FVector LastLocation = FVector::ZeroVector;
+		TWeakObjectPtr<AActor> LastAttachParent;
+		double RestStartTime = 0.0;
+	};
+
+	/** 이 거리(cm) 이하 이동은 정지로 봄 (물리 미세 떨림) */
+	static constexpr float RestToleranceSq = 1.f;
+
+	TArray<FPickupRestState> Pickups;
+};
@@ -0,0 +1,100 @@
+// BRRespawnSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BRRespawnSubsystem.generated.h"
+
+class ABRSafeRespawnPoint;
+class APlayerCharacter;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogRespawn, Log, All);
+
+/**
+ * 낙하 리셋 리스폰 서비스 (서버 전용)
+ * - PlayerStart + ABRSafeRespawnPoint 위치를 맵당 1회 2D 격자로 색인합니다 (안전 지점 등록 변경·레벨 스트리밍 시에만 재구성).
+ * - 캐릭터 위치로 만든 점유 격자를 짧은 주기로 캐시해, 오버랩 쿼리 없이 빈 지점을 판단합니다.
+ * - 방금 배정한 지점은 잠시 예약해 같은 프레임에 떨어진 여러 명이 겹치지 않게 합니다.
+ * 상체(AUpperBodyPawn)가 들어오면 붙어 있는 하체를 옮기고, 상체는 부착으로 따라옵니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRRespawnSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** 월드에서 서비스 가져오기 (클라이언트 월드에는 없음) */
+	static UBRRespawnSubsystem* Get(const UObject* WorldContextObject);
+
+	static void RegisterSafePoint(ABRSafeRespawnPoint* SafePoint);
+	static void UnregisterSafePoint(ABRSafeRespawnPoint* SafePoint);
+
+	/**
+	 * 낙하한 액터를 가장 가까운 빈 안전 지점으로 이동
+	 * @return 이동했으면 true (캐릭터가 아니거나, 방금 리셋됐거나, 후보가 없으면 false)
+	 */
+	bool ResetFallenActor(AActor* FallenActor);
+
+	/** FromLocation에서 가장 가까운 빈 지점. 모두 점유 중이면 가장 가까운 지점 */
+	bool FindNearestFreePoint(const FVector& FromLocation, const AActor* IgnoreActor, FTransform& OutTransform);
+
+	/** 색인 격자 칸 크기 (cm) */
+	static constexpr float IndexCellSize = 2000.0f;
+
+	/** 이 반경(cm) 안에 다른 캐릭터가 있으면 점유로 판단 */
+	static constexpr float OccupancyRadius = 150.0f;
+
+	/** 점유 격자 재구성 주기 (초) */
+	static constexpr float OccupancyRefreshInterval = 0.25f;
+
+	/** 배정한 지점을 다른 사람에게 주지 않는 시간 (초) */
+	static constexpr float ReservationSeconds = 1.0f;
+
+	/** 같은 캐릭터(상체/하체 동시 오버랩 포함)의 중복 리셋 무시 시간 (초) */
+	static constexpr float ResetCooldownSeconds = 0.5f;
+
+private:
+	struct FRespawnPoint
+	{
+		FTransform Transform;
+		double ReservedUntil = 0.0;
+	};
+
+	void RebuildIndexIfDirty();
+	void HandleLevelChanged(ULevel* InLevel, UWorld* InWorld);
+	void RefreshOccupancy();
+	bool IsPointOccupied(const FVector& Location, const AActor* IgnoreActor) const;
+
+	static FIntPoint ToCell(const FVector& Location, float CellSize);
+
+	/** 안전 지점 액터 (PlayerStart는 UBRActorRegistrySubsystem에서 가져옴) */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABRSafeRespawnPoint>> SafePoints;
+
+	TArray<FRespawnPoint> Points;
+	TMap<FIntPoint, TArray<int32>> PointGrid;
+
+	FIntPoint MinCell = FIntPoint::ZeroValue;
+	FIntPoint MaxCell = FIntPoint::ZeroValue;
+
+	/** 안전 지점 등록/해제, 레벨 스트리밍(PlayerStart 추가/제거) 시 true */
+	bool bIndexDirty = true;
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+
+	/** 점유 격자: 칸 → 그 칸에 있는 캐릭터 위치 */
+	struct FOccupant
+	{
+		FVector Location;
+		TWeakObjectPtr<const AActor> Actor;
+	};
+	TMap<FIntPoint, TArray<FOccupant>> OccupancyGrid;
+	double OccupancyBuiltTime = -1.0;
+
+	TMap<TWeakObjectPtr<AActor>, double> LastResetTime;
+};
@@ -0,0 +1,21 @@
+// BRSafeRespawnPoint.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TargetPoint.h"
+#include "BRSafeRespawnPoint.generated.h"
+
+/**
+ * 낙하 리셋용 안전 지점
+ * 레벨에 배치하면 UBRRespawnSubsystem이 PlayerStart와 함께 리스폰 후보로 사용합니다.
+ * 캡슐 중심 높이에 배치하세요 (PlayerStart와 동일).
+ */
+UCLASS()
+class BACKWARD_ROYAL_API ABRSafeRespawnPoint : public ATargetPoint
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
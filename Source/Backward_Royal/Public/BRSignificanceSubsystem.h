@@ -0,0 +1,75 @@
+// BRSignificanceSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BRSignificanceSubsystem.generated.h"
+
+class ABaseCharacter;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSignificance, Log, All);
+
+/** 캐릭터 중요도 단계 (높을수록 갱신 빈도 높음) */
+UENUM()
+enum class EBRSignificance : uint8
+{
+	Low,		// 멀리 있거나 화면 밖
+	Medium,		// 화면 안, 중거리
+	High,		// 화면 안, 근거리
+	Critical	// 로컬 뷰 타깃 (내 몸 / 내 상하체 파트너)
+};
+
+/**
+ * 캐릭터 중요도 관리자
+ * 등록된 캐릭터를 일정 주기로 거리 / 렌더링 여부 / 로컬 뷰 타깃 여부로 점수화하고,
+ * 단계가 바뀐 캐릭터에만 ABaseCharacter::ApplySignificance를 호출해
+ * 애니메이션 갱신 빈도, 틱 간격, 컴포넌트 틱 활성 여부를 조정합니다.
+ * 렌더링 관점의 최적화이므로 전용 서버에는 생성되지 않습니다.
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRSignificanceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** 월드에서 관리자 가져오기 (전용 서버 등 없으면 nullptr) */
+	static UBRSignificanceSubsystem* Get(const UObject* WorldContextObject);
+
+	/** 캐릭터 등록 (BeginPlay에서 호출). 파괴된 캐릭터는 다음 평가 때 자동 제거 */
+	static void RegisterCharacter(ABaseCharacter* Character);
+
+	/** 평가 주기 (초) */
+	static constexpr float EvaluateInterval = 0.2f;
+
+	/** 이 거리(cm) 이내 + 화면 안이면 High */
+	static constexpr float HighSignificanceDistance = 1500.0f;
+
+	/** 이 거리(cm) 이내 + 화면 안이면 Medium, 그 밖은 Low */
+	static constexpr float MediumSignificanceDistance = 4000.0f;
+
+	/** 단계별 캐릭터 수 (디버그/통계용) */
+	int32 GetNumInTier(EBRSignificance Tier) const;
+
+private:
+	struct FTrackedCharacter
+	{
+		TWeakObjectPtr<ABaseCharacter> Character;
+		EBRSignificance Tier = EBRSignificance::Critical;
+		bool bApplied = false;
+	};
+
+	void Evaluate();
+
+	/** 로컬 플레이어들의 시점 위치와 뷰 타깃 수집 */
+	void GatherLocalViewers(TArray<FVector>& OutViewLocations, TArray<const AActor*>& OutViewTargets) const;
+
+	EBRSignificance ScoreCharacter(const ABaseCharacter* Character, const TArray<FVector>& ViewLocations, const TArray<const AActor*>& ViewTargets) const;
+
+	TArray<FTrackedCharacter> Tracked;
+
+	FTimerHandle EvaluateTimerHandle;
+};
@@ -0,0 +1,120 @@
+// BRStageCatalogSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "BRStageCatalogSubsystem.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogStageCatalog, Log, All);
+
+/** Stage별 적정 인원 (GameMode에서 지정. 지정하지 않은 Stage는 메모리 크기로 적합도 추정) */
+USTRUCT(BlueprintType)
+struct FBRStagePlayerRange
+{
+	GENERATED_BODY()
+
+	/** Stage 맵 이름 (패키지 짧은 이름, 예: Stage01_Temple) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stage")
+	FString StageName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stage", meta = (ClampMin = "1"))
+	int32 MinPlayers = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stage", meta = (ClampMin = "1"))
+	int32 MaxPlayers = 8;
+};
+
+/** 카탈로그 항목 */
+struct FBRStageCatalogEntry
+{
+	FString PackageName;
+
+	/** 맵 패키지 + 하드 의존 패키지 디스크 크기 합 (크기표 또는 에디터 에셋 레지스트리 기준 근사치, 0 = 알 수 없음) */
+	int64 ApproxMemoryBytes = 0;
+
+	/** 크기를 아는 Stage 중 크기 순위 (0=가장 작음, 1=가장 큼). 크기를 모르거나 크기를 아는 Stage가 하나뿐이면 -1 */
+	float SizeRank = -1.0f;
+
+	/** 적정 인원. 지정이 없으면 0 (크기로 추정) */
+	int32 MinPlayers = 0;
+	int32 MaxPlayers = 0;
+
+	/** 마지막으로 이 Stage로 이동한 시각 (UTC). 한 번도 없으면 FDateTime::MinValue() */
+	FDateTime LastPlayed = FDateTime::MinValue();
+};
+
+/**
+ * Stage 맵 카탈로그
+ * 서버 시작 후 처음 한 번만 Stage 목록을 만들고(목록이 없으면 Stage 폴더를 에셋 레지스트리로 스캔),
+ * 맵별 근사 메모리 크기와 적정 인원을 함께 보관합니다. 이후 맵 선택은 카탈로그 조회만 합니다.
+ * 맵 크기는 UBRStageSizeCommandlet이 에디터에서 만든 Data/StageSizes.json에서 읽습니다
+ * (쿠킹 빌드의 런타임 에셋 레지스트리에는 패키지 크기·의존성 정보가 없음. 에디터에서는 표에 없는 맵을 레지스트리로 직접 계산).
+ * 마지막 플레이 시각은 Saved/StageCatalog.json에 저장해 서버를 다시 켜도 최근 맵을 피합니다.
+ *
+ * 선택 가중치 = 인원 적합도 × 최근성
+ * - 적합도: 적정 인원이 지정된 Stage는 범위 밖이면 제외, 지정이 없으면 인원이 적을수록 작은 맵 쪽으로 기울임
+ * - 최근성: 직전 Stage는 제외(후보가 하나뿐이면 허용), 오래 안 한 맵일수록 가중치 증가
+ */
+UCLASS()
+class BACKWARD_ROYAL_API UBRStageCatalogSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	static UBRStageCatalogSubsystem* Get(const UObject* WorldContextObject);
+
+	/** 카탈로그 구성. 같은 입력으로 이미 만들었으면 아무것도 하지 않음 (GameMode BeginPlay·GetAvailableStageMapPaths·SelectStageMapPath에서 호출) */
+	void EnsureBuilt(const FString& StageFolderPath, const TArray<FString>& ExplicitStagePaths, const TArray<FBRStagePlayerRange>& PlayerRanges);
+
+	const TArray<FBRStageCatalogEntry>& GetEntries() const { return Entries; }
+
+	/** 카탈로그의 패키지 이름 목록 */
+	TArray<FString> GetStagePackageNames() const;
+
+	/** 인원 수에 맞춰 가중 랜덤 선택 (직전 Stage 회피). 카탈로그가 비어 있으면 빈 문자열 */
+	FString PickStage(int32 PlayerCount, int32 MaxPlayers) const;
+
+	/** 이 Stage로 이동함을 기록하고 저장 */
+	void MarkPlayed(const FString& PackageName);
+
+	/** 마지막 플레이 기록 파일 경로 */
+	static FString GetManifestFilePath();
+
+	/** Stage 크기표 파일 경로 (Data/StageSizes.json, 패키징 시 Data 폴더와 함께 배포) */
+	static FString GetStageSizeFilePath();
+
+	/** Stage 패키지 목록: 개별 목록이 있으면 그대로, 비어 있으면 Stage 폴더의 월드 에셋 */
+	static TArray<FString> CollectStagePackageNames(const FString& StageFolderPath, const TArray<FString>& ExplicitStagePaths);
+
+	/** 패키지 + 하드 의존 패키지 디스크 크기 합 (패키지 데이터가 있는 에디터 에셋 레지스트리 필요) */
+	static int64 ComputeApproxMemoryBytes(const FName PackageName);
+
+	/** 크기표 저장 (커맨드렛용) */
+	static bool WriteStageSizeFile(const FString& FilePath, const TMap<FString, int64>& SizeByPackage);
+
+private:
+	void LoadManifest();
+	void SaveManifest() const;
+	void LoadStageSizeFile();
+
+	/** 인원 적합도 (0이면 후보 제외) */
+	float GetSuitabilityWeight(const FBRStageCatalogEntry& Entry, int32 PlayerCount, int32 MaxPlayers) const;
+
+	TArray<FBRStageCatalogEntry> Entries;
+	TMap<FString, int32> IndexByPackage;
+
+	/** 저장 파일에서 읽은 마지막 플레이 시각 (카탈로그에 없는 맵도 보존) */
+	TMap<FString, FDateTime> LastPlayedByPackage;
+
+	/** 크기표에서 읽은 패키지별 근사 크기 */
+	TMap<FString, int64> StageSizeByPackage;
+
+	/** 마지막 EnsureBuilt 입력 해시 (같으면 재구성 생략) */
+	uint32 BuildKey = 0;
+	bool bBuilt = false;
+
+	/** 크기를 아는 항목을 크기순으로 정렬해 SizeRank 기록 */
+	void AssignSizeRanks();
+};
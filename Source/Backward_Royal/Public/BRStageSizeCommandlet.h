@@ -0,0 +1,24 @@
+// BRStageSizeCommandlet.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BRStageSizeCommandlet.generated.h"
+
+/**
+ * Stage 맵 크기표 생성 (Data/StageSizes.json)
+ * 에디터 에셋 레지스트리로 Stage 맵 패키지 + 하드 의존 패키지의 디스크 크기 합을 계산해 저장합니다.
+ * 쿠킹 빌드의 런타임 에셋 레지스트리에는 패키지 크기·의존성 정보가 없으므로 Stage 카탈로그는 이 표로 맵 크기를 구합니다.
+ *
+ * 사용: UnrealEditor-Cmd Backward_Royal.uproject -run=BRStageSize [-GameMode=/Game/.../BP_GM.BP_GM_C]
+ */
+UCLASS()
+class UBRStageSizeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBRStageSizeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
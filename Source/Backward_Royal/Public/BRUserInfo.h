@@ -67,6 +67,15 @@ struct BACKWARD_ROYAL_API FBRUserInfo
 		, ConnectedPlayerIndex(-1)
 	{
 	}
+
+	bool operator==(const FBRUserInfo& Other) const
+	{
+		return UserUID == Other.UserUID && PlayerName == Other.PlayerName && TeamID == Other.TeamID
+			&& PlayerIndex == Other.PlayerIndex && CustomizationData == Other.CustomizationData
+			&& bIsHost == Other.bIsHost && bIsReady == Other.bIsReady && bIsSpectator == Other.bIsSpectator
+			&& bIsLowerBody == Other.bIsLowerBody && ConnectedPlayerIndex == Other.ConnectedPlayerIndex;
+	}
+	bool operator!=(const FBRUserInfo& Other) const { return !(*this == Other); }
 };
 
 /** 로비/UI 표시용: PlayerName이 비어있거나 UserUID와 같으면 fallback(Player N) 사용 */
@@ -3,7 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
-#include "TimerManager.h"
+#include "BRLobbyViewModelSubsystem.h"
 #include "BR_LobbyMenuWidget.generated.h"
 
 class ABRPlayerController;
@@ -25,7 +25,6 @@ public:
 protected:
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
-	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
 public:
 	// 준비 상태 토글
@@ -95,6 +94,10 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Events")
 	void OnCanStartGameChanged(bool bCanStart);
 
+	// 다음 Stage 선행 로드 진행률 변경 이벤트 (Progress = 가장 느린 플레이어 기준 0~1)
+	UFUNCTION(BlueprintImplementableEvent, Category = "Events")
+	void OnStagePreloadProgressChanged(const FString& StageMapPath, float Progress);
+
 private:
 	// PlayerController 캐시 (mutable로 선언하여 const 함수에서도 수정 가능)
 	UPROPERTY()
@@ -104,16 +107,15 @@ private:
 	UPROPERTY()
 	mutable ABRGameState* CachedGameState;
 
-	/** 늦게 들어온 클라이언트용: 복제가 늦게 도착해도 UI 갱신하기 위한 지연 갱신 타이머 */
-	FTimerHandle LateJoinerRefreshTimerHandle;
+	/** 로비 뷰모델 구독 핸들 (NativeDestruct에서 해제) */
+	FDelegateHandle LobbyViewUpdatedHandle;
+
+	/** 뷰모델이 한 프레임 분량의 변경을 묶어 전달. 플래그에 해당하는 부분만 갱신 */
+	void HandleLobbyViewUpdated(EBRLobbyViewDirty DirtyFlags);
 
-	// 이벤트 바인딩 해제를 위한 함수들
-	UFUNCTION()
 	void HandlePlayerListChanged();
 
-	UFUNCTION()
 	void HandleTeamChanged();
 
-	UFUNCTION()
 	void HandleCanStartGameChanged();
 };
@@ -3,8 +3,8 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
-#include "TimerManager.h"
 #include "BRUserInfo.h"
+#include "BRLobbyViewModelSubsystem.h"
 #include "BR_LobbyTeamSlotDisplayInterface.h"
 #include "BR_SelectTeamWidget.generated.h"
 
@@ -15,7 +15,7 @@ class ABRGameState;
  * 로비 SelectTeam 파츠 위젯 (WBP_SelectTeam용)
  * 팀 하나당 3슬롯: SlotIndex 0=관전, 1=1Player(하체), 2=2Player(상체).
  * TeamIndex: 1=1팀, 2=2팀, 3=3팀, 4=4팀 (권장). 0~3도 호환.
- * OnPlayerListChanged 시 UpdateSlotDisplay 호출.
+ * 로비 뷰모델(UBRLobbyViewModelSubsystem)의 묶음 갱신 시 UpdateSlotDisplay 호출.
  */
 UCLASS()
 class BACKWARD_ROYAL_API UBR_SelectTeamWidget : public UUserWidget, public IBR_LobbyTeamSlotDisplayInterface
@@ -64,13 +64,9 @@ protected:
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
 
-	/** OnPlayerListChanged 바인딩 해제용 */
-	UFUNCTION()
-	void HandlePlayerListChanged();
+	/** 뷰모델 묶음 갱신 수신. 슬롯 배치/팀이 바뀐 경우에만 UpdateSlotDisplay */
+	void HandleLobbyViewUpdated(EBRLobbyViewDirty DirtyFlags);
 
-	/** 버튼 클릭 후 복제 도착 뒤 1P/2P 이름 갱신을 위해 짧은 지연 후 UpdateSlotDisplay 호출 */
-	void ScheduleSlotDisplayRefresh();
-
-	UPROPERTY()
-	TObjectPtr<ABRGameState> CachedGameState;
+	/** 로비 뷰모델 구독 핸들 (NativeDestruct에서 해제) */
+	FDelegateHandle LobbyViewUpdatedHandle;
 };
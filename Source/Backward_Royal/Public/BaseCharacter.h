@@ -16,6 +16,7 @@ class UAnimMontage;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHPChanged, float, CurrentHP, float, MaxHP);
 
 //      ü
+//   ʹ 0.1  ȭ(FVector_NetQuantize10 ), ȸ 16Ʈ 
 USTRUCT(BlueprintType)
 struct FDeathDamageInfo
 {
@@ -32,8 +33,18 @@ struct FDeathDamageInfo
 
     UPROPERTY()
     FRotator ServerDieRotation = FRotator::ZeroRotator;
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FDeathDamageInfo> : public TStructOpsTypeTraitsBase2<FDeathDamageInfo>
+{
+    enum { WithNetSerializer = true };
 };
 
+enum class EBRSignificance : uint8;
+
 UCLASS()
 class BACKWARD_ROYAL_API ABaseCharacter : public ACharacter
 {
@@ -44,6 +55,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 public:
@@ -100,6 +112,9 @@ public:
     bool bNextAttackIsLeft = false;
 
     void RequestAttack();
+
+    // ߿䵵 ܰ ݿ (UBRSignificanceSubsystem ܰ谡 ٲ  ȣ)
+    virtual void ApplySignificance(EBRSignificance NewSignificance);
     
     UFUNCTION(NetMulticast, Reliable)
     void MulticastHandleWeaponBroken();
@@ -121,15 +136,16 @@ public:
     void SetLastHitInfo(FVector Impulse, FVector HitLocation);
 
 
-    // [ű] ø̼   
-    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Status")
+    //  .  Ÿݸ (  ), Ŭ̾Ʈ MulticastPerformDeathVisuals   ä
+    UPROPERTY(BlueprintReadOnly, Category = "Status")
     FDeathDamageInfo LastDeathInfo;
 
+    //   +    (   η   )
     UFUNCTION(NetMulticast, Reliable)
-    void MulticastPerformDeathVisuals(FVector KillImpulse, FVector HitLocation, FVector ServerLoc, FRotator ServerRot);
+    void MulticastPerformDeathVisuals(const FDeathDamageInfo& DeathInfo);
 
-    UFUNCTION(NetMulticast, Unreliable)
-    void MulticastPlayPhysicalHitReaction(FVector Impulse, FVector HitLocation, FName BoneName);
+    /**  ִϸ̼ 鸲.   Ÿ ̺Ʈ(FBRCombatEvent)    ӽſ ȣ */
+    void PlayPhysicalHitReaction(const FVector& Impulse, const FVector& HitLocation, FName BoneName);
 
     // --- Weapon ---
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Combat", Replicated)
@@ -22,12 +22,6 @@ public:
     virtual void Interact(class ABaseCharacter* Character) override;
     virtual FText GetInteractionPrompt() override;
 
-    // ---  뷱  (  ) ---
-    static float GlobalDamageMultiplier;
-    static float GlobalImpulseMultiplier;
-    static float GlobalAttackSpeedMultiplier;
-    static float GlobalDurabilityReduction;
-
     // ---    ޽ ---
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon")
     UStaticMeshComponent* WeaponMesh;
@@ -54,7 +48,7 @@ public:
     void BreakWeapon();
 
     UFUNCTION(NetMulticast, Reliable)
-    void Multicast_BreakWeaponVisual(const FTransform& SpawnTransform, class UGeometryCollection* InFracturedMesh);
+    void Multicast_BreakWeaponVisual(const FTransform& SpawnTransform, const TSoftObjectPtr<UGeometryCollection>& InFracturedMesh);
 
     // DamageAmount:     ( 2 )
     UFUNCTION(BlueprintCallable, Category = "Weapon|Durability")
@@ -74,4 +68,11 @@ protected:
 private:
     bool bIsEquipped;
 
+    /**  ޽/ ޽ 񵿱 ε ڵ (Ⱑ ִ   ޽ø ֽ ı  ġ ) */
+    TSharedPtr<struct FStreamableHandle> WeaponAssetHandle;
+
+    /** 뷱  ٲ  ҷ  (/ݷ/ ӵ  UBRAttackComponent ĳ) */
+    void HandleBalanceChanged(const struct FBRBalanceSnapshot& Snapshot);
+    uint32 CachedBalanceSerial = MAX_uint32;
+
 };
\ No newline at end of file
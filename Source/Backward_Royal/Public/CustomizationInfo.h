@@ -28,4 +28,11 @@ struct FBRCustomizationData
     // Ͱ ȿ üũ (  true  ʼ)
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     bool bIsDataValid = false;
+
+    bool operator==(const FBRCustomizationData& Other) const
+    {
+        return HeadID == Other.HeadID && ChestID == Other.ChestID && HandID == Other.HandID
+            && LegID == Other.LegID && FootID == Other.FootID && bIsDataValid == Other.bIsDataValid;
+    }
+    bool operator!=(const FBRCustomizationData& Other) const { return !(*this == Other); }
 };
\ No newline at end of file
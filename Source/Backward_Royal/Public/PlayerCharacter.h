@@ -21,11 +21,6 @@ public:
     APlayerCharacter();
     virtual void OnRep_PlayerState() override;
 
-    // 플레이어 이동 관련 전역 변수 (GameInstance에서 업데이트됨)
-    static float Global_RotationRateYaw;
-    static float Global_BrakingFriction;
-    static float Global_BrakingDecelerationWalking;
-
 protected:
     virtual void BeginPlay() override;
     virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
@@ -34,6 +29,7 @@ protected:
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaTime) override;
+    virtual void ApplySignificance(EBRSignificance NewSignificance) override;
     
     // 발자국 소리 처리 함수
     void ProcessFootstep(float DeltaTime);
@@ -188,4 +184,11 @@ private:
 
     /** 전원 스폰 완료 후 Move()에서 컨트롤러 이동 입력 해제를 1회만 수행했는지 */
     bool bMoveInputUnblocked = false;
+
+    /** 슬롯별 마지막으로 요청된 방어구 ID (비동기 로드 완료 시 최신 요청인지 확인용) */
+    int32 RequestedArmorIDs[(int32)EArmorSlot::None] = {};
+
+    /** 밸런스 스냅샷이 바뀌었을 때만 이동 관성(회전/마찰/감속) 갱신. 서버와 자율 프록시가 같은 값으로 예측 */
+    void HandleBalanceChanged(const struct FBRBalanceSnapshot& Snapshot);
+    uint32 CachedBalanceSerial = MAX_uint32;
 };
\ No newline at end of file
@@ -10,6 +10,23 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStaminaValueUpdated, float, Curr
 //   ˸ Ʈ (: ħ, ȸ)
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSprintStateChanged, bool, bCanSprint);
 
+//  ¹̳ : ذ + ʴ ȭ +  ð
+// ȭ ٲ (޸ /,  Ҹ, ,  ) ŵǰ Ŭ̾Ʈ   ܻմϴ.
+USTRUCT()
+struct FBRStaminaState
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    float Value = 0.0f;
+
+    UPROPERTY()
+    float RatePerSecond = 0.0f;
+
+    UPROPERTY()
+    float ServerTimeSeconds = 0.0f;
+};
+
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class BACKWARD_ROYAL_API UStaminaComponent : public UActorComponent
 {
@@ -18,12 +35,9 @@ class BACKWARD_ROYAL_API UStaminaComponent : public UActorComponent
 public:
     UStaminaComponent();
 
-    static float Global_SprintDrainRate;
-    static float Global_JumpCost;
-    static float Global_RegenRate;
-
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
@@ -44,11 +58,15 @@ public:
     UFUNCTION(BlueprintCallable)
     float GetStaminaRatio() const;
 
+    //  ʴ ¹̳ ȭ ( = Ҹ,  = ȸ)
+    float GetStaminaRate() const { return StaminaState.RatePerSecond; }
+
 public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stamina")
     float MaxStamina;
 
-    UPROPERTY(ReplicatedUsing = OnRep_CurrentStamina, VisibleAnywhere, BlueprintReadOnly, Category = "Stamina")
+    // :  ƽ 갪 / Ŭ̾Ʈ: StaminaState ܻ  (  )
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stamina")
     float CurrentStamina;
 
     UPROPERTY(EditAnywhere, Category = "Stamina")
@@ -73,6 +91,30 @@ public:
     UPROPERTY(BlueprintAssignable)
     FOnSprintStateChanged OnSprintStateChanged;
 
+private:
+    UPROPERTY(ReplicatedUsing = OnRep_StaminaState)
+    FBRStaminaState StaminaState;
+
     UFUNCTION()
-    void OnRep_CurrentStamina();
+    void OnRep_StaminaState();
+
+    // [] Ҹ/ȸ . ȭ ٲ StaminaState 
+    void TickAuthority(float DeltaTime);
+
+    // [Ŭ̾Ʈ] StaminaState    ܻ
+    void TickExtrapolate();
+
+    // []   ȭ  ð Բ   
+    void CommitStaminaState(float NewRate);
+
+    float ExtrapolateStamina() const;
+    float GetServerTimeSeconds() const;
+
+    // UI  ˸
+    void BroadcastStaminaChanged();
+
+    // 뷱  ٲ  Ҹ/ȸ/ ġ  (   ȭ ٷ ٽ )
+    void HandleBalanceChanged(const struct FBRBalanceSnapshot& Snapshot);
+    // ù (Serial 0, ⺻) ݵ ǵ  Serial ٸ  
+    uint32 CachedBalanceSerial = MAX_uint32;
 };
\ No newline at end of file
@@ -34,6 +34,12 @@ protected:
 	void Interact(const FInputActionValue& Value);
 
 	virtual void OnRep_PlayerState() override;
+	virtual void PossessedBy(AController* NewController) override;
+	virtual void UnPossessed() override;
+	virtual void OnRep_Controller() override;
+
+	// θ  ã ̰ų  (/)  ƽ . ùķƮ Ͻô  
+	void UpdateTickEnabled();
 
 public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
@@ -29,13 +29,13 @@ struct FWeaponData : public FTableRowBase
 {
     GENERATED_BODY()
 
-    // Initialize pointer to nullptr
+    // 소프트 참조: 테이블 로드 시 모든 무기 메시가 상주하지 않도록 함 (ABaseWeapon에서 비동기 로드)
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    UStaticMesh* WeaponMesh = nullptr;
+    TSoftObjectPtr<UStaticMesh> WeaponMesh;
 
-    // Initialize pointer to nullptr
+    // 파괴 시 사용할 지오메트리 컬렉션 (무기 데이터 로드 시 함께 비동기 로드)
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    UGeometryCollection* FracturedMesh = nullptr;
+    TSoftObjectPtr<UGeometryCollection> FracturedMesh;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FName DisplayName;